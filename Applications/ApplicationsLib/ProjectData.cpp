@@ -277,6 +277,45 @@ std::optional<ParameterLib::CoordinateSystem> parseLocalCoordinateSystem(
     return ParameterLib::CoordinateSystem{basis_vector_0, basis_vector_1,
                                           basis_vector_2};
 }
+
+/// Returns the settings of the global assembly loops of a process. Without
+/// configuration the serial assembly is used.
+ProcessLib::GlobalAssemblyOptions parseGlobalAssemblyOptions(
+    std::optional<BaseLib::ConfigTree> const& config)
+{
+    ProcessLib::GlobalAssemblyOptions options;
+    if (!config)
+    {
+        return options;
+    }
+
+    //! \ogs_file_param{prj__processes__process__global_assembler__type}
+    auto const type = config->getConfigParameter<std::string>("type");
+
+    if (type == "Serial")
+    {
+        return options;
+    }
+    if (type == "Parallel")
+    {
+        options.number_of_threads =
+            //! \ogs_file_param{prj__processes__process__global_assembler__number_of_threads}
+            config->getConfigParameter<int>("number_of_threads", 0);
+        if (options.number_of_threads < 0)
+        {
+            OGS_FATAL(
+                "The number of threads of the global assembler must not be "
+                "negative, got {:d}.",
+                options.number_of_threads);
+        }
+        options.use_element_coloring =
+            //! \ogs_file_param{prj__processes__process__global_assembler__use_element_coloring}
+            config->getConfigParameter<bool>("use_element_coloring", false);
+        return options;
+    }
+
+    OGS_FATAL("Unknown global assembler type: `{:s}'.", type);
+}
 }  // namespace
 
 ProjectData::ProjectData() = default;
@@ -600,6 +639,10 @@ void ProjectData::parseProcesses(
             //! \ogs_file_param{prj__processes__process__jacobian_assembler}
             process_config.getConfigSubtreeOptional("jacobian_assembler"));
 
+        auto const global_assembly_options = parseGlobalAssemblyOptions(
+            //! \ogs_file_param{prj__processes__process__global_assembler}
+            process_config.getConfigSubtreeOptional("global_assembler"));
+
 #ifdef OGS_BUILD_PROCESS_STEADYSTATEDIFFUSION
         if (type == "STEADY_STATE_DIFFUSION")
         {
@@ -1116,6 +1159,7 @@ void ProjectData::parseProcesses(
         {
             OGS_FATAL("The process name '{:s}' is not unique.", name);
         }
+        process->setGlobalAssemblyOptions(global_assembly_options);
         _processes.push_back(std::move(process));
     }
 }
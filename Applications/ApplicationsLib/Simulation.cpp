@@ -22,6 +22,7 @@
 #include "BaseLib/FileTools.h"
 #include "BaseLib/PrjProcessing.h"
 #include "NumLib/NumericsConfig.h"
+#include "ProcessLib/Checkpoint.h"
 #include "ProcessLib/TimeLoop.h"
 
 Simulation::Simulation(int argc, char* argv[])
@@ -41,7 +42,7 @@ void Simulation::initializeDataStructures(
     std::vector<std::string> const& xml_patch_file_names,
     bool const reference_path_is_set, std::string const& reference_path,
     bool const nonfatal, std::string const& outdir, std::string const& mesh_dir,
-    bool const write_prj)
+    bool const write_prj, std::string const& restart_file)
 {
     INFO("Reading project file {}.",
          std::filesystem::absolute(project).string());
@@ -90,6 +91,24 @@ void Simulation::initializeDataStructures(
     project_data = std::make_unique<ProjectData>(
         project_config, BaseLib::getProjectDirectory(), outdir, mesh_dir);
 
+    std::unique_ptr<ProcessLib::CheckpointFile> checkpoint;
+    if (!restart_file.empty())
+    {
+#ifdef USE_PETSC
+        OGS_FATAL("Restarting from a checkpoint is not supported with PETSc.");
+#endif
+        INFO("Reading checkpoint {}.",
+             std::filesystem::absolute(restart_file).string());
+        checkpoint = std::make_unique<ProcessLib::CheckpointFile>(
+            restart_file, ProcessLib::CheckpointFile::Mode::Read);
+        // The integration point data are set up like initial conditions
+        // during the initialization of the processes.
+        for (auto& p : project_data->getProcesses())
+        {
+            ProcessLib::addIntegrationPointDataToMesh(*checkpoint, *p);
+        }
+    }
+
     INFO("Initialize processes.");
     for (auto& p : project_data->getProcesses())
     {
@@ -101,7 +120,7 @@ void Simulation::initializeDataStructures(
     BaseLib::ConfigTree::assertNoSwallowedErrors();
 
     auto& time_loop = project_data->getTimeLoop();
-    time_loop.initialize();
+    time_loop.initialize(checkpoint.get());
 }
 
 double Simulation::currentTime() const
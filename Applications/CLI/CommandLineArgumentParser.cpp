@@ -84,11 +84,28 @@ CommandLineArgumentParser::CommandLineArgumentParser(int argc, char* argv[])
         "m", "mesh-input-directory",
         "the directory where the meshes are read from", false, "", "PATH");
 
+    TCLAP::ValueArg<std::string> restart_arg(
+        "", "restart",
+        "restarts the simulation from the given checkpoint file, which has "
+        "been written by a simulation of the same PROJECT_FILE",
+        false, "", "CHECKPOINT_FILE");
+
     TCLAP::SwitchArg write_prj_arg("",
                                    "write-prj",
                                    "Writes processed project file to output "
                                    "path / [prj_base_name]_processed.prj.");
 
+    TCLAP::ValueArg<std::string> profile_arg(
+        "", "profile",
+        "profiles the simulation and writes a summary of the timings of the "
+        "assembly, linear solver, output, etc. to PREFIX.json and PREFIX.csv",
+        false, "", "PREFIX");
+
+    TCLAP::SwitchArg profile_timeline_arg(
+        "", "profile-timeline",
+        "additionally writes a timeline of the profiled regions in the Chrome "
+        "trace event format to PREFIX_trace.json; requires --profile");
+
     TCLAP::SwitchArg nonfatal_arg("",
                                   "config-warnings-nonfatal",
                                   "warnings from parsing the configuration "
@@ -98,10 +115,13 @@ CommandLineArgumentParser::CommandLineArgumentParser(int argc, char* argv[])
     cmd.add(xml_patch_files_arg);
     cmd.add(outdir_arg);
     cmd.add(mesh_dir_arg);
+    cmd.add(restart_arg);
     cmd.add(write_prj_arg);
     cmd.add(log_level_arg);
     cmd.add(nonfatal_arg);
     cmd.add(unbuffered_cout_arg);
+    cmd.add(profile_arg);
+    cmd.add(profile_timeline_arg);
 #ifndef _WIN32  // TODO: On windows floating point exceptions are not handled
                 // currently
     cmd.add(enable_fpe_arg);
@@ -119,9 +139,12 @@ CommandLineArgumentParser::CommandLineArgumentParser(int argc, char* argv[])
     outdir = outdir_arg.getValue();
     mesh_dir = mesh_dir_arg.getValue().empty() ? BaseLib::getProjectDirectory()
                                                : mesh_dir_arg.getValue();
+    restart_file = restart_arg.getValue();
     nonfatal = nonfatal_arg.getValue();
     log_level = log_level_arg.getValue();
     write_prj = write_prj_arg.getValue();
+    profile = profile_arg.getValue();
+    profile_timeline = profile_timeline_arg.getValue();
 
     // deactivate buffer for standard output if specified
     if (unbuffered_cout_arg.isSet())
@@ -24,7 +24,10 @@ struct CommandLineArgumentParser final
     std::vector<std::string> xml_patch_file_names;
     std::string outdir;
     std::string mesh_dir;
+    std::string restart_file;
     std::string log_level;
+    std::string profile;
+    bool profile_timeline;
     bool write_prj;
     bool nonfatal;
     bool reference_path_is_set;
@@ -33,7 +33,7 @@
 #include "BaseLib/DateTools.h"
 #include "BaseLib/Error.h"
 #include "BaseLib/Logging.h"
-#include "BaseLib/RunTime.h"
+#include "BaseLib/Profiler.h"
 #include "InfoLib/GitInfo.h"
 
 #ifdef OGS_USE_PYTHON
@@ -72,7 +72,10 @@ int main(int argc, char* argv[])
     (void)guard;
 #endif
 
-    BaseLib::RunTime run_time;
+    if (!cli_arg.profile.empty())
+    {
+        BaseLib::Profiler::enable(cli_arg.profile_timeline);
+    }
 
     {
         auto const start_time = std::chrono::system_clock::now();
@@ -87,17 +90,26 @@ int main(int argc, char* argv[])
     try
     {
         Simulation simulation(argc, argv);
-        run_time.start();
-        simulation.initializeDataStructures(
-            std::move(cli_arg.project), std::move(cli_arg.xml_patch_file_names),
-            cli_arg.reference_path_is_set, std::move(cli_arg.reference_path),
-            cli_arg.nonfatal, std::move(cli_arg.outdir),
-            std::move(cli_arg.mesh_dir), cli_arg.write_prj);
-        bool solver_succeeded = simulation.executeSimulation();
-        simulation.outputLastTimeStep();
-        test_definition = simulation.getTestDefinition();
-
-        INFO("[time] Execution took {:g} s.", run_time.elapsed());
+        bool solver_succeeded;
+        {
+            BaseLib::ProfilerRegion run_time("execution");
+            simulation.initializeDataStructures(
+                std::move(cli_arg.project),
+                std::move(cli_arg.xml_patch_file_names),
+                cli_arg.reference_path_is_set,
+                std::move(cli_arg.reference_path), cli_arg.nonfatal,
+                std::move(cli_arg.outdir), std::move(cli_arg.mesh_dir),
+                cli_arg.write_prj, cli_arg.restart_file);
+            solver_succeeded = simulation.executeSimulation();
+            simulation.outputLastTimeStep();
+            test_definition = simulation.getTestDefinition();
+
+            INFO("[time] Execution took {:g} s.", run_time.elapsed());
+        }
+        if (!cli_arg.profile.empty())
+        {
+            BaseLib::Profiler::write(cli_arg.profile);
+        }
         ogs_status = solver_succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
     }
     catch (std::exception& e)
@@ -20,7 +20,7 @@
 #include "BaseLib/DateTools.h"
 #include "BaseLib/Error.h"
 #include "BaseLib/Logging.h"
-#include "BaseLib/RunTime.h"
+#include "BaseLib/Profiler.h"
 #include "CommandLineArgumentParser.h"
 #include "InfoLib/GitInfo.h"
 
@@ -29,6 +29,7 @@
 #endif
 
 std::unique_ptr<Simulation> simulation;
+std::string profile;
 
 void initOGS(std::vector<std::string>& argv_str)
 {
@@ -41,6 +42,11 @@ void initOGS(std::vector<std::string>& argv_str)
 
     CommandLineArgumentParser cli_args(argc, argv);
     BaseLib::initOGSLogger(cli_args.log_level);
+    profile = cli_args.profile;
+    if (!profile.empty())
+    {
+        BaseLib::Profiler::enable(cli_args.profile_timeline);
+    }
 
     INFO("This is OpenGeoSys-6 version {:s}.",
          GitInfoLib::GitInfo::ogs_version);
@@ -63,7 +69,8 @@ void initOGS(std::vector<std::string>& argv_str)
             std::move(cli_args.xml_patch_file_names),
             cli_args.reference_path_is_set, std::move(cli_args.reference_path),
             cli_args.nonfatal, std::move(cli_args.outdir),
-            std::move(cli_args.mesh_dir), cli_args.write_prj);
+            std::move(cli_args.mesh_dir), cli_args.write_prj,
+            cli_args.restart_file);
     }
     catch (std::exception& e)
     {
@@ -76,8 +83,6 @@ void initOGS(std::vector<std::string>& argv_str)
 
 void executeSimulation()
 {
-    BaseLib::RunTime run_time;
-
     {
         auto const start_time = std::chrono::system_clock::now();
         auto const time_str = BaseLib::formatDate(start_time);
@@ -88,7 +93,7 @@ void executeSimulation()
 
     try
     {
-        run_time.start();
+        BaseLib::ProfilerRegion run_time("execution");
         bool solver_succeeded = simulation->executeSimulation();
         INFO("[time] Execution took {:g} s.", run_time.elapsed());
         ogs_status = solver_succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
@@ -118,6 +123,10 @@ double endTime()
 
 void finalize()
 {
+    if (!profile.empty())
+    {
+        BaseLib::Profiler::write(profile);
+    }
     simulation.reset(nullptr);
 }
 
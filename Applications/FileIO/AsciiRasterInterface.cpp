@@ -13,11 +13,17 @@
 
 #include "AsciiRasterInterface.h"
 
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <filesystem>
+#include <optional>
 #include <tuple>
 
 #include "BaseLib/FileTools.h"
 #include "BaseLib/Logging.h"
 #include "BaseLib/StringTools.h"
+#include "GeoLib/RasterTiles.h"
 
 namespace FileIO
 {
@@ -45,6 +51,106 @@ static double readDoubleFromStream(std::istream& in)
                        nullptr);
 }
 
+namespace
+{
+/// Reads whitespace separated doubles from a stream. The input is read in
+/// large chunks and parsed with std::from_chars, which is much faster than
+/// reading each value with operator>>. Like readDoubleFromStream(), a comma is
+/// accepted as decimal separator.
+class DoubleReader
+{
+public:
+    explicit DoubleReader(std::istream& in) : _in(in) {}
+
+    /// Returns the next value or nothing at the end of the input.
+    std::optional<double> read()
+    {
+        auto const is_space = [](char const c)
+        { return std::isspace(static_cast<unsigned char>(c)) != 0; };
+
+        // Skip whitespace.
+        while (true)
+        {
+            while (_begin != _end && is_space(_buffer[_begin]))
+            {
+                ++_begin;
+            }
+            if (_begin != _end || !fill())
+            {
+                break;
+            }
+        }
+        if (_begin == _end)
+        {
+            return std::nullopt;
+        }
+
+        // Find the end of the token; it might continue in the next chunk.
+        std::size_t token_end = _begin;
+        while (true)
+        {
+            while (token_end != _end && !is_space(_buffer[token_end]))
+            {
+                ++token_end;
+            }
+            if (token_end != _end)
+            {
+                break;
+            }
+            std::size_t const token_length = token_end - _begin;
+            bool const has_more_input = fill();
+            token_end = _begin + token_length;
+            if (!has_more_input)
+            {
+                break;
+            }
+        }
+
+        char const* const first = _buffer.data() + _begin;
+        char const* const last = _buffer.data() + token_end;
+        _begin = token_end;
+
+        double value;
+        if (auto const [ptr, ec] = std::from_chars(first, last, value);
+            ec == std::errc{} && ptr == last)
+        {
+            return value;
+        }
+        // E.g. a comma as decimal separator or a leading plus sign.
+        return std::strtod(
+            BaseLib::replaceString(",", ".", std::string(first, last)).c_str(),
+            nullptr);
+    }
+
+private:
+    /// Moves the unread characters to the front of the buffer and appends the
+    /// next chunk of the input. Returns false if nothing could be read.
+    bool fill()
+    {
+        std::copy(_buffer.begin() + _begin, _buffer.begin() + _end,
+                  _buffer.begin());
+        _end -= _begin;
+        _begin = 0;
+        if (_end == _buffer.size())
+        {
+            // A single token fills the whole buffer.
+            _buffer.resize(2 * _buffer.size());
+        }
+        _in.read(_buffer.data() + _end,
+                 static_cast<std::streamsize>(_buffer.size() - _end));
+        auto const n_read = static_cast<std::size_t>(_in.gcount());
+        _end += n_read;
+        return n_read > 0;
+    }
+
+    std::istream& _in;
+    std::vector<char> _buffer = std::vector<char>(1 << 20);
+    /// Range of the unread characters in the buffer.
+    std::size_t _begin = 0;
+    std::size_t _end = 0;
+};
+}  // namespace
+
 /// Reads the header of a Esri asc-file.
 /// If the return value is empty, reading was not successful.
 static std::optional<GeoLib::RasterHeader> readASCHeader(std::ifstream& in)
@@ -145,19 +251,128 @@ GeoLib::Raster* AsciiRasterInterface::getRasterFromASCFile(
     }
 
     std::vector<double> values(header->n_cols * header->n_rows);
+    DoubleReader reader(in);
     // read the data into the double-array
     for (std::size_t j(0); j < header->n_rows; ++j)
     {
         const std::size_t idx((header->n_rows - j - 1) * header->n_cols);
         for (std::size_t i(0); i < header->n_cols; ++i)
         {
-            values[idx + i] = readDoubleFromStream(in);
+            auto const value = reader.read();
+            if (!value)
+            {
+                ERR("Raster::getRasterFromASCFile(): Expected {:d} values in "
+                    "file {:s}, but the file ended after {:d} values.",
+                    header->n_cols * header->n_rows, fname,
+                    j * header->n_cols + i);
+                return nullptr;
+            }
+            values[idx + i] = *value;
         }
     }
 
     return new GeoLib::Raster(*header, values.begin(), values.end());
 }
 
+/// Writes the values of an ASC file, which has been read up to the end of its
+/// header, row by row to a tile file for GeoLib::RasterTiles. Returns false if
+/// the ASC file ends early.
+static bool writeASCValuesAsRasterTiles(std::ifstream& in,
+                                        GeoLib::RasterHeader const& header,
+                                        std::string const& fname,
+                                        std::string const& tiles_fname)
+{
+    GeoLib::RasterTilesWriter writer(tiles_fname, header);
+    DoubleReader reader(in);
+    std::vector<double> row(header.n_cols);
+    for (std::size_t j(0); j < header.n_rows; ++j)
+    {
+        for (std::size_t i(0); i < header.n_cols; ++i)
+        {
+            auto const value = reader.read();
+            if (!value)
+            {
+                ERR("Raster::getTiledRasterFromASCFile(): Expected {:d} values "
+                    "in file {:s}, but the file ended after {:d} values.",
+                    header.n_cols * header.n_rows, fname,
+                    j * header.n_cols + i);
+                return false;
+            }
+            row[i] = *value;
+        }
+        writer.addRow(row);
+    }
+    writer.finish();
+    return true;
+}
+
+/// Converts an ASC file to a tile file for GeoLib::RasterTiles.
+static bool convertASCFileToRasterTiles(std::string const& fname,
+                                        std::string const& tiles_fname)
+{
+    std::ifstream in(fname.c_str());
+    if (!in.is_open())
+    {
+        WARN("Raster::getTiledRasterFromASCFile(): Could not open file {:s}.",
+             fname);
+        return false;
+    }
+
+    auto const header = readASCHeader(in);
+    if (!header)
+    {
+        WARN(
+            "Raster::getTiledRasterFromASCFile(): Could not read header of "
+            "file {:s}",
+            fname);
+        return false;
+    }
+
+    // Written to a temporary file first, such that an interrupted conversion
+    // does not leave an incomplete tile file behind. The temporary file is
+    // removed if the conversion fails.
+    std::string const tmp_fname = tiles_fname + ".tmp";
+    try
+    {
+        if (writeASCValuesAsRasterTiles(in, *header, fname, tmp_fname))
+        {
+            std::filesystem::rename(tmp_fname, tiles_fname);
+            return true;
+        }
+    }
+    catch (std::exception const& e)
+    {
+        ERR("Raster::getTiledRasterFromASCFile(): Could not write the tile "
+            "file {:s}: {:s}",
+            tiles_fname, e.what());
+    }
+    std::error_code ec;
+    std::filesystem::remove(tmp_fname, ec);
+    return false;
+}
+
+GeoLib::Raster* AsciiRasterInterface::getTiledRasterFromASCFile(
+    std::string const& fname)
+{
+    std::string const tiles_fname = fname + ".tiles";
+
+    std::error_code ec;
+    auto const tiles_time = std::filesystem::last_write_time(tiles_fname, ec);
+    bool const is_up_to_date =
+        !ec && tiles_time >= std::filesystem::last_write_time(fname, ec) && !ec;
+    if (!is_up_to_date)
+    {
+        INFO("Converting raster {:s} to tile file {:s}.", fname, tiles_fname);
+        if (!convertASCFileToRasterTiles(fname, tiles_fname))
+        {
+            return nullptr;
+        }
+    }
+
+    return new GeoLib::Raster(
+        std::make_unique<GeoLib::RasterTiles>(tiles_fname));
+}
+
 /// Reads the header of a Surfer grd-file with minimum and maximum values.
 /// If the return value is empty, reading was not successful.
 static std::optional<std::tuple<GeoLib::RasterHeader, double, double>>
@@ -225,13 +440,23 @@ GeoLib::Raster* AsciiRasterInterface::getRasterFromSurferFile(
     auto const [header, min, max] = *optional_header;
     const double no_data_val(min - 1);
     std::vector<double> values(header.n_cols * header.n_rows);
+    DoubleReader reader(in);
     // read the data into the double-array
     for (std::size_t j(0); j < header.n_rows; ++j)
     {
         const std::size_t idx(j * header.n_cols);
         for (std::size_t i(0); i < header.n_cols; ++i)
         {
-            const double val = readDoubleFromStream(in);
+            auto const value = reader.read();
+            if (!value)
+            {
+                ERR("Raster::getRasterFromSurferFile(): Expected {:d} values "
+                    "in file {:s}, but the file ended after {:d} values.",
+                    header.n_cols * header.n_rows, fname,
+                    j * header.n_cols + i);
+                return nullptr;
+            }
+            double const val = *value;
             values[idx + i] = (val > max || val < min) ? no_data_val : val;
         }
     }
@@ -260,14 +485,13 @@ void AsciiRasterInterface::writeRasterAsASC(GeoLib::Raster const& raster,
     out << "NODATA_value " << header.no_data << "\n";
 
     // write data
-    double const* const elevation(raster.begin());
     for (unsigned row(0); row < nRows; ++row)
     {
         for (unsigned col(0); col < nCols - 1; ++col)
         {
-            out << elevation[(nRows - row - 1) * nCols + col] << " ";
+            out << raster(row, col) << " ";
         }
-        out << elevation[(nRows - row) * nCols - 1] << "\n";
+        out << raster(row, nCols - 1) << "\n";
     }
     out.close();
 }
@@ -289,7 +513,7 @@ static bool allRastersExist(std::vector<std::string> const& raster_paths)
 }
 
 std::optional<std::vector<GeoLib::Raster const*>> readRasters(
-    std::vector<std::string> const& raster_paths)
+    std::vector<std::string> const& raster_paths, bool const use_raster_tiles)
 {
     if (!allRastersExist(raster_paths))
     {
@@ -300,8 +524,16 @@ std::optional<std::vector<GeoLib::Raster const*>> readRasters(
     rasters.reserve(raster_paths.size());
     std::transform(raster_paths.begin(), raster_paths.end(),
                    std::back_inserter(rasters),
-                   [](auto const& path)
-                   { return FileIO::AsciiRasterInterface::readRaster(path); });
+                   [&](auto const& path) -> GeoLib::Raster const*
+                   {
+                       if (use_raster_tiles &&
+                           BaseLib::hasFileExtension(".asc", path))
+                       {
+                           return FileIO::AsciiRasterInterface::
+                               getTiledRasterFromASCFile(path);
+                       }
+                       return FileIO::AsciiRasterInterface::readRaster(path);
+                   });
     return std::make_optional(rasters);
 }
 }  // end namespace FileIO
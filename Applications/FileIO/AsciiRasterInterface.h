@@ -35,6 +35,12 @@ public:
     /// Reads an ArcGis ASC raster file
     static GeoLib::Raster* getRasterFromASCFile(std::string const& fname);
 
+    /// Reads an ArcGis ASC raster file into a raster, which reads its data on
+    /// demand from the tile file fname + ".tiles", see GeoLib::RasterTiles.
+    /// The tile file is created if it doesn't exist or is older than the ASC
+    /// file. Otherwise the ASC file is not parsed at all.
+    static GeoLib::Raster* getTiledRasterFromASCFile(std::string const& fname);
+
     /// Reads a Surfer GRD raster file
     static GeoLib::Raster* getRasterFromSurferFile(std::string const& fname);
 
@@ -44,6 +50,9 @@ public:
 
 /// Reads a vector of rasters given by file names. On error nothing is returned,
 /// otherwise the returned vector contains pointers to the read rasters.
+/// If \c use_raster_tiles is set, ASC files are read on demand from tile files,
+/// see AsciiRasterInterface::getTiledRasterFromASCFile().
 std::optional<std::vector<GeoLib::Raster const*>> readRasters(
-    std::vector<std::string> const& raster_paths);
+    std::vector<std::string> const& raster_paths,
+    bool use_raster_tiles = false);
 } // end namespace FileIO
@@ -11,11 +11,17 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
-#include <map>
-#include <type_traits>
+#include <limits>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <unordered_map>
 #include <vector>
 
+#include "BaseLib/Algorithm.h"
 #include "BaseLib/FileTools.h"
 #include "MeshLib/Elements/Element.h"
 #include "MeshLib/Elements/Hex.h"
@@ -59,218 +65,737 @@ bool isGMSHMeshFile(const std::string& fname)
     return false;
 }
 
-void readNodeIDs(std::ifstream& in, unsigned n_nodes,
-                 std::vector<unsigned>& node_ids,
-                 std::map<unsigned, unsigned> const& id_map)
+namespace
 {
-    unsigned idx;
-    for (unsigned i = 0; i < n_nodes; i++)
+/// Maps gmsh node tags to the indices of the nodes.
+class NodeTagMap
+{
+public:
+    static constexpr std::size_t invalid =
+        std::numeric_limits<std::size_t>::max();
+
+    explicit NodeTagMap(std::span<std::size_t const> const tags)
+    {
+        std::size_t const max_tag =
+            tags.empty() ? 0 : *std::max_element(tags.begin(), tags.end());
+        // Gmsh numbers the nodes almost contiguously, so usually a plain
+        // vector can be used for the lookup.
+        if (max_tag <= 2 * tags.size() + 1024)
+        {
+            _dense.assign(max_tag + 1, invalid);
+            for (std::size_t i = 0; i < tags.size(); ++i)
+            {
+                _dense[tags[i]] = i;
+            }
+            return;
+        }
+        _sparse.reserve(tags.size());
+        for (std::size_t i = 0; i < tags.size(); ++i)
+        {
+            _sparse.emplace(tags[i], i);
+        }
+    }
+
+    /// Returns the node index or \c invalid for unknown tags.
+    std::size_t operator()(std::size_t const tag) const
     {
-        in >> idx;
-        node_ids.push_back(id_map.at(idx));
+        if (!_dense.empty())
+        {
+            return tag < _dense.size() ? _dense[tag] : invalid;
+        }
+        auto const it = _sparse.find(tag);
+        return it == _sparse.end() ? invalid : it->second;
     }
+
+private:
+    std::vector<std::size_t> _dense;
+    std::unordered_map<std::size_t, std::size_t> _sparse;
+};
+
+template <typename ElementType, std::size_t N>
+MeshLib::Element* createReorderedElement(
+    std::span<std::size_t const> const node_ids,
+    std::vector<MeshLib::Node*> const& nodes,
+    std::array<int, N> const& node_order)
+{
+    static_assert(N == ElementType::n_all_nodes);
+    std::array<MeshLib::Node*, ElementType::n_all_nodes> element_nodes;
+
+    std::transform(begin(node_order), end(node_order), begin(element_nodes),
+                   [&node_ids, &nodes](auto const id)
+                   { return nodes[node_ids[id]]; });
+
+    return new ElementType(element_nodes);
 }
 
 template <typename ElementType>
-std::pair<MeshLib::Element*, int> createElement(
-    std::ifstream& in, std::vector<MeshLib::Node*> const& nodes,
-    int const mat_id, std::map<unsigned, unsigned> const& id_map)
+MeshLib::Element* createElement(std::span<std::size_t const> const node_ids,
+                                std::vector<MeshLib::Node*> const& nodes)
 {
-    std::vector<unsigned> node_ids;
-    readNodeIDs(in, ElementType::n_all_nodes, node_ids, id_map);
-
     std::array<MeshLib::Node*, ElementType::n_all_nodes> element_nodes;
 
     std::transform(begin(node_ids), end(node_ids), begin(element_nodes),
                    [&nodes](auto const id) { return nodes[id]; });
 
-    return std::make_pair(new ElementType(element_nodes), mat_id);
+    return new ElementType(element_nodes);
 }
 
 template <>
-std::pair<MeshLib::Element*, int> createElement<MeshLib::Tri>(
-    std::ifstream& in, std::vector<MeshLib::Node*> const& nodes,
-    int const mat_id, std::map<unsigned, unsigned> const& id_map)
+MeshLib::Element* createElement<MeshLib::Tri>(
+    std::span<std::size_t const> const node_ids,
+    std::vector<MeshLib::Node*> const& nodes)
 {
-    std::vector<unsigned> node_ids;
-    readNodeIDs(in, 3, node_ids, id_map);
+    return createReorderedElement<MeshLib::Tri>(node_ids, nodes,
+                                                std::array{2, 1, 0});
+}
 
-    std::array<MeshLib::Node*, 3> element_nodes;
+template <>
+MeshLib::Element* createElement<MeshLib::Tet10>(
+    std::span<std::size_t const> const node_ids,
+    std::vector<MeshLib::Node*> const& nodes)
+{
+    return createReorderedElement<MeshLib::Tet10>(
+        node_ids, nodes, std::array{0, 1, 2, 3, 4, 5, 6, 7, 9, 8});
+}
 
-    std::transform(std::rbegin(node_ids), std::rend(node_ids),
-                   begin(element_nodes),
-                   [&nodes](auto const id) { return nodes[id]; });
+template <>
+MeshLib::Element* createElement<MeshLib::Hex20>(
+    std::span<std::size_t const> const node_ids,
+    std::vector<MeshLib::Node*> const& nodes)
+{
+    constexpr std::array node_order = {0,  1, 2,  3,  4,  5,  6,  7,  8,  11,
+                                       13, 9, 16, 18, 19, 17, 10, 12, 14, 15};
+    return createReorderedElement<MeshLib::Hex20>(node_ids, nodes, node_order);
+}
 
-    return std::make_pair(new MeshLib::Tri(element_nodes), mat_id);
+template <>
+MeshLib::Element* createElement<MeshLib::Prism15>(
+    std::span<std::size_t const> const node_ids,
+    std::vector<MeshLib::Node*> const& nodes)
+{
+    constexpr std::array node_order = {0, 1,  2,  3,  4, 5,  6, 9,
+                                       7, 12, 14, 13, 8, 10, 11};
+    return createReorderedElement<MeshLib::Prism15>(node_ids, nodes,
+                                                    node_order);
 }
 
 template <>
-std::pair<MeshLib::Element*, int> createElement<MeshLib::Tet10>(
-    std::ifstream& in, std::vector<MeshLib::Node*> const& nodes,
-    int const mat_id, std::map<unsigned, unsigned> const& id_map)
+MeshLib::Element* createElement<MeshLib::Pyramid13>(
+    std::span<std::size_t const> const node_ids,
+    std::vector<MeshLib::Node*> const& nodes)
+{
+    constexpr std::array node_order = {0,  1, 2, 3, 4,  5, 8,
+                                       10, 6, 7, 9, 11, 12};
+    return createReorderedElement<MeshLib::Pyramid13>(node_ids, nodes,
+                                                      node_order);
+}
+
+/// Number of nodes and the factory of a gmsh element type.
+struct GmshElementType
 {
-    std::vector<unsigned> node_ids;
-    readNodeIDs(in, MeshLib::Tet10::n_all_nodes, node_ids, id_map);
+    unsigned n_nodes;
+    /// Null for element types which are not converted, i.e., points.
+    MeshLib::Element* (*create)(std::span<std::size_t const>,
+                                std::vector<MeshLib::Node*> const&);
+};
 
-    std::swap(node_ids[8], node_ids[9]);
+/// The maximum number of nodes of the supported element types (Hex20).
+constexpr unsigned max_element_nodes = 20;
 
-    std::array<MeshLib::Node*, MeshLib::Tet10::n_all_nodes> element_nodes;
+template <typename ElementType>
+GmshElementType makeGmshElementType()
+{
+    return {ElementType::n_all_nodes, &createElement<ElementType>};
+}
 
-    std::transform(begin(node_ids), end(node_ids), begin(element_nodes),
-                   [&nodes](auto const id) { return nodes[id]; });
+std::optional<GmshElementType> getGmshElementType(int const type)
+{
+    switch (type)
+    {
+        case 1:
+            return makeGmshElementType<MeshLib::Line>();
+        case 2:
+            return makeGmshElementType<MeshLib::Tri>();
+        case 3:
+            return makeGmshElementType<MeshLib::Quad>();
+        case 4:
+            return makeGmshElementType<MeshLib::Tet>();
+        case 5:
+            return makeGmshElementType<MeshLib::Hex>();
+        case 6:
+            return makeGmshElementType<MeshLib::Prism>();
+        case 7:
+            return makeGmshElementType<MeshLib::Pyramid>();
+        case 8:  // 3-node second order line.
+            return makeGmshElementType<MeshLib::Line3>();
+        case 9:  // 6-node second order triangle.
+            return makeGmshElementType<MeshLib::Tri6>();
+        case 10:  // 9-node second order quadrangle.
+            return makeGmshElementType<MeshLib::Quad9>();
+        case 11:  // 10-node second order tetrahedron.
+            return makeGmshElementType<MeshLib::Tet10>();
+        case 15:  // 1-node point, not converted.
+            return GmshElementType{1, nullptr};
+        case 16:  // 8-node second order quadrangle.
+            return makeGmshElementType<MeshLib::Quad8>();
+        case 17:  // 20-node second order hexahedron.
+            return makeGmshElementType<MeshLib::Hex20>();
+        case 18:  // 15-node second order prism.
+            return makeGmshElementType<MeshLib::Prism15>();
+        case 19:  // 13-node second order pyramid.
+            return makeGmshElementType<MeshLib::Pyramid13>();
+        default:
+            return std::nullopt;
+    }
+}
 
-    return std::make_pair(new MeshLib::Tet10(element_nodes), mat_id);
+/// Number of nodes of the gmsh element types up to the 11-node line, also of
+/// those not supported by getGmshElementType(). The binary file formats need it
+/// to skip blocks of unsupported elements. Zero marks the polygons and
+/// polyhedra, whose number of nodes is not fixed.
+std::optional<unsigned> getGmshElementNumberOfNodes(int const type)
+{
+    constexpr std::array<unsigned, 67> number_of_nodes = {
+        0,   2,   3,   4,   4,   8,   6,   5,   3,   6,   // 0-9
+        9,   10,  27,  18,  14,  1,   8,   20,  15,  13,  // 10-19
+        9,   10,  12,  15,  15,  21,  4,   5,   6,   20,  // 20-29
+        35,  56,  22,  28,  0,   0,   16,  25,  36,  12,  // 30-39
+        16,  20,  28,  36,  45,  55,  66,  49,  64,  81,  // 40-49
+        100, 121, 18,  21,  24,  27,  30,  24,  28,  32,  // 50-59
+        36,  40,  7,   8,   9,   10,  11};                // 60-66
+    if (type < 0 || type >= static_cast<int>(number_of_nodes.size()) ||
+        number_of_nodes[type] == 0)
+    {
+        return std::nullopt;
+    }
+    return number_of_nodes[type];
 }
 
-template <>
-std::pair<MeshLib::Element*, int> createElement<MeshLib::Hex20>(
-    std::ifstream& in, std::vector<MeshLib::Node*> const& nodes,
-    int const mat_id, std::map<unsigned, unsigned> const& id_map)
+/// Reads the values of the node and element sections, which are stored
+/// either as text or as raw binary data in the byte order of the reading
+/// machine.
+class DataReader
 {
-    std::vector<unsigned> node_ids;
-    readNodeIDs(in, MeshLib::Hex20::n_all_nodes, node_ids, id_map);
+public:
+    DataReader(std::istream& in, bool const binary,
+               std::size_t const size_t_size)
+        : _in(in), _binary(binary), _size_t_size(size_t_size)
+    {
+    }
+
+    template <typename T>
+    void read(std::span<T> const values)
+    {
+        if (_binary)
+        {
+            _in.read(reinterpret_cast<char*>(values.data()),
+                     static_cast<std::streamsize>(values.size_bytes()));
+            return;
+        }
+        for (auto& value : values)
+        {
+            _in >> value;
+        }
+    }
 
-    std::array<MeshLib::Node*, MeshLib::Hex20::n_all_nodes> element_nodes;
+    template <typename T>
+    T read()
+    {
+        T value{};
+        read(std::span<T>(&value, 1));
+        return value;
+    }
 
-    constexpr std::array node_order = {0,  1, 2,  3,  4,  5,  6,  7,  8,  11,
-                                       13, 9, 16, 18, 19, 17, 10, 12, 14, 15};
+    /// Reads values of type size_t, which are stored with the size_t size of
+    /// the writing machine in binary files of version 4.1.
+    void readSizes(std::span<std::size_t> const values)
+    {
+        if (!_binary || _size_t_size == sizeof(std::size_t))
+        {
+            read(values);
+        }
+        else if (_size_t_size == sizeof(std::uint32_t))
+        {
+            readConverted<std::uint32_t>(values);
+        }
+        else
+        {
+            readConverted<std::uint64_t>(values);
+        }
+    }
 
-    std::transform(begin(node_order), end(node_order), begin(element_nodes),
-                   [&node_ids, &nodes](auto const id)
-                   { return nodes[node_ids[id]]; });
+    std::size_t readSize()
+    {
+        std::size_t value = 0;
+        readSizes(std::span<std::size_t>(&value, 1));
+        return value;
+    }
+
+    bool good() const { return static_cast<bool>(_in); }
+
+private:
+    template <typename StoredType>
+    void readConverted(std::span<std::size_t> const values)
+    {
+        std::vector<StoredType> buffer(values.size());
+        read(std::span<StoredType>(buffer));
+        std::copy(buffer.begin(), buffer.end(), values.begin());
+    }
 
-    return std::make_pair(new MeshLib::Hex20(element_nodes), mat_id);
+    std::istream& _in;
+    bool const _binary;
+    std::size_t const _size_t_size;
+};
+
+void removeTrailingWhitespace(std::string& line)
+{
+    line.erase(line.find_last_not_of(" \t\r") + 1);
 }
 
-template <>
-std::pair<MeshLib::Element*, int> createElement<MeshLib::Prism15>(
-    std::ifstream& in, std::vector<MeshLib::Node*> const& nodes,
-    int const mat_id, std::map<unsigned, unsigned> const& id_map)
+/// Reads lines up to and including the end keyword of the given section.
+bool skipSection(std::istream& in, std::string const& section_name)
 {
-    std::vector<unsigned> node_ids;
-    readNodeIDs(in, MeshLib::Prism15::n_all_nodes, node_ids, id_map);
+    std::string const end_keyword = "$End" + section_name;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        removeTrailingWhitespace(line);
+        if (line == end_keyword)
+        {
+            return true;
+        }
+    }
+    ERR("readGMSHMesh(): Could not find {:s}.", end_keyword);
+    return false;
+}
 
-    std::array<MeshLib::Node*, MeshLib::Prism15::n_all_nodes> element_nodes;
+/// Reads the number in the first line of a section of a version 2.2 file.
+std::optional<std::size_t> readCountLine(std::istream& in)
+{
+    std::string line;
+    std::size_t count;
+    if (!std::getline(in, line) || !(std::istringstream(line) >> count))
+    {
+        return std::nullopt;
+    }
+    return count;
+}
 
-    constexpr std::array node_order = {0, 1,  2,  3,  4, 5,  6, 9,
-                                       7, 12, 14, 13, 8, 10, 11};
+/// Creates the nodes from consecutive x, y, z coordinates.
+void createNodes(std::span<double const> const coordinates,
+                 std::vector<MeshLib::Node*>& nodes,
+                 [[maybe_unused]] int const number_of_threads)
+{
+    auto const n_nodes = static_cast<std::ptrdiff_t>(coordinates.size() / 3);
+    nodes.resize(n_nodes);
+    // The loop variable is signed as required by OpenMP 2.0 (MSVC).
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(number_of_threads)
+#endif
+    for (std::ptrdiff_t i = 0; i < n_nodes; ++i)
+    {
+        nodes[i] = new MeshLib::Node(coordinates[3 * i], coordinates[3 * i + 1],
+                                     coordinates[3 * i + 2], i);
+    }
+}
 
-    std::transform(begin(node_order), end(node_order), begin(element_nodes),
-                   [&node_ids, &nodes](auto const id)
-                   { return nodes[node_ids[id]]; });
+/// Creates the elements of a single type from their node tags, which are
+/// stored consecutively for each element, and appends them to the given
+/// elements. Returns false if a node tag is unknown.
+bool createElements(GmshElementType const& type,
+                    std::span<std::size_t const> const node_tags,
+                    NodeTagMap const& node_tag_map,
+                    std::vector<MeshLib::Node*> const& nodes,
+                    std::vector<MeshLib::Element*>& elements,
+                    [[maybe_unused]] int const number_of_threads)
+{
+    auto const n_elements =
+        static_cast<std::ptrdiff_t>(node_tags.size() / type.n_nodes);
+    auto const offset = elements.size();
+    elements.resize(offset + n_elements, nullptr);
+
+    std::ptrdiff_t n_invalid_elements = 0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(number_of_threads) \
+    reduction(+ : n_invalid_elements)
+#endif
+    for (std::ptrdiff_t e = 0; e < n_elements; ++e)
+    {
+        std::array<std::size_t, max_element_nodes> node_ids;
+        auto const element_node_tags =
+            node_tags.subspan(e * type.n_nodes, type.n_nodes);
+        std::transform(element_node_tags.begin(), element_node_tags.end(),
+                       node_ids.begin(),
+                       [&node_tag_map](auto const tag)
+                       { return node_tag_map(tag); });
+        auto const element_node_ids =
+            std::span<std::size_t const>(node_ids.data(), type.n_nodes);
+        if (std::find(element_node_ids.begin(), element_node_ids.end(),
+                      NodeTagMap::invalid) != element_node_ids.end())
+        {
+            ++n_invalid_elements;
+            continue;
+        }
+        elements[offset + e] = type.create(element_node_ids, nodes);
+    }
 
-    return std::make_pair(new MeshLib::Prism15(element_nodes), mat_id);
+    if (n_invalid_elements > 0)
+    {
+        ERR("readGMSHMesh(): {:d} elements refer to unknown nodes.",
+            n_invalid_elements);
+        return false;
+    }
+    return true;
 }
 
-template <>
-std::pair<MeshLib::Element*, int> createElement<MeshLib::Pyramid13>(
-    std::ifstream& in, std::vector<MeshLib::Node*> const& nodes,
-    int const mat_id, std::map<unsigned, unsigned> const& id_map)
+/// Reads the nodes section of a version 2.2 file: per node the tag and the
+/// coordinates.
+bool readNodesV2(std::istream& in, bool const binary,
+                 std::vector<std::size_t>& tags,
+                 std::vector<double>& coordinates)
 {
-    std::vector<unsigned> node_ids;
-    readNodeIDs(in, MeshLib::Pyramid13::n_all_nodes, node_ids, id_map);
-    std::array<MeshLib::Node*, MeshLib::Pyramid13::n_all_nodes> element_nodes;
+    auto const n_nodes = readCountLine(in);
+    if (!n_nodes)
+    {
+        return false;
+    }
+    tags.resize(*n_nodes);
+    coordinates.resize(3 * *n_nodes);
 
-    constexpr std::array node_order = {0,  1, 2, 3, 4,  5, 8,
-                                       10, 6, 7, 9, 11, 12};
+    if (!binary)
+    {
+        for (std::size_t i = 0; i < *n_nodes; ++i)
+        {
+            in >> tags[i] >> coordinates[3 * i] >> coordinates[3 * i + 1] >>
+                coordinates[3 * i + 2];
+        }
+        return static_cast<bool>(in);
+    }
 
-    std::transform(begin(node_order), end(node_order), begin(element_nodes),
-                   [&node_ids, &nodes](auto const id)
-                   { return nodes[node_ids[id]]; });
+    // Each node is stored as an int tag followed by three doubles.
+    constexpr std::size_t node_size = sizeof(int) + 3 * sizeof(double);
+    std::vector<char> buffer(*n_nodes * node_size);
+    in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    for (std::size_t i = 0; i < *n_nodes; ++i)
+    {
+        char const* const node = buffer.data() + i * node_size;
+        int tag;
+        std::memcpy(&tag, node, sizeof(int));
+        tags[i] = tag;
+        std::memcpy(&coordinates[3 * i], node + sizeof(int),
+                    3 * sizeof(double));
+    }
+    return static_cast<bool>(in);
+}
+
+/// Reads the nodes section of a version 4.1 file, which is organized in
+/// blocks of nodes per entity. Each block stores the node tags followed by
+/// the coordinates.
+bool readNodesV4(DataReader& reader, std::vector<std::size_t>& tags,
+                 std::vector<double>& coordinates)
+{
+    auto const n_blocks = reader.readSize();
+    auto const n_nodes = reader.readSize();
+    reader.readSize();  // minimum node tag
+    reader.readSize();  // maximum node tag
+    if (!reader.good())
+    {
+        return false;
+    }
+    tags.resize(n_nodes);
+    coordinates.resize(3 * n_nodes);
+
+    std::vector<double> parametric_coordinates;
+    std::size_t offset = 0;
+    for (std::size_t b = 0; b < n_blocks; ++b)
+    {
+        auto const entity_dim = reader.read<int>();
+        reader.read<int>();  // entity tag
+        auto const parametric = reader.read<int>();
+        auto const n_block_nodes = reader.readSize();
+        if (!reader.good() || offset + n_block_nodes > n_nodes)
+        {
+            return false;
+        }
 
-    return std::make_pair(new MeshLib::Pyramid13(element_nodes), mat_id);
+        reader.readSizes(std::span(tags).subspan(offset, n_block_nodes));
+        auto const block_coordinates =
+            std::span(coordinates).subspan(3 * offset, 3 * n_block_nodes);
+        if (parametric == 0)
+        {
+            reader.read(block_coordinates);
+        }
+        else
+        {
+            // The coordinates are followed by entity_dim parametric
+            // coordinates, which are dropped.
+            std::size_t const stride = 3 + entity_dim;
+            parametric_coordinates.resize(stride * n_block_nodes);
+            reader.read(std::span(parametric_coordinates));
+            for (std::size_t i = 0; i < n_block_nodes; ++i)
+            {
+                std::copy_n(&parametric_coordinates[stride * i], 3,
+                            &block_coordinates[3 * i]);
+            }
+        }
+        offset += n_block_nodes;
+    }
+    return reader.good() && offset == n_nodes;
 }
 
-std::pair<MeshLib::Element*, int> readElement(
-    std::ifstream& in, std::vector<MeshLib::Node*> const& nodes,
-    std::map<unsigned, unsigned> const& id_map)
+/// The material id of an element of a version 2.2 file is its second tag,
+/// the elementary entity.
+int materialIDFromTags(std::span<int const> const tags)
 {
-    unsigned idx;
-    unsigned type;
-    unsigned n_tags;
-    unsigned dummy;
-    int mat_id;
+    if (tags.size() > 1)
+    {
+        return tags[1];
+    }
+    return tags.empty() ? 0 : tags[0];
+}
 
-    // element format is structured like this:
-    // element-id element-type n-tags physical-entity elementary entity node-ids
-    in >> idx >> type >> n_tags >> dummy >> mat_id;
+/// Reads the elements section of a version 2.2 ASCII file, one element per
+/// line. Consecutive elements of the same type are created together.
+bool readElementsV2ASCII(std::istream& in, NodeTagMap const& node_tag_map,
+                         std::vector<MeshLib::Node*> const& nodes,
+                         std::vector<MeshLib::Element*>& elements,
+                         std::vector<int>& materials,
+                         int const number_of_threads)
+{
+    auto const n_elements = readCountLine(in);
+    if (!n_elements)
+    {
+        ERR("Read GMSH mesh does not contain any elements");
+        return false;
+    }
+    elements.reserve(*n_elements);
+    materials.reserve(*n_elements);
 
-    switch (type)
+    int block_type = -1;
+    std::vector<std::size_t> block_node_tags;
+    auto const create_block_elements = [&]()
     {
-        case 1:
+        if (block_node_tags.empty())
         {
-            return createElement<MeshLib::Line>(in, nodes, mat_id, id_map);
+            return true;
         }
-        case 2:
+        bool const success = createElements(
+            *getGmshElementType(block_type), block_node_tags, node_tag_map,
+            nodes, elements, number_of_threads);
+        block_node_tags.clear();
+        return success;
+    };
+
+    std::vector<int> tags;
+    std::string rest_of_line;
+    for (std::size_t i = 0; i < *n_elements; i++)
+    {
+        // element format is structured like this:
+        // element-id element-type n-tags tags node-ids
+        std::size_t id;
+        int type;
+        std::size_t n_tags;
+        if (!(in >> id >> type >> n_tags))
         {
-            return createElement<MeshLib::Tri>(in, nodes, mat_id, id_map);
+            return false;
         }
-        case 3:
+        tags.resize(n_tags);
+        for (auto& tag : tags)
         {
-            return createElement<MeshLib::Quad>(in, nodes, mat_id, id_map);
+            in >> tag;
         }
-        case 4:
+
+        auto const element_type = getGmshElementType(type);
+        if (!element_type)
         {
-            return createElement<MeshLib::Tet>(in, nodes, mat_id, id_map);
+            WARN("readGMSHMesh(): Unknown element type {:d}.", type);
+            std::getline(in, rest_of_line);
+            continue;
         }
-        case 5:
+        if (!element_type->create)
         {
-            return createElement<MeshLib::Hex>(in, nodes, mat_id, id_map);
+            std::getline(in, rest_of_line);
+            continue;
         }
-        case 6:
+
+        if (type != block_type)
         {
-            return createElement<MeshLib::Prism>(in, nodes, mat_id, id_map);
+            if (!create_block_elements())
+            {
+                return false;
+            }
+            block_type = type;
         }
-        case 7:
+        for (unsigned k = 0; k < element_type->n_nodes; ++k)
         {
-            return createElement<MeshLib::Pyramid>(in, nodes, mat_id, id_map);
+            std::size_t node_tag;
+            in >> node_tag;
+            block_node_tags.push_back(node_tag);
         }
-        case 8:  // 3-node second order line.
+        materials.push_back(materialIDFromTags(tags));
+    }
+    return in && create_block_elements();
+}
+
+/// Reads the elements section of a version 2.2 binary file, which is
+/// organized in blocks of elements of the same type.
+bool readElementsV2Binary(std::istream& in, NodeTagMap const& node_tag_map,
+                          std::vector<MeshLib::Node*> const& nodes,
+                          std::vector<MeshLib::Element*>& elements,
+                          std::vector<int>& materials,
+                          int const number_of_threads)
+{
+    auto const n_elements = readCountLine(in);
+    if (!n_elements)
+    {
+        ERR("Read GMSH mesh does not contain any elements");
+        return false;
+    }
+    elements.reserve(*n_elements);
+    materials.reserve(*n_elements);
+
+    std::vector<int> data;
+    std::vector<std::size_t> node_tags;
+    for (std::size_t n_read = 0; n_read < *n_elements;)
+    {
+        // Block header: element-type n-elements-following n-tags
+        std::array<int, 3> header;
+        in.read(reinterpret_cast<char*>(header.data()), sizeof(header));
+        auto const [type, n_block_elements, n_tags] = header;
+        if (!in || n_block_elements < 0 || n_tags < 0)
         {
-            return createElement<MeshLib::Line3>(in, nodes, mat_id, id_map);
+            return false;
         }
-        case 9:  // 6-node second order triangle.
+        auto const n_nodes = getGmshElementNumberOfNodes(type);
+        if (!n_nodes)
         {
-            return createElement<MeshLib::Tri6>(in, nodes, mat_id, id_map);
+            ERR("readGMSHMesh(): Unknown element type {:d}.", type);
+            return false;
         }
-        case 10:  // 9-node second order quadrangle.
+
+        // Each element: element-id tags node-ids
+        std::size_t const n_values = 1 + n_tags + *n_nodes;
+        data.resize(n_block_elements * n_values);
+        in.read(reinterpret_cast<char*>(data.data()),
+                static_cast<std::streamsize>(data.size() * sizeof(int)));
+        if (!in)
         {
-            return createElement<MeshLib::Quad9>(in, nodes, mat_id, id_map);
+            return false;
         }
-        case 11:  // 10-node second order tetrahedron.
+        n_read += n_block_elements;
+        auto const element_type = getGmshElementType(type);
+        if (!element_type)
         {
-            return createElement<MeshLib::Tet10>(in, nodes, mat_id, id_map);
+            WARN("readGMSHMesh(): Skipping {:d} elements of unsupported type "
+                 "{:d}.",
+                 n_block_elements, type);
+            continue;
         }
-        case 16:  // 8-node second order quadrangle.
+        if (!element_type->create)
         {
-            return createElement<MeshLib::Quad8>(in, nodes, mat_id, id_map);
+            continue;
         }
-        case 17:  // 20-node second order hexahedron.
+
+        node_tags.resize(n_block_elements * element_type->n_nodes);
+        for (int e = 0; e < n_block_elements; ++e)
         {
-            return createElement<MeshLib::Hex20>(in, nodes, mat_id, id_map);
+            auto const element =
+                std::span(data).subspan(e * n_values, n_values);
+            materials.push_back(
+                materialIDFromTags(element.subspan(1, n_tags)));
+            std::copy(element.begin() + 1 + n_tags, element.end(),
+                      node_tags.begin() + e * element_type->n_nodes);
         }
-        case 18:  // 15-node second order prism.
+        if (!createElements(*element_type, node_tags, node_tag_map, nodes,
+                            elements, number_of_threads))
         {
-            return createElement<MeshLib::Prism15>(in, nodes, mat_id, id_map);
+            return false;
         }
-        case 19:  // 13-node second order pyramid.
+    }
+    return true;
+}
+
+/// Reads the elements section of a version 4.1 file, which is organized in
+/// blocks of elements of the same type per entity. The entity tag is used as
+/// material id.
+bool readElementsV4(DataReader& reader, NodeTagMap const& node_tag_map,
+                    std::vector<MeshLib::Node*> const& nodes,
+                    std::vector<MeshLib::Element*>& elements,
+                    std::vector<int>& materials, int const number_of_threads)
+{
+    auto const n_blocks = reader.readSize();
+    auto const n_elements = reader.readSize();
+    reader.readSize();  // minimum element tag
+    reader.readSize();  // maximum element tag
+    if (!reader.good())
+    {
+        return false;
+    }
+    elements.reserve(n_elements);
+    materials.reserve(n_elements);
+
+    std::vector<std::size_t> data;
+    for (std::size_t b = 0; b < n_blocks; ++b)
+    {
+        reader.read<int>();  // entity dimension
+        auto const entity_tag = reader.read<int>();
+        auto const type = reader.read<int>();
+        auto const n_block_elements = reader.readSize();
+        if (!reader.good())
         {
-            return createElement<MeshLib::Pyramid13>(in, nodes, mat_id, id_map);
+            return false;
+        }
+        auto const n_nodes = getGmshElementNumberOfNodes(type);
+        if (!n_nodes)
+        {
+            ERR("readGMSHMesh(): Unknown element type {:d}.", type);
+            return false;
+        }
+
+        // Each element: element-tag node-tags
+        std::size_t const n_values = 1 + *n_nodes;
+        data.resize(n_block_elements * n_values);
+        reader.readSizes(data);
+        if (!reader.good())
+        {
+            return false;
+        }
+        auto const element_type = getGmshElementType(type);
+        if (!element_type)
+        {
+            WARN("readGMSHMesh(): Skipping {:d} elements of unsupported type "
+                 "{:d}.",
+                 n_block_elements, type);
+            continue;
+        }
+        if (!element_type->create)
+        {
+            continue;
+        }
+
+        // Drop the element tags in place, keeping the node tags only.
+        for (std::size_t e = 0; e < n_block_elements; ++e)
+        {
+            std::copy_n(data.begin() + e * n_values + 1, element_type->n_nodes,
+                        data.begin() + e * element_type->n_nodes);
+        }
+        data.resize(n_block_elements * element_type->n_nodes);
+        materials.insert(materials.end(), n_block_elements, entity_tag);
+        if (!createElements(*element_type, data, node_tag_map, nodes, elements,
+                            number_of_threads))
+        {
+            return false;
         }
-        case 15:
-            in >> dummy;  // skip rest of line
-            break;
-        default:
-            WARN("readGMSHMesh(): Unknown element type {:d}.", type);
-            break;
     }
-    return std::make_pair(nullptr, -1);
+    return true;
 }
+}  // namespace
 
-MeshLib::Mesh* readGMSHMesh(std::string const& fname)
+MeshLib::Mesh* readGMSHMesh(std::string const& fname,
+                            int const number_of_threads)
 {
     std::string line;
-    std::ifstream in(fname.c_str(), std::ios::in);
+    std::ifstream in(fname.c_str(), std::ios::in | std::ios::binary);
     if (!in.is_open())
     {
         WARN("readGMSHMesh() - Could not open file {:s}.", fname);
@@ -286,88 +811,123 @@ MeshLib::Mesh* readGMSHMesh(std::string const& fname)
     }
 
     getline(in, line);  // version-number file-type data-size
-    if (line.substr(0, 3) != "2.2")
+    std::string version;
+    int file_type = 0;
+    std::size_t data_size = 0;
+    std::istringstream(line) >> version >> file_type >> data_size;
+    if (version != "2.2" && version != "4.1")
     {
-        WARN("Wrong gmsh file format version '{:s}'.", line.substr(0, 3));
+        WARN(
+            "Wrong gmsh file format version '{:s}'. Supported versions are 2.2 "
+            "and 4.1.",
+            version);
         return nullptr;
     }
+    bool const is_version_2 = version == "2.2";
 
-    if (line[4] != '0')
+    bool const binary = file_type == 1;
+    if (binary)
+    {
+        bool const is_supported_data_size =
+            is_version_2 ? data_size == sizeof(double)
+                         : data_size == sizeof(std::uint32_t) ||
+                               data_size == sizeof(std::uint64_t);
+        if (!is_supported_data_size)
+        {
+            WARN("Unsupported data size {:d} of gmsh binary file.", data_size);
+            return nullptr;
+        }
+        // The integer 1 written in the byte order of the writing machine.
+        int one = 0;
+        in.read(reinterpret_cast<char*>(&one), sizeof(one));
+        if (one != 1)
+        {
+            WARN(
+                "Reading gmsh binary files of different byte order is not "
+                "supported.");
+            return nullptr;
+        }
+    }
+    if (!skipSection(in, "MeshFormat"))
     {
-        WARN("Currently reading gmsh binary file type is not supported.");
         return nullptr;
     }
-    getline(in, line);  //$EndMeshFormat
 
+    DataReader reader(in, binary, data_size);
     std::vector<MeshLib::Node*> nodes;
     std::vector<MeshLib::Element*> elements;
     std::vector<int> materials;
-    std::map<unsigned, unsigned> id_map;
-    while (line.find("$EndElements") == std::string::npos)
-    {
-        // Node data
-        getline(in, line);  //$Nodes Keywords
-        if (line.find("$Nodes") != std::string::npos)
-        {
-            std::size_t n_nodes(0);
-            long id;
-            double x;
-            double y;
-            double z;
-            in >> n_nodes >> std::ws;
-            nodes.resize(n_nodes);
-            for (std::size_t i = 0; i < n_nodes; i++)
+    std::optional<NodeTagMap> node_tag_map;
+    bool success = true;
+    while (success && getline(in, line))
+    {
+        removeTrailingWhitespace(line);
+        if (line == "$Nodes")
+        {
+            if (node_tag_map)
+            {
+                ERR("readGMSHMesh(): Only a single nodes section is "
+                    "supported.");
+                success = false;
+                break;
+            }
+            std::vector<std::size_t> tags;
+            std::vector<double> coordinates;
+            success = is_version_2 ? readNodesV2(in, binary, tags, coordinates)
+                                   : readNodesV4(reader, tags, coordinates);
+            if (success)
             {
-                in >> id >> x >> y >> z >> std::ws;
-                id_map.insert(std::map<unsigned, unsigned>::value_type(id, i));
-                nodes[i] = new MeshLib::Node(x, y, z, id);
+                createNodes(coordinates, nodes, number_of_threads);
+                node_tag_map.emplace(tags);
             }
-            getline(in, line);  // End Node keyword $EndNodes
         }
-
-        // Element data
-        if (line.find("$Elements") != std::string::npos)
+        else if (line == "$Elements")
         {
-            std::size_t n_elements(0);
-            if (!(in >> n_elements >> std::ws))
-            {  // number-of-elements
-                ERR("Read GMSH mesh does not contain any elements");
+            if (!node_tag_map)
+            {
+                ERR("readGMSHMesh(): The elements precede the nodes.");
+                success = false;
+                break;
+            }
+            if (is_version_2)
+            {
+                success = binary ? readElementsV2Binary(
+                                       in, *node_tag_map, nodes, elements,
+                                       materials, number_of_threads)
+                                 : readElementsV2ASCII(
+                                       in, *node_tag_map, nodes, elements,
+                                       materials, number_of_threads);
             }
-            elements.reserve(n_elements);
-            materials.reserve(n_elements);
-            for (std::size_t i = 0; i < n_elements; i++)
+            else
             {
-                MeshLib::Element* elem(nullptr);
-                int mat_id(0);
-                std::tie(elem, mat_id) = readElement(in, nodes, id_map);
-
-                if (elem)
-                {
-                    elements.push_back(elem);
-                    materials.push_back(mat_id);
-                }
+                success = readElementsV4(reader, *node_tag_map, nodes,
+                                         elements, materials,
+                                         number_of_threads);
             }
-            getline(in, line);  // END keyword
+        }
+        else if (line.starts_with('$'))
+        {
+            // Sections like $PhysicalNames or $Entities are not needed.
+            success = skipSection(in, line.substr(1));
+            continue;
+        }
+        else
+        {
+            continue;
         }
 
-        if (line.find("PhysicalNames") != std::string::npos)
+        if (!success)
         {
-            std::size_t n_lines(0);
-            in >> n_lines >> std::ws;  // number-of-lines
-            for (std::size_t i = 0; i < n_lines; i++)
-            {
-                getline(in, line);
-            }
-            getline(in, line);  // END keyword
+            ERR("readGMSHMesh(): Could not read section {:s} of file {:s}.",
+                line, fname);
+            break;
         }
+        success = skipSection(in, line.substr(1));
     }
     in.close();
-    if (elements.empty())
+    if (!success || elements.empty())
     {
-        for (auto& node : nodes)
-        {
-            delete node;
-        }
+        BaseLib::cleanupVectorElements(elements, nodes);
         return nullptr;
     }
 
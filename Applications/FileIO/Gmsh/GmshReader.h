@@ -29,10 +29,15 @@ bool isGMSHMeshFile(const std::string& fname);
 /**
  * reads a mesh created by GMSH - this implementation is based on the former
  * function GMSH2MSH
+ *
+ * Supported are the file format versions 2.2 and 4.1, both ASCII and binary.
  * @param fname the file name of the mesh (including the path)
+ * @param number_of_threads the number of threads used to create the nodes and
+ * elements if OpenMP is available
  * @return
  */
-MeshLib::Mesh* readGMSHMesh(std::string const& fname);
+MeshLib::Mesh* readGMSHMesh(std::string const& fname,
+                            int number_of_threads = 1);
 
 } // end namespace GMSH
 } // end namespace FileIO
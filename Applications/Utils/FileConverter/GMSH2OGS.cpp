@@ -14,6 +14,7 @@
 
 // STL
 #include <algorithm>
+#include <cstdlib>
 #include <string>
 
 // ThirdParty
@@ -125,9 +126,9 @@ static void identifyAndWriteBoundaryMeshes(
 int main(int argc, char* argv[])
 {
     TCLAP::CmdLine cmd(
-        "Converting meshes in gmsh file format (ASCII, version 2.2) to a vtk "
-        "unstructured grid file (new OGS file format) or to the old OGS file "
-        "format - see options.\n\n"
+        "Converting meshes in gmsh file format (ASCII or binary, version 2.2 "
+        "or 4.1) to a vtk unstructured grid file (new OGS file format) or to "
+        "the old OGS file format - see options.\n\n"
         "OpenGeoSys-6 software, version " +
             GitInfoLib::GitInfo::ogs_version +
             ".\n"
@@ -162,8 +163,22 @@ int main(int argc, char* argv[])
         "if set, lines will not be written to the ogs mesh");
     cmd.add(exclude_lines_arg);
 
+    TCLAP::ValueArg<int> threads_arg(
+        "t", "threads",
+        "number of threads used to create the nodes and elements (requires "
+        "OpenMP)",
+        false, 1, "positive integer");
+    cmd.add(threads_arg);
+
     cmd.parse(argc, argv);
 
+    if (threads_arg.getValue() < 1)
+    {
+        ERR("The number of threads must be positive, but {:d} was given.",
+            threads_arg.getValue());
+        return EXIT_FAILURE;
+    }
+
     // *** read mesh
     INFO("Reading {:s}.", gmsh_mesh_arg.getValue());
 #ifndef WIN32
@@ -172,7 +187,8 @@ int main(int argc, char* argv[])
 #endif
     BaseLib::RunTime run_time;
     run_time.start();
-    MeshLib::Mesh* mesh(FileIO::GMSH::readGMSHMesh(gmsh_mesh_arg.getValue()));
+    MeshLib::Mesh* mesh(FileIO::GMSH::readGMSHMesh(gmsh_mesh_arg.getValue(),
+                                                   threads_arg.getValue()));
 
     if (mesh == nullptr)
     {
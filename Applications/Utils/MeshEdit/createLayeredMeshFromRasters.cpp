@@ -46,6 +46,13 @@ int main(int argc, char* argv[])
                                    "Write VTU output in ASCII format.");
     cmd.add(use_ascii_arg);
 
+    TCLAP::SwitchArg raster_tiles_arg(
+        "", "raster-tiles",
+        "Read ASC rasters on demand from tile files instead of loading them "
+        "completely into memory. The tile files are created next to the "
+        "rasters and reused in subsequent runs.");
+    cmd.add(raster_tiles_arg);
+
     double min_thickness(std::numeric_limits<double>::epsilon());
     TCLAP::ValueArg<double> min_thickness_arg(
         "t", "thickness",
@@ -108,7 +115,8 @@ int main(int argc, char* argv[])
     std::reverse(raster_paths.begin(), raster_paths.end());
 
     MeshLib::MeshLayerMapper mapper;
-    if (auto const rasters = FileIO::readRasters(raster_paths))
+    if (auto const rasters =
+            FileIO::readRasters(raster_paths, raster_tiles_arg.getValue()))
     {
         if (!mapper.createLayers(*sfc_mesh, *rasters, min_thickness))
         {
@@ -51,6 +51,13 @@ int main(int argc, char* argv[])
         "n", "node-array", "Assigns raster data to node array (default)");
     cmd.add(set_nodes_arg);
 
+    TCLAP::SwitchArg raster_tiles_arg(
+        "", "raster-tiles",
+        "Read the raster on demand from a tile file instead of loading it "
+        "completely into memory. The tile file is created next to the raster "
+        "and reused in subsequent runs.");
+    cmd.add(raster_tiles_arg);
+
     TCLAP::ValueArg<std::string> array_name_arg(
         "s", "scalar-name", "The name of the newly created scalar array.", true,
         "", "scalar array name");
@@ -87,7 +94,10 @@ int main(int argc, char* argv[])
     }
 
     std::unique_ptr<GeoLib::Raster> const raster(
-        FileIO::AsciiRasterInterface::getRasterFromASCFile(raster_name));
+        raster_tiles_arg.getValue()
+            ? FileIO::AsciiRasterInterface::getTiledRasterFromASCFile(
+                  raster_name)
+            : FileIO::AsciiRasterInterface::getRasterFromASCFile(raster_name));
 
     if (create_node_array)
     {
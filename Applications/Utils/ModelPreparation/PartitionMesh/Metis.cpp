@@ -9,13 +9,111 @@
  *
  */
 
+#include "Metis.h"
+
+#include <metis.h>
+
+#include <algorithm>
+#include <array>
 #include <fstream>
 
 #include "BaseLib/Error.h"
+#include "BaseLib/Logging.h"
 #include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
 
 namespace ApplicationUtils
 {
+std::vector<long> computeNodeWeights(
+    std::vector<MeshLib::Element*> const& elements,
+    std::size_t const number_of_nodes,
+    int const dofs_per_base_node,
+    int const dofs_per_higher_order_node)
+{
+    std::vector<long> node_weights(number_of_nodes, 0);
+    for (const auto* elem : elements)
+    {
+        long const n_nodes = elem->getNumberOfNodes();
+        long const n_base_nodes = elem->getNumberOfBaseNodes();
+        long const n_dofs =
+            n_base_nodes * dofs_per_base_node +
+            (n_nodes - n_base_nodes) * dofs_per_higher_order_node;
+        // At least one, such that no node is left without weight.
+        long const weight_per_node =
+            std::max(1L, (n_dofs * n_dofs + n_nodes - 1) / n_nodes);
+        for (unsigned j = 0; j < elem->getNumberOfNodes(); j++)
+        {
+            node_weights[getNodeIndex(*elem, j)] += weight_per_node;
+        }
+    }
+    return node_weights;
+}
+
+std::vector<std::size_t> partitionNodesWithMetis(
+    MeshLib::Mesh const& mesh,
+    long const number_of_partitions,
+    MetisPartitioningOptions const& options)
+{
+    auto const& elements = mesh.getElements();
+
+    // Element-node connectivity in CSR format. It is the in-memory
+    // equivalent of the file written by writeMETIS().
+    std::vector<idx_t> eptr;
+    eptr.reserve(elements.size() + 1);
+    eptr.push_back(0);
+    for (const auto* elem : elements)
+    {
+        eptr.push_back(eptr.back() + elem->getNumberOfNodes());
+    }
+    std::vector<idx_t> eind;
+    eind.reserve(eptr.back());
+    for (const auto* elem : elements)
+    {
+        for (unsigned j = 0; j < elem->getNumberOfNodes(); j++)
+        {
+            eind.push_back(static_cast<idx_t>(getNodeIndex(*elem, j)));
+        }
+    }
+
+    std::vector<idx_t> node_weights;
+    if (options.weighted_nodes)
+    {
+        auto const weights = computeNodeWeights(
+            elements, mesh.getNumberOfNodes(), options.dofs_per_base_node,
+            options.dofs_per_higher_order_node);
+        node_weights.assign(weights.begin(), weights.end());
+    }
+
+    std::array<idx_t, METIS_NOPTIONS> metis_options;
+    METIS_SetDefaultOptions(metis_options.data());
+    metis_options[METIS_OPTION_NUMBERING] = 0;
+    metis_options[METIS_OPTION_PTYPE] = options.recursive_bisection
+                                            ? METIS_PTYPE_RB
+                                            : METIS_PTYPE_KWAY;
+
+    idx_t number_of_elements = static_cast<idx_t>(elements.size());
+    idx_t number_of_nodes = static_cast<idx_t>(mesh.getNumberOfNodes());
+    idx_t nparts = static_cast<idx_t>(number_of_partitions);
+    idx_t objval = 0;
+    std::vector<idx_t> element_partition_ids(elements.size());
+    std::vector<idx_t> node_partition_ids(mesh.getNumberOfNodes());
+
+    int const status = METIS_PartMeshNodal(
+        &number_of_elements, &number_of_nodes, eptr.data(), eind.data(),
+        node_weights.empty() ? nullptr : node_weights.data(),
+        nullptr /* vsize */, &nparts, nullptr /* tpwgts */,
+        metis_options.data(), &objval, element_partition_ids.data(),
+        node_partition_ids.data());
+    if (status != METIS_OK)
+    {
+        OGS_FATAL("METIS_PartMeshNodal failed with return value {:d}.",
+                  status);
+    }
+    INFO("METIS: edge cut of the nodal graph is {:d}.", objval);
+
+    return {node_partition_ids.begin(), node_partition_ids.end()};
+}
+
 void writeMETIS(std::vector<MeshLib::Element*> const& elements,
                 const std::string& file_name)
 {
@@ -86,13 +184,4 @@ std::vector<std::size_t> readMetisData(const std::string& file_name_base,
 
     return partition_ids;
 }
-
-void removeMetisPartitioningFiles(std::string const& file_name_base,
-                                  long const number_of_partitions)
-{
-    const std::string npartitions_str = std::to_string(number_of_partitions);
-
-    std::remove((file_name_base + ".mesh.npart." + npartitions_str).c_str());
-    std::remove((file_name_base + ".mesh.epart." + npartitions_str).c_str());
-}
 }  // namespace ApplicationUtils
@@ -17,10 +17,45 @@
 namespace MeshLib
 {
 class Element;
+class Mesh;
 }
 
 namespace ApplicationUtils
 {
+/// Settings for the in-memory partitioning with the METIS library.
+struct MetisPartitioningOptions
+{
+    /// Use multilevel recursive bisection instead of multilevel k-way
+    /// partitioning. The latter is the default of mpmetis, too.
+    bool recursive_bisection = false;
+
+    /// If set, the node weights estimate the assembly work of the adjacent
+    /// elements, cf. computeNodeWeights().
+    bool weighted_nodes = false;
+    int dofs_per_base_node = 1;
+    int dofs_per_higher_order_node = 1;
+};
+
+/// Estimates for each node the assembly work of the elements it belongs to.
+/// The cost of an element is the number of entries of its local matrix, i.e.
+/// the square of its number of DOFs, which is distributed equally to its
+/// nodes. Base nodes and higher order nodes can carry different numbers of
+/// DOFs, e.g. for Taylor-Hood elements.
+std::vector<long> computeNodeWeights(
+    std::vector<MeshLib::Element*> const& elements,
+    std::size_t number_of_nodes,
+    int dofs_per_base_node,
+    int dofs_per_higher_order_node);
+
+/// Partitions the nodes of the given mesh by calling METIS_PartMeshNodal
+/// directly on the element-node connectivity, without writing a METIS mesh
+/// file and running mpmetis.
+/// \return The partition id of each node.
+std::vector<std::size_t> partitionNodesWithMetis(
+    MeshLib::Mesh const& mesh,
+    long number_of_partitions,
+    MetisPartitioningOptions const& options);
+
 /// Write elements as METIS graph file
 /// \param elements The mesh elements.
 /// \param file_name File name with an extension of mesh.
@@ -36,9 +71,4 @@ std::vector<std::size_t> readMetisData(const std::string& file_name_base,
                                        long number_of_partitions,
                                        std::size_t number_of_nodes);
 
-/// Removes the F.mesh.npart.P and F.mesh.epart.P files, where F is file name
-/// base and P is the number of partitions.
-void removeMetisPartitioningFiles(std::string const& file_name_base,
-                                  long number_of_partitions);
-
 }  // namespace ApplicationUtils
@@ -31,7 +31,8 @@ int main(int argc, char* argv[])
         "Partition a mesh for parallel computing."
         "The tasks of this tool are in twofold:\n"
         "1. Convert mesh file to the input file of the partitioning tool,\n"
-        "2. Partition a mesh using the partitioning tool,\n"
+        "2. Partition a mesh using the METIS library or read the "
+        "partitioning computed by mpmetis,\n"
         "\tcreate the mesh data of each partition,\n"
         "\trenumber the node indices of each partition,\n"
         "\tand output the results for parallel computing.\n"
@@ -73,10 +74,41 @@ int main(int argc, char* argv[])
         false);
 
     TCLAP::SwitchArg exe_metis_flag(
-        "m", "exe_metis", "Call mpmetis inside the programme via system().",
+        "m", "exe_metis",
+        "Partition the mesh with the METIS library inside the programme. "
+        "Otherwise the partitioning is read from the mpmetis output file.",
         false);
     cmd.add(exe_metis_flag);
 
+    TCLAP::SwitchArg recursive_bisection_flag(
+        "", "recursive-bisection",
+        "Use multilevel recursive bisection instead of multilevel k-way "
+        "partitioning in METIS. Only used together with -m.",
+        false);
+    cmd.add(recursive_bisection_flag);
+
+    TCLAP::SwitchArg weighted_nodes_flag(
+        "", "weighted-nodes",
+        "Weight the nodes by the estimated assembly work of the adjacent "
+        "elements to balance the load for meshes with mixed element types. "
+        "Only used together with -m.",
+        false);
+    cmd.add(weighted_nodes_flag);
+
+    TCLAP::ValueArg<int> dofs_per_base_node_arg(
+        "", "dofs-per-base-node",
+        "number of degrees of freedom at each base node, used for the node "
+        "weights",
+        false, 1, "integer");
+    cmd.add(dofs_per_base_node_arg);
+
+    TCLAP::ValueArg<int> dofs_per_higher_order_node_arg(
+        "", "dofs-per-higher-order-node",
+        "number of degrees of freedom at each higher order node, used for the "
+        "node weights",
+        false, 1, "integer");
+    cmd.add(dofs_per_higher_order_node_arg);
+
     TCLAP::ValueArg<std::string> log_level_arg(
         "l", "log-level",
         "the verbosity of logging messages: none, error, warn, info, debug, "
@@ -107,6 +139,16 @@ int main(int argc, char* argv[])
             OGS_FATAL("spdlog logger error occurred.");
         });
 
+    if (dofs_per_base_node_arg.getValue() < 1 ||
+        dofs_per_higher_order_node_arg.getValue() < 1)
+    {
+        ERR("The numbers of degrees of freedom per node must be positive, but "
+            "{:d} and {:d} were given.",
+            dofs_per_base_node_arg.getValue(),
+            dofs_per_higher_order_node_arg.getValue());
+        return EXIT_FAILURE;
+    }
+
     BaseLib::RunTime run_timer;
     run_timer.start();
     BaseLib::CPUTime CPU_timer;
@@ -154,41 +196,26 @@ int main(int argc, char* argv[])
             "-np=1'.");
     }
 
-    auto metis_mesh = output_file_name_wo_extension;
-    if (metis_mesh_input.getValue() != "")
-    {
-        metis_mesh = metis_mesh_input.getValue();
-    }
-
-    // Execute mpmetis via system(...)
     if (exe_metis_flag.getValue())
     {
         INFO("METIS is running ...");
-        const std::string exe_name = argv[0];
-        const std::string exe_path = BaseLib::extractPath(exe_name);
-        INFO("Path to mpmetis is: \n\t{:s}", exe_path);
-
-        const std::string mpmetis_com =
-            BaseLib::joinPaths(exe_path, "mpmetis") + " -gtype=nodal " + "'" +
-            metis_mesh + ".mesh" + "' " + std::to_string(nparts.getValue());
-
-        INFO("Running: {:s}", mpmetis_com);
-        const int status = system(mpmetis_com.c_str());
-        if (status != 0)
-        {
-            INFO("Failed in system calling.");
-            INFO("Return value of system call {:d} ", status);
-            return EXIT_FAILURE;
-        }
+        ApplicationUtils::MetisPartitioningOptions const metis_options{
+            recursive_bisection_flag.getValue(),
+            weighted_nodes_flag.getValue(), dofs_per_base_node_arg.getValue(),
+            dofs_per_higher_order_node_arg.getValue()};
+        mesh_partitioner.resetPartitionIdsForNodes(partitionNodesWithMetis(
+            mesh_partitioner.mesh(), num_partitions, metis_options));
     }
-    mesh_partitioner.resetPartitionIdsForNodes(
-        readMetisData(metis_mesh, num_partitions,
-                      mesh_partitioner.mesh().getNumberOfNodes()));
-
-    // Remove metis partitioning files only if metis was run internally.
-    if (exe_metis_flag.getValue())
+    else
     {
-        removeMetisPartitioningFiles(metis_mesh, num_partitions);
+        auto metis_mesh = output_file_name_wo_extension;
+        if (metis_mesh_input.getValue() != "")
+        {
+            metis_mesh = metis_mesh_input.getValue();
+        }
+        mesh_partitioner.resetPartitionIdsForNodes(
+            readMetisData(metis_mesh, num_partitions,
+                          mesh_partitioner.mesh().getNumberOfNodes()));
     }
 
     INFO("Partitioning the mesh in the node wise way ...");
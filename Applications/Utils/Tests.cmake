@@ -298,6 +298,28 @@ AddTest(
                 basicQuadTet_partitioned_msh_ele_g2.bin
                 basicQuadTet_partitioned_msh_nod2.bin
 )
+
+# The node weights and the recursive bisection change the partitioning. The
+# tests check that partmesh succeeds with these options, the node weights are
+# checked by a unit test of computeNodeWeights().
+AddTest(
+    NAME partmesh_mesh_for_QuadraticTet_weighted_nodes
+    PATH NodePartitionedMesh/QuadraticElements/Quad_tet/weighted_nodes
+    WORKING_DIRECTORY ${Data_SOURCE_DIR}/NodePartitionedMesh/QuadraticElements/Quad_tet
+    EXECUTABLE partmesh
+    EXECUTABLE_ARGS -m -n 2 -i basicQuadTet.vtu --weighted-nodes
+                    --dofs-per-base-node 4 --dofs-per-higher-order-node 3
+                    -o ${Data_BINARY_DIR}/NodePartitionedMesh/QuadraticElements/Quad_tet/weighted_nodes
+)
+
+AddTest(
+    NAME partmesh_mesh_for_QuadraticTet_recursive_bisection
+    PATH NodePartitionedMesh/QuadraticElements/Quad_tet/recursive_bisection
+    WORKING_DIRECTORY ${Data_SOURCE_DIR}/NodePartitionedMesh/QuadraticElements/Quad_tet
+    EXECUTABLE partmesh
+    EXECUTABLE_ARGS -m -n 2 -i basicQuadTet.vtu --recursive-bisection
+                    -o ${Data_BINARY_DIR}/NodePartitionedMesh/QuadraticElements/Quad_tet/recursive_bisection
+)
 ################################################
 
 ##############Quadratic Hex#####################
@@ -0,0 +1,80 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "AllocationCounter.h"
+
+#ifdef OGS_COUNT_ALLOCATIONS
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<std::uint64_t> number_of_allocations{0};
+}  // namespace
+
+// Replacements of the global allocation functions. The array, nothrow, and
+// sized variants forward to these by default. Over-aligned allocations are
+// not counted.
+void* operator new(std::size_t size)
+{
+    number_of_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* const p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t /*size*/) noexcept
+{
+    std::free(p);
+}
+#endif
+
+namespace BaseLib
+{
+namespace
+{
+std::uint64_t numberOfAllocations()
+{
+#ifdef OGS_COUNT_ALLOCATIONS
+    return number_of_allocations.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+}  // namespace
+
+bool AllocationCounter::isEnabled()
+{
+#ifdef OGS_COUNT_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AllocationCounter::start()
+{
+    start_count_ = numberOfAllocations();
+}
+
+std::uint64_t AllocationCounter::count() const
+{
+    return numberOfAllocations() - start_count_;
+}
+
+}  // namespace BaseLib
@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace BaseLib
+{
+/// Counts the heap allocations done through the global operator new, e.g.,
+/// by standard containers, from all threads.
+///
+/// Counting requires OGS to be built with OGS_COUNT_ALLOCATIONS, which
+/// replaces the global operator new. Otherwise count() always returns zero.
+///
+/// \note Dynamically sized Eigen matrices and vectors are allocated with
+/// malloc and not counted.
+class AllocationCounter
+{
+public:
+    /// Returns true if OGS has been built with allocation counting.
+    static bool isEnabled();
+
+    /// Starts counting.
+    void start();
+
+    /// Number of allocations since the last call of start().
+    std::uint64_t count() const;
+
+private:
+    std::uint64_t start_count_ = 0;
+};
+
+}  // namespace BaseLib
@@ -0,0 +1,555 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "Profiler.h"
+
+#include <spdlog/fmt/bundled/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+#ifdef USE_PETSC
+#include <mpi.h>
+#endif
+
+#include "Error.h"
+#include "Logging.h"
+
+namespace BaseLib
+{
+namespace
+{
+struct Node
+{
+    char const* name;
+    int parent;
+    std::vector<int> children;
+    std::uint64_t count = 0;
+    double total = 0;
+    double min = std::numeric_limits<double>::max();
+    double max = 0;
+};
+
+struct Counter
+{
+    char const* name;
+    std::int64_t value;
+};
+
+struct TraceEvent
+{
+    int node;
+    Profiler::Clock::time_point begin;
+    Profiler::Clock::time_point end;
+};
+
+/// Regions, counters, and timeline of a single thread. Only the owning thread
+/// modifies the data; they are read after the simulation.
+struct ThreadData
+{
+    explicit ThreadData(int const index_) : index(index_)
+    {
+        nodes.push_back({"", -1, {}});
+    }
+
+    int enter(char const* const name)
+    {
+        auto& children = nodes[current].children;
+        auto const it = std::find_if(
+            children.begin(), children.end(),
+            [&](int const child)
+            {
+                auto const* const child_name = nodes[child].name;
+                return child_name == name || std::strcmp(child_name, name) == 0;
+            });
+        if (it != children.end())
+        {
+            current = *it;
+            return current;
+        }
+
+        int const node = static_cast<int>(nodes.size());
+        nodes.push_back({name, current, {}});
+        nodes[current].children.push_back(node);
+        current = node;
+        return current;
+    }
+
+    void leave(int const node, Profiler::Clock::time_point const begin,
+               Profiler::Clock::time_point const end)
+    {
+        double const duration =
+            std::chrono::duration<double>(end - begin).count();
+        auto& n = nodes[node];
+        n.count++;
+        n.total += duration;
+        n.min = std::min(n.min, duration);
+        n.max = std::max(n.max, duration);
+        current = n.parent;
+
+        if (record_timeline)
+        {
+            events.push_back({node, begin, end});
+        }
+    }
+
+    /// Makes the end of the given path the innermost open region without
+    /// measuring the regions of the path. Returns the previous innermost
+    /// region.
+    int continuePath(Profiler::Path const& path)
+    {
+        int const previous = current;
+        current = 0;
+        for (auto const* const name : path)
+        {
+            enter(name);
+        }
+        return previous;
+    }
+
+    Profiler::Path currentPath() const
+    {
+        Profiler::Path result;
+        for (int node = current; node > 0; node = nodes[node].parent)
+        {
+            result.push_back(nodes[node].name);
+        }
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    /// The names are compared by address first, such that no string is
+    /// built or compared for the common case of a string literal.
+    void count(char const* const name, std::int64_t const value)
+    {
+        auto const it = std::find_if(
+            counters.begin(), counters.end(),
+            [&](Counter const& counter)
+            {
+                return counter.name == name ||
+                       std::strcmp(counter.name, name) == 0;
+            });
+        if (it != counters.end())
+        {
+            it->value += value;
+            return;
+        }
+        counters.push_back({name, value});
+    }
+
+    std::string path(int node) const
+    {
+        std::string result = nodes[node].name;
+        for (node = nodes[node].parent; node > 0; node = nodes[node].parent)
+        {
+            result = std::string(nodes[node].name) + "/" + result;
+        }
+        return result;
+    }
+
+    int const index;
+    bool record_timeline = false;
+    std::vector<Node> nodes;
+    int current = 0;
+    std::vector<TraceEvent> events;
+    std::vector<Counter> counters;
+};
+
+std::atomic<bool> enabled{false};
+bool record_timeline = false;
+Profiler::Clock::time_point start_time;
+
+std::mutex registry_mutex;
+std::vector<std::shared_ptr<ThreadData>> registry;
+/// Incremented by reset() to invalidate the thread local data.
+std::atomic<int> generation{0};
+
+ThreadData& threadData()
+{
+    thread_local std::shared_ptr<ThreadData> data;
+    thread_local int data_generation = -1;
+    if (!data || data_generation != generation.load())
+    {
+        std::lock_guard lock(registry_mutex);
+        data = std::make_shared<ThreadData>(static_cast<int>(registry.size()));
+        data->record_timeline = record_timeline;
+        data_generation = generation.load();
+        registry.push_back(data);
+    }
+    return *data;
+}
+
+std::map<std::string, std::int64_t> mergedCounters()
+{
+    std::map<std::string, std::int64_t> counters;
+    for (auto const& data : registry)
+    {
+        for (auto const& [name, value] : data->counters)
+        {
+            counters[name] += value;
+        }
+    }
+    return counters;
+}
+
+std::string escapeJSON(std::string const& s)
+{
+    std::string result;
+    for (char const c : s)
+    {
+        if (c == '"' || c == '\\')
+        {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+
+int mpiRank()
+{
+#ifdef USE_PETSC
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    return rank;
+#else
+    return 0;
+#endif
+}
+
+/// Minimum, mean and maximum of the total time of a region over the MPI
+/// ranks, which called the region.
+struct RankStatistics
+{
+    int ranks = 0;
+    double min = std::numeric_limits<double>::max();
+    double sum = 0;
+    double max = 0;
+};
+
+#ifdef USE_PETSC
+/// Concatenates the strings of all ranks on rank 0. The result is empty on the
+/// other ranks.
+std::string gatherOnRankZero(std::string const& local)
+{
+    int number_of_ranks;
+    MPI_Comm_size(MPI_COMM_WORLD, &number_of_ranks);
+    int const local_size = static_cast<int>(local.size());
+    std::vector<int> sizes(number_of_ranks);
+    MPI_Gather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0,
+               MPI_COMM_WORLD);
+
+    std::vector<int> offsets(number_of_ranks + 1, 0);
+    for (int i = 0; i < number_of_ranks; ++i)
+    {
+        offsets[i + 1] = offsets[i] + sizes[i];
+    }
+    std::string gathered(mpiRank() == 0 ? offsets.back() : 0, '\0');
+    MPI_Gatherv(local.data(), local_size, MPI_CHAR, gathered.data(),
+                sizes.data(), offsets.data(), MPI_CHAR, 0, MPI_COMM_WORLD);
+    return gathered;
+}
+#endif
+
+/// Gathers the total times of the regions of all ranks on rank 0.
+std::map<std::string, RankStatistics> reduceOverRanks(
+    std::vector<Profiler::RegionStatistics> const& statistics)
+{
+    std::map<std::string, RankStatistics> result;
+    auto add = [&result](std::string const& path, double const total)
+    {
+        auto& r = result[path];
+        r.ranks++;
+        r.min = std::min(r.min, total);
+        r.sum += total;
+        r.max = std::max(r.max, total);
+    };
+
+#ifdef USE_PETSC
+    std::ostringstream os;
+    os.precision(std::numeric_limits<double>::max_digits10);
+    for (auto const& s : statistics)
+    {
+        os << s.path << '\t' << s.total << '\n';
+    }
+
+    std::istringstream in(gatherOnRankZero(os.str()));
+    std::string line;
+    while (std::getline(in, line))
+    {
+        auto const tab = line.rfind('\t');
+        add(line.substr(0, tab), std::stod(line.substr(tab + 1)));
+    }
+#else
+    for (auto const& s : statistics)
+    {
+        add(s.path, s.total);
+    }
+#endif
+    return result;
+}
+
+/// Sums the counters of all ranks on rank 0.
+std::map<std::string, std::int64_t> reduceCountersOverRanks(
+    std::map<std::string, std::int64_t> const& counters)
+{
+#ifdef USE_PETSC
+    std::ostringstream os;
+    for (auto const& [name, value] : counters)
+    {
+        os << name << '\t' << value << '\n';
+    }
+
+    std::map<std::string, std::int64_t> result;
+    std::istringstream in(gatherOnRankZero(os.str()));
+    std::string line;
+    while (std::getline(in, line))
+    {
+        auto const tab = line.rfind('\t');
+        result[line.substr(0, tab)] += std::stoll(line.substr(tab + 1));
+    }
+    return result;
+#else
+    return counters;
+#endif
+}
+
+void writeSummary(std::string const& prefix,
+                  std::vector<Profiler::RegionStatistics> const& statistics,
+                  std::map<std::string, RankStatistics> const& ranks,
+                  std::map<std::string, std::int64_t> const& counters)
+{
+    std::ofstream json(prefix + ".json");
+    std::ofstream csv(prefix + ".csv");
+    if (!json || !csv)
+    {
+        OGS_FATAL(
+            "Could not open the profiling summary files '{:s}.json' and "
+            "'{:s}.csv' for writing.",
+            prefix, prefix);
+    }
+
+    json << "{\n  \"regions\": [";
+    csv << "path,count,total,min,max,mean,ranks,rank_min_total,"
+           "rank_mean_total,rank_max_total\n";
+    bool first = true;
+    for (auto const& s : statistics)
+    {
+        auto const& r = ranks.at(s.path);
+        double const mean = s.count > 0 ? s.total / s.count : 0;
+        json << (first ? "\n" : ",\n")
+             << fmt::format(
+                    "    {{\"path\": \"{:s}\", \"count\": {:d}, \"total\": "
+                    "{:g}, \"min\": {:g}, \"max\": {:g}, \"mean\": {:g}, "
+                    "\"ranks\": {:d}, \"rank_min_total\": {:g}, "
+                    "\"rank_mean_total\": {:g}, \"rank_max_total\": {:g}}}",
+                    escapeJSON(s.path), s.count, s.total, s.min, s.max, mean,
+                    r.ranks, r.min, r.sum / r.ranks, r.max);
+        csv << fmt::format(
+            "\"{:s}\",{:d},{:g},{:g},{:g},{:g},{:d},{:g},{:g},{:g}\n", s.path,
+            s.count, s.total, s.min, s.max, mean, r.ranks, r.min,
+            r.sum / r.ranks, r.max);
+        first = false;
+    }
+    json << "\n  ],\n  \"counters\": {";
+    first = true;
+    for (auto const& [name, value] : counters)
+    {
+        json << (first ? "\n" : ",\n")
+             << fmt::format("    \"{:s}\": {:d}", escapeJSON(name), value);
+        first = false;
+    }
+    json << "\n  }\n}\n";
+}
+
+void writeTimeline(std::string const& file_name)
+{
+    std::ofstream out(file_name);
+    if (!out)
+    {
+        OGS_FATAL(
+            "Could not open the profiling timeline file '{:s}' for writing.",
+            file_name);
+    }
+
+    int const rank = mpiRank();
+    out << "{\"traceEvents\": [";
+    bool first = true;
+    for (auto const& data : registry)
+    {
+        for (auto const& e : data->events)
+        {
+            using Microseconds = std::chrono::duration<double, std::micro>;
+            out << (first ? "\n" : ",\n")
+                << fmt::format(
+                       "{{\"name\": \"{:s}\", \"cat\": \"{:s}\", \"ph\": "
+                       "\"X\", \"ts\": {:.3f}, \"dur\": {:.3f}, \"pid\": "
+                       "{:d}, \"tid\": {:d}}}",
+                       escapeJSON(data->nodes[e.node].name),
+                       escapeJSON(data->path(e.node)),
+                       Microseconds(e.begin - start_time).count(),
+                       Microseconds(e.end - e.begin).count(), rank,
+                       data->index);
+            first = false;
+        }
+    }
+    out << "\n]}\n";
+}
+}  // namespace
+
+void Profiler::enable(bool const record_timeline_)
+{
+    std::lock_guard lock(registry_mutex);
+    record_timeline = record_timeline_;
+    start_time = Clock::now();
+    for (auto& data : registry)
+    {
+        data->record_timeline = record_timeline;
+    }
+    enabled = true;
+}
+
+bool Profiler::isEnabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+Profiler::Path Profiler::currentPath()
+{
+    if (!isEnabled())
+    {
+        return {};
+    }
+    return threadData().currentPath();
+}
+
+void Profiler::count(char const* const name, std::int64_t const value)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+    threadData().count(name, value);
+}
+
+std::vector<Profiler::RegionStatistics> Profiler::statistics()
+{
+    std::lock_guard lock(registry_mutex);
+    std::map<std::string, RegionStatistics> merged;
+    for (auto const& data : registry)
+    {
+        for (int node = 1; node < static_cast<int>(data->nodes.size()); ++node)
+        {
+            auto const& n = data->nodes[node];
+            if (n.count == 0)
+            {
+                continue;
+            }
+            auto const path = data->path(node);
+            auto& s = merged[path];
+            if (s.count == 0)
+            {
+                s.path = path;
+                s.min = n.min;
+            }
+            s.count += n.count;
+            s.total += n.total;
+            s.min = std::min(s.min, n.min);
+            s.max = std::max(s.max, n.max);
+        }
+    }
+
+    std::vector<RegionStatistics> result;
+    result.reserve(merged.size());
+    for (auto& [path, s] : merged)
+    {
+        result.push_back(std::move(s));
+    }
+    return result;
+}
+
+void Profiler::write(std::string const& prefix)
+{
+    auto const statistics = Profiler::statistics();
+    auto const ranks = reduceOverRanks(statistics);
+
+    std::lock_guard lock(registry_mutex);
+    auto const counters = reduceCountersOverRanks(mergedCounters());
+    int const rank = mpiRank();
+    if (rank == 0)
+    {
+        INFO("Writing profiling summary to '{:s}.json' and '{:s}.csv'.", prefix,
+             prefix);
+        writeSummary(prefix, statistics, ranks, counters);
+    }
+
+    if (record_timeline)
+    {
+#ifdef USE_PETSC
+        writeTimeline(fmt::format("{:s}_trace_{:d}.json", prefix, rank));
+#else
+        writeTimeline(prefix + "_trace.json");
+#endif
+    }
+}
+
+void Profiler::reset()
+{
+    std::lock_guard lock(registry_mutex);
+    enabled = false;
+    record_timeline = false;
+    registry.clear();
+    generation++;
+}
+
+ProfilerRegion::ProfilerRegion(char const* const name)
+    : start_(Profiler::Clock::now())
+{
+    if (!Profiler::isEnabled())
+    {
+        return;
+    }
+    node_ = threadData().enter(name);
+}
+
+ProfilerRegion::~ProfilerRegion()
+{
+    if (node_ < 0)
+    {
+        return;
+    }
+    threadData().leave(node_, start_, Profiler::Clock::now());
+}
+
+ProfilerParentRegions::ProfilerParentRegions(Profiler::Path const& path)
+{
+    if (path.empty() || !Profiler::isEnabled())
+    {
+        return;
+    }
+    previous_node_ = threadData().continuePath(path);
+}
+
+ProfilerParentRegions::~ProfilerParentRegions()
+{
+    if (previous_node_ < 0)
+    {
+        return;
+    }
+    threadData().current = previous_node_;
+}
+}  // namespace BaseLib
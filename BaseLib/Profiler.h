@@ -0,0 +1,133 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace BaseLib
+{
+/// Hierarchical profiler of named, nested regions.
+///
+/// Regions are measured with ProfilerRegion objects. The nesting of the
+/// regions of each thread forms a tree, and the region statistics are
+/// aggregated per path in this tree, e.g.
+/// "time_step/solve_process/nonlinear_iteration/assembly". Worker threads
+/// continue the path of the thread starting them with ProfilerParentRegions.
+/// In addition named counters can be incremented.
+///
+/// The profiler is disabled by default; then a region only reads the clock
+/// once. At the end of the simulation write() stores a summary as JSON and
+/// CSV files and, if requested, a timeline in the Chrome trace event format,
+/// which can be viewed in chrome://tracing or https://ui.perfetto.dev. With
+/// PETSc the summary is reduced over all MPI ranks, the counters are summed.
+class Profiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Statistics of all calls of the regions with the same path.
+    struct RegionStatistics
+    {
+        std::string path;
+        std::uint64_t count = 0;
+        double total = 0;  ///< in seconds
+        double min = 0;    ///< in seconds
+        double max = 0;    ///< in seconds
+    };
+
+    /// Enables the profiler. If \c record_timeline is set, every region call
+    /// is stored for the Chrome trace in addition to the statistics.
+    static void enable(bool const record_timeline);
+
+    static bool isEnabled();
+
+    /// Names of regions from the outermost to the innermost one.
+    using Path = std::vector<char const*>;
+
+    /// The open regions of the calling thread. Empty if the profiler is
+    /// disabled.
+    static Path currentPath();
+
+    /// Adds \c value to the counter with the given name. Like for regions,
+    /// the name must be a string with static storage duration.
+    static void count(char const* name, std::int64_t const value = 1);
+
+    /// Region statistics of the calling process aggregated over all threads,
+    /// sorted by path.
+    static std::vector<RegionStatistics> statistics();
+
+    /// Writes the summary to prefix.json and prefix.csv and the timeline to
+    /// prefix_trace.json (prefix_trace_<rank>.json with PETSc). Must be called
+    /// by all MPI ranks when running with PETSc.
+    static void write(std::string const& prefix);
+
+    /// Disables the profiler and discards all recorded data.
+    static void reset();
+};
+
+/// Measures the time from construction to destruction of the object as a
+/// region of the Profiler. The name must be a string with static storage
+/// duration, e.g. a string literal.
+class ProfilerRegion
+{
+public:
+    explicit ProfilerRegion(char const* name);
+    ~ProfilerRegion();
+
+    ProfilerRegion(ProfilerRegion const&) = delete;
+    ProfilerRegion& operator=(ProfilerRegion const&) = delete;
+
+    /// Time in seconds since the construction of the region. Also available
+    /// if the profiler is disabled.
+    double elapsed() const
+    {
+        return std::chrono::duration<double>(Profiler::Clock::now() - start_)
+            .count();
+    }
+
+private:
+    Profiler::Clock::time_point const start_;
+    /// Index of the region in the tree of the calling thread or -1 if the
+    /// profiler is disabled.
+    int node_ = -1;
+};
+
+/// Continues a path of open regions of another thread in the calling thread,
+/// such that the regions opened by the calling thread are recorded below that
+/// path instead of starting new root paths. The regions of the path are not
+/// measured again. Used in OpenMP parallel regions with the
+/// Profiler::currentPath() of the thread starting them, e.g.
+/// \code
+/// auto const path = BaseLib::Profiler::currentPath();
+/// #pragma omp parallel
+/// {
+///     BaseLib::ProfilerParentRegions const parents(path);
+///     ...
+/// }
+/// \endcode
+class ProfilerParentRegions
+{
+public:
+    explicit ProfilerParentRegions(Profiler::Path const& path);
+    ~ProfilerParentRegions();
+
+    ProfilerParentRegions(ProfilerParentRegions const&) = delete;
+    ProfilerParentRegions& operator=(ProfilerParentRegions const&) = delete;
+
+private:
+    /// The innermost open region of the calling thread before the
+    /// construction or -1 if nothing has been changed.
+    int previous_node_ = -1;
+};
+}  // namespace BaseLib
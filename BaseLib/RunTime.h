@@ -34,7 +34,7 @@ public:
 #ifdef USE_PETSC
         start_time_ = MPI_Wtime();
 #else
-        start_time_ = std::chrono::system_clock::now();
+        start_time_ = std::chrono::steady_clock::now();
 #endif
     }
 
@@ -45,7 +45,7 @@ public:
         return MPI_Wtime() - start_time_;
 #else
         using namespace std::chrono;
-        return duration<double>(system_clock::now() - start_time_).count();
+        return duration<double>(steady_clock::now() - start_time_).count();
 #endif
     }
 
@@ -53,7 +53,7 @@ private:
 #ifdef USE_PETSC
     double start_time_ = std::numeric_limits<double>::quiet_NaN();
 #else
-    std::chrono::time_point<std::chrono::system_clock> start_time_;
+    std::chrono::time_point<std::chrono::steady_clock> start_time_;
 #endif
 };
 
@@ -135,11 +135,18 @@ createChemicalSolverInterface<ChemicalSolver::Phreeqc>(
     auto output = PhreeqcIOData::createOutput(
         *chemical_system, user_punch, use_high_precision, project_file_name);
 
+    auto const in_memory =
+        //! \ogs_file_param{prj__chemical_system__in_memory}
+        config.getConfigParameter<bool>("in_memory", false);
+    auto const number_of_instances =
+        //! \ogs_file_param{prj__chemical_system__number_of_instances}
+        config.getConfigParameter<int>("number_of_instances", 1);
+
     return std::make_unique<PhreeqcIOData::PhreeqcIO>(
         mesh, *linear_solver, std::move(project_file_name),
         std::move(path_to_database), std::move(chemical_system),
         std::move(reaction_rates), std::move(user_punch), std::move(output),
-        std::move(dump), std::move(knobs));
+        std::move(dump), std::move(knobs), in_memory, number_of_instances);
 }
 
 template <>
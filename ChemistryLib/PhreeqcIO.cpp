@@ -17,6 +17,8 @@
 #include <fstream>
 #include <iomanip>
 #include <numeric>
+#include <sstream>
+#include <thread>
 
 #include "BaseLib/Algorithm.h"
 #include "BaseLib/ConfigTreeUtil.h"
@@ -274,7 +276,9 @@ PhreeqcIO::PhreeqcIO(MeshLib::Mesh const& mesh,
                      std::unique_ptr<UserPunch>&& user_punch,
                      std::unique_ptr<Output>&& output,
                      std::unique_ptr<Dump>&& dump,
-                     Knobs&& knobs)
+                     Knobs&& knobs,
+                     bool const in_memory,
+                     int const number_of_instances)
     : ChemicalSolverInterface(mesh, linear_solver),
       _phreeqc_input_file(specifyFileName(project_file_name, ".inp")),
       _database(std::move(database)),
@@ -283,44 +287,73 @@ PhreeqcIO::PhreeqcIO(MeshLib::Mesh const& mesh,
       _user_punch(std::move(user_punch)),
       _output(std::move(output)),
       _dump(std::move(dump)),
-      _knobs(std::move(knobs))
+      _knobs(std::move(knobs)),
+      _in_memory(in_memory)
 {
-    // initialize phreeqc instance
-    if (CreateIPhreeqc() != phreeqc_instance_id)
+    if (number_of_instances < 1)
     {
-        OGS_FATAL(
-            "Failed to initialize phreeqc instance, due to lack of memory.");
+        OGS_FATAL("The number of phreeqc instances must be positive, got {:d}.",
+                  number_of_instances);
     }
-
-    // load specified thermodynamic database
-    if (LoadDatabase(phreeqc_instance_id, _database.c_str()) != IPQ_OK)
+    if (!_in_memory && number_of_instances > 1)
     {
         OGS_FATAL(
-            "Failed in loading the specified thermodynamic database file: "
-            "{:s}.",
-            _database);
+            "Several phreeqc instances are only supported with in-memory "
+            "data exchange.");
     }
 
-    if (SetSelectedOutputFileOn(phreeqc_instance_id, 1) != IPQ_OK)
+    for (int i = 0; i < number_of_instances; ++i)
     {
-        OGS_FATAL(
-            "Failed to fly the flag for the specified file {:s} where phreeqc "
-            "will write output.",
-            _output->basic_output_setups.output_file);
-    }
+        // initialize phreeqc instance
+        int const phreeqc_instance_id = CreateIPhreeqc();
+        if (phreeqc_instance_id < 0)
+        {
+            OGS_FATAL(
+                "Failed to initialize phreeqc instance, due to lack of "
+                "memory.");
+        }
+        _phreeqc_instance_ids.push_back(phreeqc_instance_id);
 
-    if (_dump)
-    {
-        // Chemical composition of the aqueous solution of last time step will
-        // be written into .dmp file once the second function argument is set to
-        // one.
-        SetDumpFileOn(phreeqc_instance_id, 1);
+        // load specified thermodynamic database
+        if (LoadDatabase(phreeqc_instance_id, _database.c_str()) != IPQ_OK)
+        {
+            OGS_FATAL(
+                "Failed in loading the specified thermodynamic database file: "
+                "{:s}.",
+                _database);
+        }
+
+        if (_in_memory)
+        {
+            SetSelectedOutputFileOn(phreeqc_instance_id, 0);
+            SetSelectedOutputStringOn(phreeqc_instance_id, 1);
+        }
+        else if (SetSelectedOutputFileOn(phreeqc_instance_id, 1) != IPQ_OK)
+        {
+            OGS_FATAL(
+                "Failed to fly the flag for the specified file {:s} where "
+                "phreeqc will write output.",
+                _output->basic_output_setups.output_file);
+        }
+
+        if (_dump)
+        {
+            // Chemical composition of the aqueous solution of last time step
+            // will be written into .dmp file or kept in memory once the second
+            // function argument is set to one.
+            _in_memory ? SetDumpStringOn(phreeqc_instance_id, 1)
+                       : SetDumpFileOn(phreeqc_instance_id, 1);
+        }
     }
+    _phreeqc_inputs.resize(_phreeqc_instance_ids.size());
 }
 
 PhreeqcIO::~PhreeqcIO()
 {
-    DestroyIPhreeqc(phreeqc_instance_id);
+    for (int const phreeqc_instance_id : _phreeqc_instance_ids)
+    {
+        DestroyIPhreeqc(phreeqc_instance_id);
+    }
 }
 
 void PhreeqcIO::initialize()
@@ -333,6 +366,18 @@ void PhreeqcIO::initialize()
     {
         _user_punch->initialize(_num_chemical_systems);
     }
+
+    // Distribute the chemical systems evenly over the phreeqc instances. Each
+    // used instance gets at least one chemical system.
+    std::size_t const num_ranges = std::max<std::size_t>(
+        1, std::min(_phreeqc_instance_ids.size(), _num_chemical_systems));
+    _chemical_system_ranges.clear();
+    for (std::size_t i = 0; i < num_ranges; ++i)
+    {
+        _chemical_system_ranges.emplace_back(
+            i * _num_chemical_systems / num_ranges,
+            (i + 1) * _num_chemical_systems / num_ranges);
+    }
 }
 
 void PhreeqcIO::initializeChemicalSystemConcrete(
@@ -405,6 +450,12 @@ void PhreeqcIO::setChemicalSystemConcrete(
 
 void PhreeqcIO::executeSpeciationCalculation(double const dt)
 {
+    if (_in_memory)
+    {
+        executeSpeciationCalculationInMemory(dt);
+        return;
+    }
+
     writeInputsToFile(dt);
 
     callPhreeqc();
@@ -440,6 +491,26 @@ void PhreeqcIO::setAqueousSolutionsPrevFromDumpFile()
         return;
     }
 
+    if (_in_memory)
+    {
+        _dump->aqueous_solutions_prev.clear();
+        for (std::size_t i = 0; i < _chemical_system_ranges.size(); ++i)
+        {
+            // The dump string is empty before the first speciation
+            // calculation.
+            std::istringstream in(GetDumpString(_phreeqc_instance_ids[i]));
+            _dump->appendDumpedSolutions(in, _num_chemical_systems);
+        }
+        if (!_dump->aqueous_solutions_prev.empty() &&
+            _dump->aqueous_solutions_prev.size() != _num_chemical_systems)
+        {
+            OGS_FATAL(
+                "Expected {:d} dumped phreeqc solutions, but got {:d}.",
+                _num_chemical_systems, _dump->aqueous_solutions_prev.size());
+        }
+        return;
+    }
+
     auto const& dump_file = _dump->dump_file;
     std::ifstream in(dump_file);
     if (!in)
@@ -485,8 +556,14 @@ void PhreeqcIO::writeInputsToFile(double const dt)
 
 std::ostream& operator<<(std::ostream& os, PhreeqcIO const& phreeqc_io)
 {
-    bool const fixing_pe =
-        phreeqc_io._chemical_system->aqueous_solution->fixing_pe;
+    phreeqc_io.writeInputs(os, 0, phreeqc_io._num_chemical_systems);
+    return os;
+}
+
+void PhreeqcIO::writeInputs(std::ostream& os, std::size_t const first,
+                            std::size_t const last) const
+{
+    bool const fixing_pe = _chemical_system->aqueous_solution->fixing_pe;
     if (fixing_pe)
     {
         os << "PHASES\n"
@@ -495,32 +572,30 @@ std::ostream& operator<<(std::ostream& os, PhreeqcIO const& phreeqc_io)
            << "log_k 0.0\n\n";
     }
 
-    os << phreeqc_io._knobs << "\n";
+    os << _knobs << "\n";
 
-    os << *phreeqc_io._output << "\n";
+    os << *_output << "\n";
 
-    auto const& user_punch = phreeqc_io._user_punch;
+    auto const& user_punch = _user_punch;
     if (user_punch)
     {
         os << *user_punch << "\n";
     }
 
-    auto const& reaction_rates = phreeqc_io._reaction_rates;
+    auto const& reaction_rates = _reaction_rates;
     if (!reaction_rates.empty())
     {
         os << "RATES\n";
         os << reaction_rates << "\n";
     }
 
-    for (std::size_t chemical_system_id = 0;
-         chemical_system_id < phreeqc_io._num_chemical_systems;
+    for (std::size_t chemical_system_id = first; chemical_system_id < last;
          ++chemical_system_id)
     {
         os << "SOLUTION " << chemical_system_id + 1 << "\n";
-        phreeqc_io._chemical_system->aqueous_solution->print(
-            os, chemical_system_id);
+        _chemical_system->aqueous_solution->print(os, chemical_system_id);
 
-        auto const& dump = phreeqc_io._dump;
+        auto const& dump = _dump;
         if (dump)
         {
             auto const& aqueous_solutions_prev = dump->aqueous_solutions_prev;
@@ -536,7 +611,7 @@ std::ostream& operator<<(std::ostream& os, PhreeqcIO const& phreeqc_io)
         os << "USE solution " << chemical_system_id + 1 << "\n\n";
 
         auto const& equilibrium_reactants =
-            phreeqc_io._chemical_system->equilibrium_reactants;
+            _chemical_system->equilibrium_reactants;
         if (!equilibrium_reactants.empty() || fixing_pe)
         {
             os << "EQUILIBRIUM_PHASES " << chemical_system_id + 1 << "\n";
@@ -546,13 +621,12 @@ std::ostream& operator<<(std::ostream& os, PhreeqcIO const& phreeqc_io)
             }
             fixing_pe
                 ? os << "Fix_pe "
-                     << -phreeqc_io._chemical_system->aqueous_solution->pe0
+                     << -_chemical_system->aqueous_solution->pe0
                      << " O2(g)\n\n"
                 : os << "\n";
         }
 
-        auto const& kinetic_reactants =
-            phreeqc_io._chemical_system->kinetic_reactants;
+        auto const& kinetic_reactants = _chemical_system->kinetic_reactants;
         if (!kinetic_reactants.empty())
         {
             os << "KINETICS " << chemical_system_id + 1 << "\n";
@@ -560,17 +634,17 @@ std::ostream& operator<<(std::ostream& os, PhreeqcIO const& phreeqc_io)
             {
                 kinetic_reactant.print(os, chemical_system_id);
             }
-            os << "-steps " << phreeqc_io._dt << "\n\n";
+            os << "-steps " << _dt << "\n\n";
         }
 
-        auto const& surface = phreeqc_io._chemical_system->surface;
+        auto const& surface = _chemical_system->surface;
         if (!surface.empty())
         {
             os << "SURFACE " << chemical_system_id + 1 << "\n";
             std::size_t aqueous_solution_id =
                 dump->aqueous_solutions_prev.empty()
                     ? chemical_system_id + 1
-                    : phreeqc_io._num_chemical_systems + chemical_system_id + 1;
+                    : _num_chemical_systems + chemical_system_id + 1;
             os << "-equilibrate with solution " << aqueous_solution_id << "\n";
 
             // print unit
@@ -611,14 +685,14 @@ std::ostream& operator<<(std::ostream& os, PhreeqcIO const& phreeqc_io)
             os << "SAVE solution " << chemical_system_id + 1 << "\n";
         }
 
-        auto const& exchangers = phreeqc_io._chemical_system->exchangers;
+        auto const& exchangers = _chemical_system->exchangers;
         if (!exchangers.empty())
         {
             os << "EXCHANGE " << chemical_system_id + 1 << "\n";
             std::size_t const aqueous_solution_id =
                 dump->aqueous_solutions_prev.empty()
                     ? chemical_system_id + 1
-                    : phreeqc_io._num_chemical_systems + chemical_system_id + 1;
+                    : _num_chemical_systems + chemical_system_id + 1;
             os << "-equilibrate with solution " << aqueous_solution_id << "\n";
             for (auto const& exchanger : exchangers)
             {
@@ -630,18 +704,17 @@ std::ostream& operator<<(std::ostream& os, PhreeqcIO const& phreeqc_io)
         os << "END\n\n";
     }
 
-    auto const& dump = phreeqc_io._dump;
+    auto const& dump = _dump;
     if (dump)
     {
-        dump->print(os, phreeqc_io._num_chemical_systems);
+        dump->print(os, first, last);
     }
-
-    return os;
 }
 
 void PhreeqcIO::callPhreeqc()
 {
     INFO("Phreeqc: Executing chemical calculation.");
+    int const phreeqc_instance_id = _phreeqc_instance_ids.front();
     if (RunFile(phreeqc_instance_id, _phreeqc_input_file.c_str()) != IPQ_OK)
     {
         OutputErrorString(phreeqc_instance_id);
@@ -676,27 +749,99 @@ void PhreeqcIO::readOutputsFromFile()
     in.close();
 }
 
+void PhreeqcIO::executeSpeciationCalculationInMemory(double const dt)
+{
+    _dt = dt;
+
+    std::size_t const num_ranges = _chemical_system_ranges.size();
+    for (std::size_t i = 0; i < num_ranges; ++i)
+    {
+        // Move the buffer into the stream and back to keep its capacity.
+        _phreeqc_inputs[i].clear();
+        std::ostringstream os(std::move(_phreeqc_inputs[i]));
+        os << std::scientific
+           << std::setprecision(std::numeric_limits<double>::digits10);
+        auto const& [first, last] = _chemical_system_ranges[i];
+        writeInputs(os, first, last);
+        _phreeqc_inputs[i] = std::move(os).str();
+    }
+
+    INFO("Phreeqc: Executing chemical calculation with {:d} instance(s).",
+         num_ranges);
+    std::vector<int> number_of_errors(num_ranges, 0);
+    auto run = [&](std::size_t const i)
+    {
+        number_of_errors[i] =
+            RunString(_phreeqc_instance_ids[i], _phreeqc_inputs[i].c_str());
+    };
+    {
+        // The instances are independent of each other. The first one runs in
+        // the calling thread.
+        std::vector<std::jthread> threads;
+        threads.reserve(num_ranges - 1);
+        for (std::size_t i = 1; i < num_ranges; ++i)
+        {
+            threads.emplace_back(run, i);
+        }
+        run(0);
+    }
+
+    for (std::size_t i = 0; i < num_ranges; ++i)
+    {
+        if (number_of_errors[i] != 0)
+        {
+            OGS_FATAL(
+                "Failed in performing speciation calculation with phreeqc "
+                "instance {:d}: {:s}",
+                i, GetErrorString(_phreeqc_instance_ids[i]));
+        }
+    }
+
+    // Parsing writes into the shared global vectors, therefore it is done
+    // sequentially.
+    for (std::size_t i = 0; i < num_ranges; ++i)
+    {
+        std::istringstream in(
+            GetSelectedOutputString(_phreeqc_instance_ids[i]));
+        auto const& [first, last] = _chemical_system_ranges[i];
+        readOutputs(in, first, last);
+
+        if (!in)
+        {
+            OGS_FATAL(
+                "Error when reading the selected output of phreeqc instance "
+                "{:d}.",
+                i);
+        }
+    }
+}
+
 std::istream& operator>>(std::istream& in, PhreeqcIO& phreeqc_io)
+{
+    phreeqc_io.readOutputs(in, 0, phreeqc_io._num_chemical_systems);
+    return in;
+}
+
+void PhreeqcIO::readOutputs(std::istream& in, std::size_t const first,
+                            std::size_t const last)
 {
     // Skip the headline
     in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
     std::string line;
-    auto const& output = *phreeqc_io._output;
+    auto const& output = *_output;
     auto const& dropped_item_ids = output.dropped_item_ids;
 
-    auto const& surface = phreeqc_io._chemical_system->surface;
-    auto const& exchangers = phreeqc_io._chemical_system->exchangers;
+    auto const& surface = _chemical_system->surface;
+    auto const& exchangers = _chemical_system->exchangers;
 
     int const num_skipped_lines =
         1 + (!surface.empty() ? 1 : 0) + (!exchangers.empty() ? 1 : 0);
 
-    auto& equilibrium_reactants =
-        phreeqc_io._chemical_system->equilibrium_reactants;
-    auto& kinetic_reactants = phreeqc_io._chemical_system->kinetic_reactants;
+    auto& equilibrium_reactants = _chemical_system->equilibrium_reactants;
+    auto& kinetic_reactants = _chemical_system->kinetic_reactants;
 
-    for (std::size_t chemical_system_id = 0;
-         chemical_system_id < phreeqc_io._num_chemical_systems;
+    for (std::size_t chemical_system_id = first; chemical_system_id < last;
          ++chemical_system_id)
     {
         // Skip equilibrium calculation result of initial solution
@@ -753,9 +898,9 @@ std::istream& operator>>(std::istream& in, PhreeqcIO& phreeqc_io)
         }
         assert(accepted_items.size() == output.accepted_items.size());
 
-        auto& aqueous_solution = phreeqc_io._chemical_system->aqueous_solution;
+        auto& aqueous_solution = _chemical_system->aqueous_solution;
         auto& components = aqueous_solution->components;
-        auto& user_punch = phreeqc_io._user_punch;
+        auto& user_punch = _user_punch;
 
         GlobalIndexType const offset = aqueous_solution->pH->getRangeBegin();
         GlobalIndexType const global_index = offset + chemical_system_id;
@@ -839,8 +984,6 @@ std::istream& operator>>(std::istream& in, PhreeqcIO& phreeqc_io)
             }
         }
     }
-
-    return in;
 }
 
 std::vector<std::string> const PhreeqcIO::getComponentList() const
@@ -11,6 +11,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "ChemicalSolverInterface.h"
 #include "PhreeqcIOData/Knobs.h"
@@ -42,7 +45,9 @@ public:
               std::unique_ptr<UserPunch>&& user_punch,
               std::unique_ptr<Output>&& output,
               std::unique_ptr<Dump>&& dump,
-              Knobs&& knobs);
+              Knobs&& knobs,
+              bool const in_memory,
+              int const number_of_instances);
 
     ~PhreeqcIO();
 
@@ -101,6 +106,21 @@ private:
 
     void readOutputsFromFile();
 
+    /// Writes the phreeqc inputs of each instance into the reused string
+    /// buffers, runs the instances concurrently via RunString and parses the
+    /// selected output strings. No files are written.
+    void executeSpeciationCalculationInMemory(double const dt);
+
+    /// Prints the phreeqc input for the chemical systems in the half-open
+    /// range [first, last).
+    void writeInputs(std::ostream& os, std::size_t const first,
+                     std::size_t const last) const;
+
+    /// Parses the selected output of the chemical systems in the half-open
+    /// range [first, last).
+    void readOutputs(std::istream& in, std::size_t const first,
+                     std::size_t const last);
+
     PhreeqcIO& operator<<(double const dt)
     {
         _dt = dt;
@@ -115,7 +135,14 @@ private:
     std::unique_ptr<Dump> const _dump;
     Knobs const _knobs;
     double _dt = std::numeric_limits<double>::quiet_NaN();
-    const int phreeqc_instance_id = 0;
+    /// Use RunString and the selected output strings instead of the input and
+    /// output files.
+    bool const _in_memory;
+    std::vector<int> _phreeqc_instance_ids;
+    /// Half-open ranges of chemical systems, one per used phreeqc instance.
+    std::vector<std::pair<std::size_t, std::size_t>> _chemical_system_ranges;
+    /// Input buffers, one per phreeqc instance, reused between time steps.
+    std::vector<std::string> _phreeqc_inputs;
     std::size_t _num_chemical_systems = -1;
 };
 }  // namespace PhreeqcIOData
@@ -16,14 +16,15 @@ namespace ChemistryLib
 {
 namespace PhreeqcIOData
 {
-void Dump::print(std::ostream& os, std::size_t const num_chemical_systems) const
+void Dump::print(std::ostream& os, std::size_t const first,
+                 std::size_t const last) const
 {
     os << "DUMP"
        << "\n";
     os << "-file " << dump_file << "\n";
     os << "-append false"
        << "\n";
-    os << "-solution 1-" << num_chemical_systems << "\n";
+    os << "-solution " << first + 1 << "-" << last << "\n";
     os << "END"
        << "\n";
 }
@@ -34,9 +35,15 @@ void Dump::readDumpFile(std::istream& in,
     aqueous_solutions_prev.clear();
     aqueous_solutions_prev.reserve(num_chemical_systems);
 
+    appendDumpedSolutions(in, num_chemical_systems);
+}
+
+void Dump::appendDumpedSolutions(std::istream& in,
+                                 std::size_t const num_chemical_systems)
+{
     std::string line;
     std::string aqueous_solution_prev_;
-    std::size_t chemical_system_id = 0;
+    std::size_t chemical_system_id = aqueous_solutions_prev.size();
     while (std::getline(in, line))
     {
         if (line.find("USE reaction_pressure none") != std::string::npos)
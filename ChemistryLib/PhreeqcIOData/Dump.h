@@ -43,10 +43,19 @@ struct Dump
         }
     }
 
-    void print(std::ostream& os, std::size_t const num_chemical_systems) const;
+    /// Prints the DUMP block for the chemical systems in the half-open range
+    /// [first, last).
+    void print(std::ostream& os, std::size_t const first,
+               std::size_t const last) const;
 
     void readDumpFile(std::istream& in, std::size_t const num_chemical_systems);
 
+    /// Appends the dumped solutions read from the input stream to
+    /// aqueous_solutions_prev. Used when the dumps of several phreeqc
+    /// instances are read one after another.
+    void appendDumpedSolutions(std::istream& in,
+                               std::size_t const num_chemical_systems);
+
     std::string const dump_file;
     std::vector<std::string> aqueous_solutions_prev;
 };
@@ -18,12 +18,28 @@
 // BaseLib
 #include "BaseLib/FileTools.h"
 #include "BaseLib/StringTools.h"
+#include "RasterTiles.h"
 #include "Triangle.h"
 
 namespace GeoLib
 {
+Raster::Raster(std::unique_ptr<RasterTiles> tiles)
+    : _header(tiles->getHeader()), _tiles(tiles.release())
+{
+}
+
+double Raster::getPixel(std::size_t const row, std::size_t const col) const
+{
+    if (_tiles)
+    {
+        return _tiles->getValue(row, col);
+    }
+    return _raster_data[row * _header.n_cols + col];
+}
+
 void Raster::refineRaster(std::size_t scaling)
 {
+    checkInMemory();
     auto* new_raster_data(
         new double[_header.n_rows * _header.n_cols * scaling * scaling]);
 
@@ -60,6 +76,11 @@ Raster::~Raster()
     delete[] _raster_data;
 }
 
+void Raster::RasterTilesDeleter::operator()(RasterTiles* const tiles) const
+{
+    delete tiles;
+}
+
 double Raster::getValueAtPoint(const MathLib::Point3d& pnt) const
 {
     if (pnt[0] >= _header.origin[0] &&
@@ -83,8 +104,7 @@ double Raster::getValueAtPoint(const MathLib::Point3d& pnt) const
                                      ? static_cast<int>(_header.n_rows - 1)
                                      : cell_y);
 
-        const std::size_t index = cell_y * _header.n_cols + cell_x;
-        return _raster_data[index];
+        return getPixel(cell_y, cell_x);
     }
     return _header.no_data;
 }
@@ -126,9 +146,9 @@ double Raster::interpolateValueAtPoint(MathLib::Point3d const& pnt) const
         }
         else
         {
-            pix_val[j] = _raster_data[static_cast<std::size_t>(yIdx + y_nb[j]) *
-                                          _header.n_cols +
-                                      static_cast<std::size_t>(xIdx + x_nb[j])];
+            pix_val[j] =
+                getPixel(static_cast<std::size_t>(yIdx + y_nb[j]),
+                         static_cast<std::size_t>(xIdx + x_nb[j]));
         }
 
         // remove no data values
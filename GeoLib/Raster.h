@@ -14,6 +14,7 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <stdexcept>
 #include <utility>
 
@@ -21,6 +22,7 @@
 #include "MathLib/Point3d.h"
 
 namespace GeoLib {
+class RasterTiles;
 
 /// Contains the relevant information when storing a geoscientific raster data
 struct RasterHeader final
@@ -40,6 +42,10 @@ struct RasterHeader final
  * left point, the size of a raster pixel and a value for invalid data pixels.
  * Additional the object needs the raster data itself. The raster data will be
  * copied from the constructor. The destructor will release the memory.
+ *
+ * Alternatively, the raster data can be read on demand from a tile file, see
+ * RasterTiles. Such a raster cannot be modified, and begin() and end() are not
+ * available.
  */
 class Raster final
 {
@@ -74,6 +80,9 @@ public:
         std::copy(begin, end, _raster_data);
     }
 
+    /// Constructs a raster reading its data on demand from the given tiles.
+    explicit Raster(std::unique_ptr<RasterTiles> tiles);
+
     Raster(Raster const&) = delete;
     Raster(Raster&&) = delete;
     Raster& operator=(Raster const&) = delete;
@@ -91,32 +100,41 @@ public:
      * Constant iterator that is pointing to the first raster pixel value.
      * @return constant iterator
      */
-    const_iterator begin() const { return _raster_data; }
+    const_iterator begin() const
+    {
+        checkInMemory();
+        return _raster_data;
+    }
 
     /**
      * Constant iterator that is pointing to the last raster pixel value.
      * @return constant iterator
      */
-    const_iterator end() const { return _raster_data + _header.n_rows*_header.n_cols; }
+    const_iterator end() const
+    {
+        checkInMemory();
+        return _raster_data + _header.n_rows * _header.n_cols;
+    }
 
     /**
-     * Access the pixel specified by row, col.
+     * Access the pixel specified by row, col. The rows are counted from the top
+     * of the raster.
      */
-    double const& operator()(std::size_t const row, std::size_t const col) const
+    double operator()(std::size_t const row, std::size_t const col) const
     {
-        if (row >= _header.n_rows || col >= _header.n_cols)
-        {
-            OGS_FATAL(
-                "Raster pixel ({}, {}) doesn't exist. Raster size is {} x {}.",
-                row, col, _header.n_rows, _header.n_cols);
-        }
-        return _raster_data[(_header.n_rows - 1 - row) * _header.n_cols + col];
+        checkPixel(row, col);
+        return getPixel(_header.n_rows - 1 - row, col);
     }
     double& operator()(std::size_t const row, std::size_t const col)
     {
-        return const_cast<double&>(std::as_const(*this)(row, col));
+        checkPixel(row, col);
+        checkInMemory();
+        return _raster_data[(_header.n_rows - 1 - row) * _header.n_cols + col];
     }
 
+    /// Returns true if the raster data is read from tiles on demand.
+    bool isTiled() const { return _tiles != nullptr; }
+
     /**
      * Returns the raster value at the position of the given point.
      */
@@ -134,8 +152,40 @@ private:
     void setCellSize(double cell_size);
     void setNoDataVal (double no_data_val);
 
+    void checkPixel(std::size_t const row, std::size_t const col) const
+    {
+        if (row >= _header.n_rows || col >= _header.n_cols)
+        {
+            OGS_FATAL(
+                "Raster pixel ({}, {}) doesn't exist. Raster size is {} x {}.",
+                row, col, _header.n_rows, _header.n_cols);
+        }
+    }
+
+    void checkInMemory() const
+    {
+        if (_raster_data == nullptr)
+        {
+            OGS_FATAL(
+                "The raster data is read from tiles on demand and is not "
+                "available as a contiguous array.");
+        }
+    }
+
+    /// Returns the value of the pixel in the given row, counted from the
+    /// bottom of the raster, and column.
+    double getPixel(std::size_t row, std::size_t col) const;
+
+    /// Defined out of line, such that RasterTiles may be an incomplete type
+    /// wherever a Raster is constructed or destroyed.
+    struct RasterTilesDeleter
+    {
+        void operator()(RasterTiles* tiles) const;
+    };
+
     GeoLib::RasterHeader _header;
-    double* _raster_data;
+    double* _raster_data = nullptr;
+    std::unique_ptr<RasterTiles, RasterTilesDeleter> _tiles;
 };
 
 }  // namespace GeoLib
@@ -0,0 +1,248 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include "RasterTiles.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "BaseLib/Error.h"
+
+namespace
+{
+constexpr std::array<char, 8> magic = {'O', 'G', 'S', 'T', 'I', 'L', 'E', 'S'};
+constexpr std::uint64_t version = 1;
+
+/// The file header: magic, version, tile size, number of columns and rows,
+/// origin x and y, cell size, and no data value.
+constexpr std::size_t header_size = magic.size() + 4 * sizeof(std::uint64_t) +
+                                    4 * sizeof(double);
+
+template <typename T>
+void write(std::ostream& out, T const value)
+{
+    out.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template <typename T>
+T read(std::istream& in)
+{
+    T value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+}
+
+std::size_t numberOfTiles(std::size_t const n_pixels,
+                          std::size_t const tile_size)
+{
+    return (n_pixels + tile_size - 1) / tile_size;
+}
+
+std::streamoff tileOffset(std::size_t const tile_index,
+                          std::size_t const tile_size)
+{
+    return static_cast<std::streamoff>(header_size +
+                                       tile_index * tile_size * tile_size *
+                                           sizeof(double));
+}
+}  // namespace
+
+namespace GeoLib
+{
+RasterTiles::RasterTiles(std::string const& file_name,
+                         std::size_t const max_cached_tiles)
+    : _max_cached_tiles(std::max<std::size_t>(max_cached_tiles, 1)),
+      _file(file_name, std::ios::binary)
+{
+    if (!_file)
+    {
+        throw std::runtime_error("Could not open raster tile file '" +
+                                 file_name + "'.");
+    }
+
+    std::array<char, magic.size()> file_magic;
+    _file.read(file_magic.data(), file_magic.size());
+    if (!_file || file_magic != magic || read<std::uint64_t>(_file) != version)
+    {
+        throw std::runtime_error("'" + file_name +
+                                 "' is not a raster tile file of version " +
+                                 std::to_string(version) + ".");
+    }
+
+    _tile_size = read<std::uint64_t>(_file);
+    _header.n_cols = read<std::uint64_t>(_file);
+    _header.n_rows = read<std::uint64_t>(_file);
+    _header.n_depth = 1;
+    _header.origin = MathLib::Point3d{
+        {read<double>(_file), read<double>(_file), 0.0}};
+    _header.cell_size = read<double>(_file);
+    _header.no_data = read<double>(_file);
+    if (!_file || _tile_size == 0)
+    {
+        throw std::runtime_error("Could not read the header of the raster tile "
+                                 "file '" +
+                                 file_name + "'.");
+    }
+    _n_tile_cols = numberOfTiles(_header.n_cols, _tile_size);
+}
+
+double RasterTiles::getValue(std::size_t const row, std::size_t const col) const
+{
+    std::lock_guard const lock(_mutex);
+    auto const& tile = getTile(row / _tile_size * _n_tile_cols +
+                               col / _tile_size);
+    return tile.values[(row % _tile_size) * _tile_size + col % _tile_size];
+}
+
+RasterTiles::Tile const& RasterTiles::getTile(std::size_t const index) const
+{
+    if (auto const it = _tile_positions.find(index);
+        it != _tile_positions.end())
+    {
+        _tiles.splice(_tiles.begin(), _tiles, it->second);
+        return _tiles.front();
+    }
+
+    // Reuse the memory of the least recently used tile if the cache is full.
+    if (_tiles.size() >= _max_cached_tiles)
+    {
+        _tile_positions.erase(_tiles.back().index);
+        _tiles.splice(_tiles.begin(), _tiles, std::prev(_tiles.end()));
+    }
+    else
+    {
+        _tiles.emplace_front();
+    }
+
+    auto& tile = _tiles.front();
+    tile.index = index;
+    tile.values.resize(_tile_size * _tile_size);
+    _file.seekg(tileOffset(index, _tile_size));
+    _file.read(reinterpret_cast<char*>(tile.values.data()),
+               static_cast<std::streamsize>(tile.values.size() *
+                                            sizeof(double)));
+    if (!_file)
+    {
+        OGS_FATAL("Could not read tile {:d} of the raster tile file.", index);
+    }
+    _tile_positions[index] = _tiles.begin();
+    return tile;
+}
+
+RasterTilesWriter::RasterTilesWriter(std::string const& file_name,
+                                     RasterHeader header,
+                                     std::size_t const tile_size)
+    : _header(std::move(header)),
+      _tile_size(tile_size),
+      _n_tile_cols(numberOfTiles(_header.n_cols, tile_size)),
+      _file(file_name, std::ios::binary),
+      _tile_row_values(_tile_size * _n_tile_cols * _tile_size,
+                       _header.no_data)
+{
+    if (!_file)
+    {
+        throw std::runtime_error("Could not open raster tile file '" +
+                                 file_name + "' for writing.");
+    }
+    _file.write(magic.data(), magic.size());
+    write<std::uint64_t>(_file, version);
+    write<std::uint64_t>(_file, _tile_size);
+    write<std::uint64_t>(_file, _header.n_cols);
+    write<std::uint64_t>(_file, _header.n_rows);
+    write<double>(_file, _header.origin[0]);
+    write<double>(_file, _header.origin[1]);
+    write<double>(_file, _header.cell_size);
+    write<double>(_file, _header.no_data);
+}
+
+void RasterTilesWriter::addRow(std::span<double const> const row)
+{
+    if (row.size() != _header.n_cols)
+    {
+        OGS_FATAL("Expected {:d} values for a raster row, got {:d}.",
+                  _header.n_cols, row.size());
+    }
+    if (_n_added_rows >= _header.n_rows)
+    {
+        OGS_FATAL("All {:d} raster rows have already been added.",
+                  _header.n_rows);
+    }
+
+    // Row counted from the bottom of the raster.
+    std::size_t const raster_row = _header.n_rows - 1 - _n_added_rows;
+    std::size_t const row_in_tile = raster_row % _tile_size;
+    std::copy(row.begin(), row.end(),
+              _tile_row_values.begin() +
+                  row_in_tile * _n_tile_cols * _tile_size);
+    ++_n_added_rows;
+
+    // The rows are added from the top, so the bottom row completes a row of
+    // tiles.
+    if (row_in_tile == 0)
+    {
+        writeTileRow(raster_row / _tile_size);
+    }
+}
+
+void RasterTilesWriter::writeTileRow(std::size_t const tile_row)
+{
+    std::size_t const row_length = _n_tile_cols * _tile_size;
+    _file.seekp(tileOffset(tile_row * _n_tile_cols, _tile_size));
+    for (std::size_t tile_col = 0; tile_col < _n_tile_cols; ++tile_col)
+    {
+        for (std::size_t r = 0; r < _tile_size; ++r)
+        {
+            _file.write(reinterpret_cast<char const*>(
+                            &_tile_row_values[r * row_length +
+                                              tile_col * _tile_size]),
+                        static_cast<std::streamsize>(_tile_size *
+                                                     sizeof(double)));
+        }
+    }
+    std::fill(_tile_row_values.begin(), _tile_row_values.end(),
+              _header.no_data);
+}
+
+void RasterTilesWriter::finish()
+{
+    if (_n_added_rows != _header.n_rows)
+    {
+        OGS_FATAL("Only {:d} of {:d} raster rows have been added.",
+                  _n_added_rows, _header.n_rows);
+    }
+    _file.close();
+    if (!_file)
+    {
+        OGS_FATAL("Could not write the raster tile file.");
+    }
+}
+
+void writeRasterTiles(Raster const& raster, std::string const& file_name,
+                      std::size_t const tile_size)
+{
+    auto const& header = raster.getHeader();
+    RasterTilesWriter writer(file_name, header, tile_size);
+    std::vector<double> row(header.n_cols);
+    for (std::size_t r = 0; r < header.n_rows; ++r)
+    {
+        // Raster::operator() counts the rows from the top.
+        for (std::size_t c = 0; c < header.n_cols; ++c)
+        {
+            row[c] = raster(r, c);
+        }
+        writer.addRow(row);
+    }
+    writer.finish();
+}
+}  // namespace GeoLib
@@ -0,0 +1,108 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Raster.h"
+
+namespace GeoLib
+{
+/// Raster values stored in a binary file of square tiles.
+///
+/// The file starts with a fixed-size header, see RasterTilesWriter, followed
+/// by the tiles in row-major order starting at the lower left tile. Each tile
+/// holds tile_size x tile_size values in row-major order starting at its lower
+/// left pixel. Tiles at the upper and right raster boundary are padded with the
+/// no data value.
+///
+/// Tiles are read on first access and kept in a small least recently used
+/// cache, so only a fraction of a large raster is held in memory.
+class RasterTiles final
+{
+public:
+    static constexpr std::size_t default_tile_size = 256;
+    static constexpr std::size_t default_max_cached_tiles = 64;
+
+    /// Opens the tile file and reads its header. Throws std::runtime_error if
+    /// the file is not a valid tile file.
+    explicit RasterTiles(
+        std::string const& file_name,
+        std::size_t max_cached_tiles = default_max_cached_tiles);
+
+    RasterHeader const& getHeader() const { return _header; }
+
+    /// Returns the value of the pixel in the given row, counted from the
+    /// bottom of the raster, and column. The indices are not checked.
+    double getValue(std::size_t row, std::size_t col) const;
+
+private:
+    struct Tile
+    {
+        std::size_t index;
+        std::vector<double> values;
+    };
+
+    Tile const& getTile(std::size_t index) const;
+
+    RasterHeader _header;
+    std::size_t _tile_size;
+    std::size_t _n_tile_cols;
+    std::size_t _max_cached_tiles;
+
+    mutable std::mutex _mutex;
+    mutable std::ifstream _file;
+    /// Cached tiles, most recently used first.
+    mutable std::list<Tile> _tiles;
+    mutable std::unordered_map<std::size_t, std::list<Tile>::iterator>
+        _tile_positions;
+};
+
+/// Writes a tile file for RasterTiles row by row, without holding more than
+/// one row of tiles in memory.
+class RasterTilesWriter final
+{
+public:
+    /// Opens the file and writes the header. Throws std::runtime_error if the
+    /// file cannot be written.
+    RasterTilesWriter(std::string const& file_name, RasterHeader header,
+                      std::size_t tile_size = RasterTiles::default_tile_size);
+
+    /// Adds the values of the next raster row. The rows are given from the top
+    /// to the bottom of the raster, i.e., in the order of an ASC file.
+    void addRow(std::span<double const> row);
+
+    /// Checks that all rows have been added and closes the file.
+    void finish();
+
+private:
+    void writeTileRow(std::size_t tile_row);
+
+    RasterHeader const _header;
+    std::size_t const _tile_size;
+    std::size_t const _n_tile_cols;
+    std::ofstream _file;
+    /// Number of rows added so far.
+    std::size_t _n_added_rows = 0;
+    /// Values of the current row of tiles, stored as a tile_size x
+    /// (n_tile_cols * tile_size) matrix starting with its bottom row.
+    std::vector<double> _tile_row_values;
+};
+
+/// Writes the given raster to a tile file for RasterTiles.
+void writeRasterTiles(Raster const& raster, std::string const& file_name,
+                      std::size_t tile_size = RasterTiles::default_tile_size);
+}  // namespace GeoLib
@@ -9,7 +9,12 @@
 
 #include "MaterialLib/MPL/Properties/Function.h"
 
+#include <array>
+#include <exprtk.hpp>
 #include <numeric>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "BaseLib/Algorithm.h"
 
@@ -83,11 +88,18 @@ static PropertyDataType evaluateExpressions(
 {
     updateVariableValues(symbol_values, variable_array);
 
-    std::vector<double> result(expressions.size());
+    // At most a 3x3 matrix is returned; avoids a heap allocation in every
+    // evaluation.
+    std::array<double, 9> result;
+    if (expressions.size() > result.size())
+    {
+        OGS_FATAL("Cannot convert a vector of size {} to a PropertyDataType",
+                  expressions.size());
+    }
     std::transform(begin(expressions), end(expressions), begin(result),
                    [](auto const& e) { return e.value(); });
 
-    switch (result.size())
+    switch (expressions.size())
     {
         case 1:
         {
@@ -117,7 +129,7 @@ static PropertyDataType evaluateExpressions(
         }
     }
     OGS_FATAL("Cannot convert a vector of size {} to a PropertyDataType",
-              result.size());
+              expressions.size());
 }
 
 static std::vector<std::string> collectVariables(
@@ -148,49 +160,126 @@ static std::vector<std::string> collectVariables(
     return variables;
 }
 
+struct Function::Evaluator
+{
+    using Expression = exprtk::expression<double>;
+
+    Evaluator(
+        std::vector<std::string> const& variables,
+        std::vector<std::string> const& value_string_expressions,
+        std::vector<std::pair<std::string, std::vector<std::string>>> const&
+            dvalue_string_expressions)
+    {
+        // Create symbol table for used variables.
+        for (auto const& v : variables)
+        {
+            symbol_table.create_variable(v);
+            // Store variables index in the variable array and the pointer to
+            // the value in the symbol table for fast access later.
+            int const variable_array_index =
+                static_cast<int>(convertStringToVariable(v));
+            symbol_values.emplace_back(variable_array_index,
+                                       &symbol_table.get_variable(v)->ref());
+        }
+
+        // value expressions.
+        value_expressions =
+            compileExpressions(symbol_table, value_string_expressions);
+
+        // dValue expressions.
+        for (auto const& [variable_name, string_expressions] :
+             dvalue_string_expressions)
+        {
+            dvalue_expressions.emplace_back(
+                convertStringToVariable(variable_name),
+                compileExpressions(symbol_table, string_expressions));
+        }
+    }
+
+    exprtk::symbol_table<double> symbol_table;
+    /// Mapping from variable array index to symbol table values.
+    std::vector<std::pair<int, double*>> symbol_values;
+    /// Value expressions.
+    /// Multiple expressions are representing vector-valued functions.
+    std::vector<Expression> value_expressions;
+    /// Derivative expressions with respect to the variable.
+    /// Multiple expressions are representing vector-valued functions.
+    std::vector<std::pair<Variable, std::vector<Expression>>>
+        dvalue_expressions;
+};
+
 Function::Function(
     std::string name,
     std::vector<std::string> const& value_string_expressions,
     std::vector<std::pair<std::string, std::vector<std::string>>> const&
         dvalue_string_expressions)
+    : variables_(collectVariables(value_string_expressions,
+                                  dvalue_string_expressions)),
+      value_string_expressions_(value_string_expressions),
+      dvalue_string_expressions_(dvalue_string_expressions)
 {
     name_ = std::move(name);
 
-    // Create symbol table for used variables.
-    exprtk::symbol_table<double> symbol_table;
+    // Compiled here to report errors in the expressions while reading the
+    // project file.
+    shared_evaluator_ = createEvaluator();
+}
 
-    for (auto const& v :
-         collectVariables(value_string_expressions, dvalue_string_expressions))
-    {
-        symbol_table.create_variable(v);
-        // Store variables index in the variable array and the pointer to the
-        // value in the symbol table for fast access later.
-        int const variable_array_index =
-            static_cast<int>(convertStringToVariable(v));
-        symbol_values_.emplace_back(variable_array_index,
-                                    &symbol_table.get_variable(v)->ref());
-    }
+Function::~Function() = default;
 
-    // value expressions.
-    value_expressions_ =
-        compileExpressions(symbol_table, value_string_expressions);
+std::unique_ptr<Function::Evaluator> Function::createEvaluator() const
+{
+    // The expressions share their nodes with copies, so they are compiled
+    // anew for each evaluator.
+    return std::make_unique<Evaluator>(variables_, value_string_expressions_,
+                                       dvalue_string_expressions_);
+}
 
-    // dValue expressions.
-    for (auto const& [variable_name, string_expressions] :
-         dvalue_string_expressions)
+template <typename Evaluate>
+PropertyDataType Function::evaluate(Evaluate&& evaluate) const
+{
+#ifdef _OPENMP
+    // The thread numbers are only unique within the innermost active parallel
+    // region.
+    if (omp_get_active_level() == 1)
     {
-        dvalue_expressions_.emplace_back(
-            convertStringToVariable(variable_name),
-            compileExpressions(symbol_table, string_expressions));
+        auto const thread_number =
+            static_cast<std::size_t>(omp_get_thread_num());
+        Evaluator* evaluator;
+        {
+            // The evaluators are created on first use, because the number of
+            // threads of a parallel region is not known in advance.
+            std::lock_guard<std::mutex> lock(evaluators_mutex_);
+            if (thread_number >= evaluators_.size())
+            {
+                evaluators_.resize(thread_number + 1);
+            }
+            if (!evaluators_[thread_number])
+            {
+                evaluators_[thread_number] = createEvaluator();
+            }
+            evaluator = evaluators_[thread_number].get();
+        }
+        // Only the calling thread uses its evaluator, which is not moved when
+        // the vector grows.
+        return evaluate(*evaluator);
     }
+#endif
+
+    std::lock_guard<std::mutex> lock(shared_evaluator_mutex_);
+    return evaluate(*shared_evaluator_);
 }
 
 PropertyDataType Function::value(VariableArray const& variable_array,
                                  ParameterLib::SpatialPosition const& /*pos*/,
                                  double const /*t*/, double const /*dt*/) const
 {
-    return evaluateExpressions(symbol_values_, variable_array,
-                               value_expressions_);
+    return evaluate(
+        [&](Evaluator const& evaluator)
+        {
+            return evaluateExpressions(evaluator.symbol_values, variable_array,
+                                       evaluator.value_expressions);
+        });
 }
 
 PropertyDataType Function::dValue(VariableArray const& variable_array,
@@ -198,20 +287,28 @@ PropertyDataType Function::dValue(VariableArray const& variable_array,
                                   ParameterLib::SpatialPosition const& /*pos*/,
                                   double const /*t*/, double const /*dt*/) const
 {
-    auto const it = std::find_if(begin(dvalue_expressions_),
-                                 end(dvalue_expressions_),
-                                 [&primary_variable](auto const& v)
-                                 { return v.first == primary_variable; });
+    return evaluate(
+        [&](Evaluator const& evaluator)
+        {
+            auto const& dvalue_expressions = evaluator.dvalue_expressions;
+            auto const it =
+                std::find_if(begin(dvalue_expressions), end(dvalue_expressions),
+                             [&primary_variable](auto const& v)
+                             { return v.first == primary_variable; });
 
-    if (it == end(dvalue_expressions_))
-    {
-        OGS_FATAL(
-            "Requested derivative with respect to the variable {:s} not "
-            "provided for Function-type property {:s}.",
-            variable_enum_to_string[static_cast<int>(primary_variable)], name_);
-    }
+            if (it == end(dvalue_expressions))
+            {
+                OGS_FATAL(
+                    "Requested derivative with respect to the variable {:s} "
+                    "not provided for Function-type property {:s}.",
+                    variable_enum_to_string[static_cast<int>(
+                        primary_variable)],
+                    name_);
+            }
 
-    return evaluateExpressions(symbol_values_, variable_array, it->second);
+            return evaluateExpressions(evaluator.symbol_values, variable_array,
+                                       it->second);
+        });
 }
 
 }  // namespace MaterialPropertyLib
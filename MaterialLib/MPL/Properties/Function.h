@@ -8,7 +8,9 @@
  */
 #pragma once
 
-#include <exprtk.hpp>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -21,8 +23,11 @@ namespace MaterialPropertyLib
 /// of the expressions the exprtk library is used. In the expressions all
 /// variables defined in MaterialPropertyLib::Variable enum can be used.
 ///
-/// \warning The evaluation calls are not to be used in parallel (openMP),
-/// because the values' updates are using the same space.
+/// The exprtk expressions are bound to the values of a symbol table, which are
+/// overwritten in every evaluation. Therefore the expressions are compiled for
+/// each OpenMP thread separately and each thread evaluates its own copy, such
+/// that the evaluation can be called concurrently from a parallel assembly.
+/// Concurrent calls from other threads are serialized.
 class Function final : public Property
 {
 public:
@@ -32,6 +37,8 @@ public:
         std::vector<std::pair<std::string, std::vector<std::string>>> const&
             dvalue_string_expressions);
 
+    ~Function() override;
+
     PropertyDataType value(VariableArray const& variable_array,
                            ParameterLib::SpatialPosition const& pos,
                            double const t,
@@ -44,16 +51,30 @@ public:
                             double const dt) const override;
 
 private:
-    using Expression = exprtk::expression<double>;
-
-    /// Mapping from variable array index to symbol table values.
-    std::vector<std::pair<int, double*>> symbol_values_;
-    /// Value expressions.
-    /// Multiple expressions are representing vector-valued functions.
-    std::vector<Expression> value_expressions_;
-    /// Derivative expressions with respect to the variable.
-    /// Multiple expressions are representing vector-valued functions.
-    std::vector<std::pair<Variable, std::vector<Expression>>>
-        dvalue_expressions_;
+    /// Symbol table and the value and derivative expressions compiled for it.
+    struct Evaluator;
+
+    std::unique_ptr<Evaluator> createEvaluator() const;
+
+    /// Calls \c evaluate with the evaluator of the calling OpenMP thread.
+    /// Outside of parallel regions, e.g. in serial assembly or when called from
+    /// other threads, and in nested parallel regions a mutex protected
+    /// evaluator is used.
+    template <typename Evaluate>
+    PropertyDataType evaluate(Evaluate&& evaluate) const;
+
+    /// The variables and expressions from which the evaluators are compiled.
+    std::vector<std::string> const variables_;
+    std::vector<std::string> const value_string_expressions_;
+    std::vector<std::pair<std::string, std::vector<std::string>>> const
+        dvalue_string_expressions_;
+
+    /// Evaluators indexed by the OpenMP thread number. Created on first use
+    /// by the respective thread.
+    mutable std::vector<std::unique_ptr<Evaluator>> evaluators_;
+    mutable std::mutex evaluators_mutex_;
+    /// Evaluator used outside of OpenMP parallel regions.
+    std::unique_ptr<Evaluator> shared_evaluator_;
+    mutable std::mutex shared_evaluator_mutex_;
 };
 }  // namespace MaterialPropertyLib
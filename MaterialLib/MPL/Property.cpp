@@ -141,6 +141,15 @@ PropertyDataType Property::d2Value(VariableArray const& /*variable_array*/,
     return 0.0;
 }
 
+void Property::reportTypeMismatch(char const* const what,
+                                  char const* const requested_type,
+                                  std::size_t const type_index) const
+{
+    OGS_FATAL("The {:s} of {:s} is not of the requested type '{:s}' but a {:s}.",
+              what, description(), requested_type,
+              property_data_type_names_[type_index]);
+}
+
 std::string Property::description() const
 {
     return "property '" + name_ + "' defined for " +
@@ -120,40 +120,16 @@ public:
     T initialValue(ParameterLib::SpatialPosition const& pos,
                    double const t) const
     {
-        try
-        {
-            return std::get<T>(initialValue(pos, t));
-        }
-        catch (std::bad_variant_access const&)
-        {
-            OGS_FATAL(
-                "The initial value of {:s} does not hold requested type '{:s}' "
-                "but a {:s}.",
-                description(),
-                typeid(T).name(),
-                property_data_type_names_[initialValue(pos, t).index()]);
-        }
+        return get<T>(initialValue(pos, t), "initial value");
     }
 
     template <typename T>
     T value() const
     {
-        try
-        {
 #ifndef NDEBUG
-            property_used = true;
+        property_used = true;
 #endif
-            return std::get<T>(value());
-        }
-        catch (std::bad_variant_access const&)
-        {
-            OGS_FATAL(
-                "The value of {:s} does not hold requested type '{:s}' but a "
-                "{:s}.",
-                description(),
-                typeid(T).name(),
-                property_data_type_names_[value().index()]);
-        }
+        return get<T>(value(), "value");
     }
 
     template <typename T>
@@ -162,48 +138,21 @@ public:
             ParameterLib::SpatialPosition const& pos, double const t,
             double const dt) const
     {
-        try
-        {
 #ifndef NDEBUG
-            property_used = true;
+        property_used = true;
 #endif
-            return std::get<T>(
-                value(variable_array, variable_array_prev, pos, t, dt));
-        }
-        catch (std::bad_variant_access const&)
-        {
-            OGS_FATAL(
-                "The value of {:s} is not of the requested type '{:s}' but a "
-                "{:s}.",
-                description(),
-                typeid(T).name(),
-                property_data_type_names_[value(variable_array,
-                                                variable_array_prev, pos, t, dt)
-                                              .index()]);
-        }
+        return get<T>(value(variable_array, variable_array_prev, pos, t, dt),
+                      "value");
     }
     template <typename T>
     T value(VariableArray const& variable_array,
             ParameterLib::SpatialPosition const& pos, double const t,
             double const dt) const
     {
-        try
-        {
 #ifndef NDEBUG
-            property_used = true;
+        property_used = true;
 #endif
-            return std::get<T>(value(variable_array, pos, t, dt));
-        }
-        catch (std::bad_variant_access const&)
-        {
-            OGS_FATAL(
-                "The value of {:s} is not of the requested type '{:s}' but a "
-                "{:s}.",
-                description(),
-                typeid(T).name(),
-                property_data_type_names_[value(variable_array, pos, t, dt)
-                                              .index()]);
-        }
+        return get<T>(value(variable_array, pos, t, dt), "value");
     }
 
     template <typename T>
@@ -212,47 +161,23 @@ public:
              ParameterLib::SpatialPosition const& pos, double const t,
              double const dt) const
     {
-        try
-        {
 #ifndef NDEBUG
-            property_used = true;
+        property_used = true;
 #endif
-            return std::get<T>(dValue(variable_array, variable_array_prev,
-                                      variable, pos, t, dt));
-        }
-        catch (std::bad_variant_access const&)
-        {
-            OGS_FATAL(
-                "The first derivative value of {:s} is not of the requested "
-                "type '{:s}' but a {:s}.",
-                description(),
-                typeid(T).name(),
-                property_data_type_names_
-                    [dValue(variable_array, variable, pos, t, dt).index()]);
-        }
+        return get<T>(dValue(variable_array, variable_array_prev, variable,
+                             pos, t, dt),
+                      "first derivative value");
     }
     template <typename T>
     T dValue(VariableArray const& variable_array, Variable const variable,
              ParameterLib::SpatialPosition const& pos, double const t,
              double const dt) const
     {
-        try
-        {
 #ifndef NDEBUG
-            property_used = true;
+        property_used = true;
 #endif
-            return std::get<T>(dValue(variable_array, variable, pos, t, dt));
-        }
-        catch (std::bad_variant_access const&)
-        {
-            OGS_FATAL(
-                "The first derivative value of {:s} is not of the requested "
-                "type '{:s}' but a {:s}.",
-                description(),
-                typeid(T).name(),
-                property_data_type_names_
-                    [dValue(variable_array, variable, pos, t, dt).index()]);
-        }
+        return get<T>(dValue(variable_array, variable, pos, t, dt),
+                      "first derivative value");
     }
     template <typename T>
     T d2Value(VariableArray const& variable_array, Variable const& variable1,
@@ -260,25 +185,12 @@ public:
               ParameterLib::SpatialPosition const& pos, double const t,
               double const dt) const
     {
-        try
-        {
 #ifndef NDEBUG
-            property_used = true;
+        property_used = true;
 #endif
-            return std::get<T>(
-                d2Value(variable_array, variable1, variable2, pos, t, dt));
-        }
-        catch (std::bad_variant_access const&)
-        {
-            OGS_FATAL(
-                "The second derivative value of {:s} is not of the requested "
-                "type '{:s}' but a {:s}.",
-                description(),
-                typeid(T).name(),
-                property_data_type_names_[d2Value(variable_array, variable1,
-                                                  variable2, pos, t, dt)
-                                              .index()]);
-        }
+        return get<T>(
+            d2Value(variable_array, variable1, variable2, pos, t, dt),
+            "second derivative value");
     }
 
 protected:
@@ -298,6 +210,23 @@ private:
         // medium, phase or component
     }
     std::string description() const;
+
+    /// Extracts the requested type from the given value without the
+    /// exception handling of std::get, which is comparably costly on the hot
+    /// path of the assembly.
+    template <typename T>
+    T get(PropertyDataType&& value, char const* const what) const
+    {
+        if (auto* const v = std::get_if<T>(&value))
+        {
+            return std::move(*v);
+        }
+        reportTypeMismatch(what, typeid(T).name(), value.index());
+    }
+
+    [[noreturn]] void reportTypeMismatch(char const* what,
+                                         char const* requested_type,
+                                         std::size_t type_index) const;
 #ifndef NDEBUG
     mutable bool property_used = false;
 #endif
@@ -0,0 +1,89 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <optional>
+#include <type_traits>
+#include <variant>
+
+#include "Properties/Constant.h"
+#include "Property.h"
+
+namespace MaterialPropertyLib
+{
+/// Typed access to a property, which is resolved once, e.g. on construction of
+/// a local assembler, instead of looking the property up in the medium and
+/// checking the type of its value for every evaluation.
+///
+/// The values of constant properties holding a value of type \c T are stored
+/// in the handle; their evaluation requires neither a virtual function call
+/// nor a variant access.
+template <typename T>
+class PropertyHandle final
+{
+public:
+    explicit PropertyHandle(Property const& property) : property_(&property)
+    {
+        auto const* const constant = dynamic_cast<Constant const*>(&property);
+        if (constant != nullptr &&
+            std::holds_alternative<T>(constant->value()))
+        {
+            constant_value_ = constant->template value<T>();
+        }
+    }
+
+    Property const& property() const { return *property_; }
+
+    T value(VariableArray const& variable_array,
+            VariableArray const& variable_array_prev,
+            ParameterLib::SpatialPosition const& pos, double const t,
+            double const dt) const
+    {
+        if (constant_value_)
+        {
+            return *constant_value_;
+        }
+        return property_->template value<T>(variable_array,
+                                            variable_array_prev, pos, t, dt);
+    }
+
+    T value(VariableArray const& variable_array,
+            ParameterLib::SpatialPosition const& pos, double const t,
+            double const dt) const
+    {
+        if (constant_value_)
+        {
+            return *constant_value_;
+        }
+        return property_->template value<T>(variable_array, pos, t, dt);
+    }
+
+    T dValue(VariableArray const& variable_array, Variable const variable,
+             ParameterLib::SpatialPosition const& pos, double const t,
+             double const dt) const
+    {
+        if constexpr (std::is_same_v<T, double>)
+        {
+            // The derivatives of constant properties vanish.
+            if (constant_value_)
+            {
+                return 0.;
+            }
+        }
+        return property_->template dValue<T>(variable_array, variable, pos, t,
+                                             dt);
+    }
+
+private:
+    Property const* property_;
+    std::optional<T> constant_value_;
+};
+}  // namespace MaterialPropertyLib
@@ -32,14 +32,12 @@ double getCreepConstantCoefficient(const double A, const double n,
 
 template <int DisplacementDim>
 std::optional<std::tuple<typename CreepBGRa<DisplacementDim>::KelvinVector,
-                         std::unique_ptr<typename MechanicsBase<
-                             DisplacementDim>::MaterialStateVariables>,
                          typename CreepBGRa<DisplacementDim>::KelvinMatrix>>
 CreepBGRa<DisplacementDim>::integrateStress(
     MaterialPropertyLib::VariableArray const& variable_array_prev,
     MaterialPropertyLib::VariableArray const& variable_array, double const t,
     ParameterLib::SpatialPosition const& x, double const dt,
-    typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
+    typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
     /*material_state_variables*/) const
 {
     auto const& eps_m = std::get<MPL::SymmetricTensor<DisplacementDim>>(
@@ -68,7 +66,7 @@ CreepBGRa<DisplacementDim>::integrateStress(
     // In case |s_{try}| is zero and _n < 3 (rare case).
     if (norm_s_try < std::numeric_limits<double>::epsilon() * C(0, 0))
     {
-        return {std::make_tuple(sigma_try, createMaterialStateVariables(), C)};
+        return {std::make_tuple(sigma_try, C)};
     }
 
     ResidualVectorType solution = sigma_try;
@@ -135,8 +133,7 @@ CreepBGRa<DisplacementDim>::integrateStress(
     KelvinMatrix tangentStiffness =
         (*success_iterations == 0) ? C : linear_solver.solve(C);
 
-    return {std::make_tuple(solution, createMaterialStateVariables(),
-                            tangentStiffness)};
+    return {std::make_tuple(solution, tangentStiffness)};
 }
 
 template <int DisplacementDim>
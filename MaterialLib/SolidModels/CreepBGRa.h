@@ -75,15 +75,11 @@ public:
     {
     }
 
-    std::optional<std::tuple<KelvinVector,
-                             std::unique_ptr<typename MechanicsBase<
-                                 DisplacementDim>::MaterialStateVariables>,
-                             KelvinMatrix>>
-    integrateStress(
+    std::optional<std::tuple<KelvinVector, KelvinMatrix>> integrateStress(
         MaterialPropertyLib::VariableArray const& variable_array_prev,
         MaterialPropertyLib::VariableArray const& variable_array,
         double const t, ParameterLib::SpatialPosition const& x, double const dt,
-        typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
+        typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
             material_state_variables) const override;
 
     ConstitutiveModel getConstitutiveModel() const override
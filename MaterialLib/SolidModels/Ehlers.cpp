@@ -511,14 +511,12 @@ double SolidEhlers<DisplacementDim>::computeFreeEnergyDensity(
 
 template <int DisplacementDim>
 std::optional<std::tuple<typename SolidEhlers<DisplacementDim>::KelvinVector,
-                         std::unique_ptr<typename MechanicsBase<
-                             DisplacementDim>::MaterialStateVariables>,
                          typename SolidEhlers<DisplacementDim>::KelvinMatrix>>
 SolidEhlers<DisplacementDim>::integrateStress(
     MaterialPropertyLib::VariableArray const& variable_array_prev,
     MaterialPropertyLib::VariableArray const& variable_array, double const t,
     ParameterLib::SpatialPosition const& x, double const dt,
-    typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
+    typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
         material_state_variables) const
 {
     auto const& eps_m = std::get<MPL::SymmetricTensor<DisplacementDim>>(
@@ -529,12 +527,11 @@ SolidEhlers<DisplacementDim>::integrateStress(
     auto const& sigma_prev = std::get<MPL::SymmetricTensor<DisplacementDim>>(
         variable_array_prev[static_cast<int>(MPL::Variable::stress)]);
 
-    assert(dynamic_cast<StateVariables<DisplacementDim> const*>(
+    assert(dynamic_cast<StateVariables<DisplacementDim>*>(
                &material_state_variables) != nullptr);
 
-    StateVariables<DisplacementDim> state =
-        static_cast<StateVariables<DisplacementDim> const&>(
-            material_state_variables);
+    auto& state =
+        static_cast<StateVariables<DisplacementDim>&>(material_state_variables);
     state.setInitialConditions();
 
     using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
@@ -698,13 +695,7 @@ SolidEhlers<DisplacementDim>::integrateStress(
 
     KelvinVector sigma_final = mp.G * sigma;
 
-    return {std::make_tuple(
-        sigma_final,
-        std::unique_ptr<
-            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
-            new StateVariables<DisplacementDim>{
-                static_cast<StateVariables<DisplacementDim> const&>(state)}},
-        tangentStiffness)};
+    return {std::make_tuple(sigma_final, tangentStiffness)};
 }
 
 template <int DisplacementDim>
@@ -87,15 +87,13 @@ public:
 
     std::optional<
         std::tuple<typename MechanicsBase<DisplacementDim>::KelvinVector,
-                   std::unique_ptr<typename MechanicsBase<
-                       DisplacementDim>::MaterialStateVariables>,
                    typename MechanicsBase<DisplacementDim>::KelvinMatrix>>
     integrateStress(
         MaterialPropertyLib::VariableArray const& variable_array_prev,
         MaterialPropertyLib::VariableArray const& variable_array,
         double const t, ParameterLib::SpatialPosition const& x,
         double const /*dt*/,
-        typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
+        typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
             material_state_variables) const override;
 
     KelvinMatrix getElasticTensor(double const t,
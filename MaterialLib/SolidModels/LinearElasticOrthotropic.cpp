@@ -21,15 +21,13 @@ namespace Solids
 {
 template <int DisplacementDim>
 std::optional<std::tuple<typename MechanicsBase<DisplacementDim>::KelvinVector,
-                         std::unique_ptr<typename MechanicsBase<
-                             DisplacementDim>::MaterialStateVariables>,
                          typename MechanicsBase<DisplacementDim>::KelvinMatrix>>
 LinearElasticOrthotropic<DisplacementDim>::integrateStress(
     MaterialPropertyLib::VariableArray const& variable_array_prev,
     MaterialPropertyLib::VariableArray const& variable_array, double const t,
     ParameterLib::SpatialPosition const& x, double const /*dt*/,
     typename MechanicsBase<DisplacementDim>::
-        MaterialStateVariables const& /*material_state_variables*/) const
+        MaterialStateVariables& /*material_state_variables*/) const
 {
     auto const& eps_m = std::get<MPL::SymmetricTensor<DisplacementDim>>(
         variable_array[static_cast<int>(MPL::Variable::mechanical_strain)]);
@@ -45,11 +43,7 @@ LinearElasticOrthotropic<DisplacementDim>::integrateStress(
 
     KelvinVector sigma = sigma_prev + C * (eps_m - eps_m_prev);
 
-    return {std::make_tuple(
-        sigma,
-        std::make_unique<
-            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>(),
-        C)};
+    return {std::make_tuple(sigma, C)};
 }
 
 template <int DisplacementDim>
@@ -67,14 +67,12 @@ MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> tangentStiffnessA(
 
 template <int DisplacementDim>
 std::optional<std::tuple<typename Lubby2<DisplacementDim>::KelvinVector,
-                         std::unique_ptr<typename MechanicsBase<
-                             DisplacementDim>::MaterialStateVariables>,
                          typename Lubby2<DisplacementDim>::KelvinMatrix>>
 Lubby2<DisplacementDim>::integrateStress(
     MaterialPropertyLib::VariableArray const& variable_array_prev,
     MaterialPropertyLib::VariableArray const& variable_array, double const t,
     ParameterLib::SpatialPosition const& x, double const dt,
-    typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
+    typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
         material_state_variables) const
 {
     auto const& eps_m = std::get<MPL::SymmetricTensor<DisplacementDim>>(
@@ -87,10 +85,9 @@ Lubby2<DisplacementDim>::integrateStress(
 
     using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
 
-    assert(dynamic_cast<MaterialStateVariables const*>(
-               &material_state_variables) != nullptr);
-    MaterialStateVariables state(
-        static_cast<MaterialStateVariables const&>(material_state_variables));
+    assert(dynamic_cast<MaterialStateVariables*>(&material_state_variables) !=
+           nullptr);
+    auto& state = static_cast<MaterialStateVariables&>(material_state_variables);
     state.setInitialConditions();
 
     auto local_lubby2_properties =
@@ -203,12 +200,7 @@ Lubby2<DisplacementDim>::integrateStress(
         (local_lubby2_properties.KM0 * delta_eps_m_trace +
          sigma_trace_prev / 3.) *
             Invariants::identity2;
-    return {std::make_tuple(
-        sigma,
-        std::unique_ptr<
-            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
-            new MaterialStateVariables{state}},
-        C)};
+    return {std::make_tuple(sigma, C)};
 }
 
 template <int DisplacementDim>
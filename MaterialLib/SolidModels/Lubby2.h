@@ -192,8 +192,8 @@ public:
     {
         assert(dynamic_cast<MaterialStateVariables const*>(
                    &material_state_variables) != nullptr);
-        MaterialStateVariables state(static_cast<MaterialStateVariables const&>(
-            material_state_variables));
+        auto const& state = static_cast<MaterialStateVariables const&>(
+            material_state_variables);
 
         auto const& eps_K = state.eps_K_j;
         auto const& eps_K_prev = state.eps_K_t;
@@ -230,15 +230,11 @@ public:
         return _mp.KM0(t, x)[0];
     }
 
-    std::optional<std::tuple<KelvinVector,
-                             std::unique_ptr<typename MechanicsBase<
-                                 DisplacementDim>::MaterialStateVariables>,
-                             KelvinMatrix>>
-    integrateStress(
+    std::optional<std::tuple<KelvinVector, KelvinMatrix>> integrateStress(
         MaterialPropertyLib::VariableArray const& variable_array_prev,
         MaterialPropertyLib::VariableArray const& variable_array,
         double const t, ParameterLib::SpatialPosition const& x, double const dt,
-        typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
+        typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
             material_state_variables) const override;
 
 private:
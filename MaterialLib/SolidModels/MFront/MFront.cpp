@@ -259,10 +259,21 @@ MFront<DisplacementDim>::createMaterialStateVariables() const
         equivalent_plastic_strain_offset_, _behaviour);
 }
 
+template <int DisplacementDim>
+typename MFront<DisplacementDim>::KelvinMatrix
+MFront<DisplacementDim>::rotationMatrix(
+    ParameterLib::SpatialPosition const& x) const
+{
+    if (!_local_coordinate_system)
+    {
+        return KelvinMatrix::Identity();
+    }
+    return MathLib::KelvinVector::fourthOrderRotationMatrix(
+        _local_coordinate_system->transformation<DisplacementDim>(x));
+}
+
 template <int DisplacementDim>
 std::optional<std::tuple<typename MFront<DisplacementDim>::KelvinVector,
-                         std::unique_ptr<typename MechanicsBase<
-                             DisplacementDim>::MaterialStateVariables>,
                          typename MFront<DisplacementDim>::KelvinMatrix>>
 MFront<DisplacementDim>::integrateStress(
     MPL::VariableArray const& variable_array_prev,
@@ -270,17 +281,18 @@ MFront<DisplacementDim>::integrateStress(
     double const t,
     ParameterLib::SpatialPosition const& x,
     double const dt,
-    typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
+    typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
         material_state_variables) const
 {
     using namespace MathLib::KelvinVector;
 
-    assert(
-        dynamic_cast<MaterialStateVariables const*>(&material_state_variables));
-    // New state, copy of current one, packed in unique_ptr for return.
-    auto state = std::make_unique<MaterialStateVariables>(
-        static_cast<MaterialStateVariables const&>(material_state_variables));
-    auto& behaviour_data = state->_behaviour_data;
+    assert(dynamic_cast<MaterialStateVariables*>(&material_state_variables));
+    // The state at the end of the time step (s1) is overwritten in place; the
+    // state of the previous time step (s0) is only modified by
+    // pushBackState().
+    auto& behaviour_data =
+        static_cast<MaterialStateVariables&>(material_state_variables)
+            ._behaviour_data;
 
     // TODO add a test of material behaviour where the value of dt matters.
     behaviour_data.dt = dt;
@@ -330,16 +342,7 @@ MFront<DisplacementDim>::integrateStress(
             variable_array[static_cast<int>(MPL::Variable::temperature)]);
     }
 
-    // rotation tensor
-    auto const Q = [this, &x]() -> KelvinMatrixType<DisplacementDim>
-    {
-        if (!_local_coordinate_system)
-        {
-            return KelvinMatrixType<DisplacementDim>::Identity();
-        }
-        return fourthOrderRotationMatrix(
-            _local_coordinate_system->transformation<DisplacementDim>(x));
-    }();
+    auto const Q = rotationMatrix(x);
 
     auto const& eps_m_prev = std::get<MPL::SymmetricTensor<DisplacementDim>>(
         variable_array_prev[static_cast<int>(
@@ -409,10 +412,235 @@ MFront<DisplacementDim>::integrateStress(
 
     return std::make_optional(
         std::make_tuple<typename MFront<DisplacementDim>::KelvinVector,
-                        std::unique_ptr<typename MechanicsBase<
-                            DisplacementDim>::MaterialStateVariables>,
                         typename MFront<DisplacementDim>::KelvinMatrix>(
-            std::move(sigma), std::move(state), std::move(C)));
+            std::move(sigma), std::move(C)));
+}
+
+template <int DisplacementDim>
+MFront<DisplacementDim>::BatchStateVariables::BatchStateVariables(
+    mgis::behaviour::Behaviour const& b,
+    std::size_t const n,
+    int const number_of_threads)
+    : _material_data{b, static_cast<mgis::size_type>(n)},
+      _material_properties(b.mps.size() * n),
+      _temperature_prev(n),
+      _temperature(n)
+{
+    using StorageMode = mgis::behaviour::MaterialStateManager::StorageMode;
+
+    // The values are owned by this object and only referenced by MGIS, such
+    // that they can be updated without any lookup by name.
+    for (std::size_t k = 0; k < b.mps.size(); ++k)
+    {
+        auto const& mp = b.mps[k];
+        if (mp.type != mgis::behaviour::Variable::SCALAR)
+        {
+            OGS_FATAL(
+                "The batched MFront integration supports scalar material "
+                "properties only, but '{:s}' is of type {:s}.",
+                mp.name, varTypeToString(mp.type));
+        }
+
+        mgis::span<mgis::real> const values{_material_properties.data() + k * n,
+                                            n};
+        mgis::behaviour::setMaterialProperty(_material_data.s0, mp.name,
+                                             values,
+                                             StorageMode::EXTERNAL_STORAGE);
+        mgis::behaviour::setMaterialProperty(_material_data.s1, mp.name,
+                                             values,
+                                             StorageMode::EXTERNAL_STORAGE);
+    }
+
+    if (!b.esvs.empty())
+    {
+        // assuming that there is only temperature
+        mgis::behaviour::setExternalStateVariable(
+            _material_data.s0, b.esvs[0].name,
+            mgis::span<mgis::real>{_temperature_prev.data(), n},
+            StorageMode::EXTERNAL_STORAGE);
+        mgis::behaviour::setExternalStateVariable(
+            _material_data.s1, b.esvs[0].name,
+            mgis::span<mgis::real>{_temperature.data(), n},
+            StorageMode::EXTERNAL_STORAGE);
+    }
+
+    if (number_of_threads > 1)
+    {
+        _thread_pool = std::make_unique<mgis::ThreadPool>(
+            static_cast<mgis::size_type>(number_of_threads));
+    }
+}
+
+template <int DisplacementDim>
+std::unique_ptr<typename MFront<DisplacementDim>::BatchStateVariables>
+MFront<DisplacementDim>::createBatchStateVariables(
+    std::size_t const n, int const number_of_threads) const
+{
+    return std::make_unique<BatchStateVariables>(_behaviour, n,
+                                                 number_of_threads);
+}
+
+template <int DisplacementDim>
+std::unique_ptr<typename MechanicsBase<DisplacementDim>::MaterialStateVariables>
+MFront<DisplacementDim>::createBatchMaterialStateVariables(
+    BatchStateVariables& state, std::size_t const i) const
+{
+    assert(i < state.size());
+    return std::make_unique<BatchMaterialStateVariables>(
+        equivalent_plastic_strain_offset_, state, i);
+}
+
+template <int DisplacementDim>
+void MFront<DisplacementDim>::setBatchInitialState(
+    BatchStateVariables& state,
+    std::size_t const i,
+    ParameterLib::SpatialPosition const& x,
+    KelvinVector const& eps_m_prev,
+    KelvinVector const& sigma_prev) const
+{
+    assert(i < state.size());
+
+    auto const Q = rotationMatrix(x);
+    auto& s0 = state._material_data.s0;
+    auto& s1 = state._material_data.s1;
+
+    KelvinVector const eps_prev_local = Q.transpose() * eps_m_prev;
+    auto const eps_prev_MFront = OGSToMFront(eps_prev_local);
+    std::copy_n(eps_prev_MFront.data(), KelvinVector::SizeAtCompileTime,
+                s0.gradients.data() + i * s0.gradients_stride);
+
+    KelvinVector const sigma_prev_local = Q.transpose() * sigma_prev;
+    auto const sigma_prev_MFront = OGSToMFront(sigma_prev_local);
+    std::copy_n(
+        sigma_prev_MFront.data(), KelvinVector::SizeAtCompileTime,
+        s0.thermodynamic_forces.data() + i * s0.thermodynamic_forces_stride);
+    std::copy_n(
+        sigma_prev_MFront.data(), KelvinVector::SizeAtCompileTime,
+        s1.thermodynamic_forces.data() + i * s1.thermodynamic_forces_stride);
+}
+
+template <int DisplacementDim>
+void MFront<DisplacementDim>::integrateStressBatch(
+    std::span<ParameterLib::SpatialPosition const> const x,
+    double const t,
+    double const dt,
+    std::span<KelvinVector const> const eps_m,
+    std::span<double const> const T_prev,
+    std::span<double const> const T,
+    BatchStateVariables& state,
+    std::span<KelvinVector> const sigma,
+    std::span<KelvinMatrix> const C) const
+{
+    auto const n = state.size();
+    assert(x.size() == n);
+    assert(eps_m.size() == n);
+    assert(sigma.size() == n);
+    assert(C.size() == n);
+
+    auto& m = state._material_data;
+
+    // evaluate parameters at (t, x); all material properties are scalar.
+    for (std::size_t k = 0; k < _material_properties.size(); ++k)
+    {
+        auto const& mp = *_material_properties[k];
+        std::span<double> const values{
+            state._material_properties.data() + k * n, n};
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            mp.evaluate(t, x[i], values.subspan(i, 1));
+        }
+    }
+
+    if (!_behaviour.esvs.empty())
+    {
+        assert(T_prev.size() == n);
+        assert(T.size() == n);
+        std::copy(T_prev.begin(), T_prev.end(),
+                  state._temperature_prev.begin());
+        std::copy(T.begin(), T.end(), state._temperature.begin());
+    }
+
+    // Only the current strains are copied in; the strains and stresses of the
+    // previous time step are already stored in s0.
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        KelvinVector const eps_local =
+            rotationMatrix(x[i]).transpose() * eps_m[i];
+        auto const eps_MFront = OGSToMFront(eps_local);
+        std::copy_n(eps_MFront.data(), KelvinVector::SizeAtCompileTime,
+                    m.s1.gradients.data() + i * m.s1.gradients_stride);
+    }
+
+    auto const integration_type = mgis::behaviour::IntegrationType::
+        INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    int const status =
+        state._thread_pool
+            ? mgis::behaviour::integrate(*state._thread_pool, m,
+                                         integration_type, dt)
+                  .exit_status
+            : mgis::behaviour::integrate(m, integration_type, dt, 0, m.n)
+                  .exit_status;
+    if (status != 1)
+    {
+        throw NumLib::AssemblyException(
+            "MFront: batched integration failed with status" +
+            std::to_string(status) + ".");
+    }
+
+    if (m.K_stride !=
+        KelvinMatrix::RowsAtCompileTime * KelvinMatrix::ColsAtCompileTime)
+        OGS_FATAL("Stiffness matrix has wrong size.");
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        auto const Q = rotationMatrix(x[i]);
+
+        KelvinVector sigma_MFront;
+        std::copy_n(m.s1.thermodynamic_forces.data() +
+                        i * m.s1.thermodynamic_forces_stride,
+                    KelvinVector::SizeAtCompileTime, sigma_MFront.data());
+        sigma[i] = Q * MFrontToOGS(sigma_MFront);
+
+        C[i] = Q *
+               MFrontToOGS(
+                   Eigen::Map<KelvinMatrix>(m.K.data() + i * m.K_stride)) *
+               Q.transpose();
+    }
+}
+
+/// The current internal state variables of an integration point, which are
+/// stored either in its own state or in a batch.
+template <int DisplacementDim>
+std::span<double> currentInternalStateVariables(
+    typename MechanicsBase<DisplacementDim>::MaterialStateVariables& state)
+{
+    using BatchMaterialStateVariables =
+        typename MFront<DisplacementDim>::BatchMaterialStateVariables;
+    using MaterialStateVariables =
+        typename MFront<DisplacementDim>::MaterialStateVariables;
+
+    if (auto const* const batch_state =
+            dynamic_cast<BatchMaterialStateVariables const*>(&state))
+    {
+        return batch_state->internalStateVariables();
+    }
+
+    assert(dynamic_cast<MaterialStateVariables const*>(&state) != nullptr);
+    auto& internal_state_variables =
+        static_cast<MaterialStateVariables&>(state)
+            ._behaviour_data.s1.internal_state_variables;
+    return {internal_state_variables.data(), internal_state_variables.size()};
+}
+
+template <int DisplacementDim>
+std::span<double const> currentInternalStateVariables(
+    typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
+        state)
+{
+    return currentInternalStateVariables<DisplacementDim>(
+        const_cast<
+            typename MechanicsBase<DisplacementDim>::MaterialStateVariables&>(
+            state));
 }
 
 template <int DisplacementDim>
@@ -441,11 +669,8 @@ MFront<DisplacementDim>::getInternalVariables() const
                     DisplacementDim>::MaterialStateVariables const& state,
                 std::vector<double>& cache) -> std::vector<double> const&
             {
-                assert(dynamic_cast<MaterialStateVariables const*>(&state) !=
-                       nullptr);
-                auto const& internal_state_variables =
-                    static_cast<MaterialStateVariables const&>(state)
-                        ._behaviour_data.s1.internal_state_variables;
+                auto const internal_state_variables =
+                    currentInternalStateVariables<DisplacementDim>(state);
 
                 cache.resize(size);
                 std::copy_n(internal_state_variables.data() + offset,
@@ -457,11 +682,8 @@ MFront<DisplacementDim>::getInternalVariables() const
                 typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
                     state) -> BaseLib::DynamicSpan<double>
             {
-                assert(dynamic_cast<MaterialStateVariables const*>(&state) !=
-                       nullptr);
-                auto& internal_state_variables =
-                    static_cast<MaterialStateVariables&>(state)
-                        ._behaviour_data.s1.internal_state_variables;
+                auto const internal_state_variables =
+                    currentInternalStateVariables<DisplacementDim>(state);
 
                 return {internal_state_variables.data() + offset, size};
             }};
@@ -517,6 +739,19 @@ double MFront<
     return 0.0;
 }
 
+template <int DisplacementDim>
+double MFront<DisplacementDim>::BatchMaterialStateVariables::
+    getEquivalentPlasticStrain() const
+{
+    if (equivalent_plastic_strain_offset_ >= 0)
+    {
+        return internalStateVariables()[static_cast<std::size_t>(
+            equivalent_plastic_strain_offset_)];
+    }
+
+    return 0.0;
+}
+
 template class MFront<2>;
 template class MFront<3>;
 
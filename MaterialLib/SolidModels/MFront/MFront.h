@@ -13,6 +13,9 @@
 
 #include <MGIS/Behaviour/Behaviour.hxx>
 #include <MGIS/Behaviour/BehaviourData.hxx>
+#include <MGIS/Behaviour/MaterialDataManager.hxx>
+#include <MGIS/ThreadPool.hxx>
+#include <span>
 
 #include "ParameterLib/Parameter.h"
 
@@ -66,6 +69,71 @@ public:
         double getEquivalentPlasticStrain() const override;
     };
 
+    /// State of many integration points, e.g. of one element or of the whole
+    /// mesh, stored in contiguous arrays by MGIS' MaterialDataManager. The
+    /// state of the previous time step is kept in the arrays of s0, the
+    /// current state in the arrays of s1.
+    struct BatchStateVariables
+    {
+        BatchStateVariables(mgis::behaviour::Behaviour const& b,
+                            std::size_t const n, int const number_of_threads);
+
+        BatchStateVariables(BatchStateVariables const&) = delete;
+        BatchStateVariables(BatchStateVariables&&) = delete;
+
+        void pushBackState() { mgis::behaviour::update(_material_data); }
+
+        std::size_t size() const { return _material_data.n; }
+
+        mgis::behaviour::MaterialDataManager _material_data;
+
+        /// Values of the material properties, one block of size() values for
+        /// each material property. Referenced by the material data manager.
+        std::vector<double> _material_properties;
+        /// Temperatures at the beginning and at the end of the time step.
+        /// Referenced by the material data manager if the behaviour has
+        /// temperature as an external state variable.
+        std::vector<double> _temperature_prev;
+        std::vector<double> _temperature;
+
+        /// Thread pool for MGIS' parallel integration. Only created if more
+        /// than one thread is requested.
+        std::unique_ptr<mgis::ThreadPool> _thread_pool;
+    };
+
+    /// State of the \c i-th integration point of a batch. Unlike
+    /// MaterialStateVariables it holds no data of its own, but refers to the
+    /// batch, which is updated as a whole by
+    /// BatchStateVariables::pushBackState().
+    struct BatchMaterialStateVariables final
+        : public MechanicsBase<DisplacementDim>::MaterialStateVariables
+    {
+        BatchMaterialStateVariables(int const equivalent_plastic_strain_offset,
+                                    BatchStateVariables& state,
+                                    std::size_t const i)
+            : equivalent_plastic_strain_offset_(
+                  equivalent_plastic_strain_offset),
+              _state(state),
+              _i(i)
+        {
+        }
+
+        /// The current internal state variables of the integration point.
+        std::span<double> internalStateVariables() const
+        {
+            auto& s1 = _state._material_data.s1;
+            auto const stride =
+                static_cast<std::size_t>(s1.internal_state_variables_stride);
+            return {s1.internal_state_variables.data() + _i * stride, stride};
+        }
+
+        int const equivalent_plastic_strain_offset_;
+        BatchStateVariables& _state;
+        std::size_t const _i;
+
+        double getEquivalentPlasticStrain() const override;
+    };
+
     using KelvinVector =
         MathLib::KelvinVector::KelvinVectorType<DisplacementDim>;
     using KelvinMatrix =
@@ -81,19 +149,55 @@ public:
         typename MechanicsBase<DisplacementDim>::MaterialStateVariables>
     createMaterialStateVariables() const override;
 
-    std::optional<std::tuple<KelvinVector,
-                             std::unique_ptr<typename MechanicsBase<
-                                 DisplacementDim>::MaterialStateVariables>,
-                             KelvinMatrix>>
-    integrateStress(
+    std::optional<std::tuple<KelvinVector, KelvinMatrix>> integrateStress(
         MaterialPropertyLib::VariableArray const& variable_array_prev,
         MaterialPropertyLib::VariableArray const& variable_array,
         double const t,
         ParameterLib::SpatialPosition const& x,
         double const dt,
-        typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
+        typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
             material_state_variables) const override;
 
+    /// Creates the state of \c n integration points for the batched
+    /// integration in integrateStressBatch(). If \c number_of_threads is
+    /// greater than one, MGIS' multi-threaded integration is used.
+    std::unique_ptr<BatchStateVariables> createBatchStateVariables(
+        std::size_t const n, int const number_of_threads) const;
+
+    /// Creates the state of the \c i-th integration point of the batch, which
+    /// gives access to its internal state variables, e.g. for output.
+    std::unique_ptr<
+        typename MechanicsBase<DisplacementDim>::MaterialStateVariables>
+    createBatchMaterialStateVariables(BatchStateVariables& state,
+                                      std::size_t const i) const;
+
+    /// Sets the strain and stress of the previous time step of the \c i-th
+    /// integration point of the batch, e.g. from initial conditions.
+    void setBatchInitialState(BatchStateVariables& state,
+                              std::size_t const i,
+                              ParameterLib::SpatialPosition const& x,
+                              KelvinVector const& eps_m_prev,
+                              KelvinVector const& sigma_prev) const;
+
+    /// Integrates the stress of all integration points of the batch at once.
+    ///
+    /// Unlike integrateStress() only the current mechanical strains \c eps_m
+    /// and temperatures \c T are passed in; the strains and stresses of the
+    /// previous time step are kept in \c state. The computed stresses and
+    /// tangents are written to \c sigma and \c C, which must have the size
+    /// of the batch. \c T_prev and \c T are ignored by behaviours without
+    /// temperature as external state variable.
+    void integrateStressBatch(
+        std::span<ParameterLib::SpatialPosition const> const x,
+        double const t,
+        double const dt,
+        std::span<KelvinVector const> const eps_m,
+        std::span<double const> const T_prev,
+        std::span<double const> const T,
+        BatchStateVariables& state,
+        std::span<KelvinVector> const sigma,
+        std::span<KelvinMatrix> const C) const;
+
     std::vector<typename MechanicsBase<DisplacementDim>::InternalVariable>
     getInternalVariables() const override;
 
@@ -111,6 +215,9 @@ public:
             material_state_variables) const override;
 
 private:
+    /// Rotation from the local coordinate system to the global one.
+    KelvinMatrix rotationMatrix(ParameterLib::SpatialPosition const& x) const;
+
     mgis::behaviour::Behaviour _behaviour;
     int const equivalent_plastic_strain_offset_;
     std::vector<ParameterLib::Parameter<double> const*> _material_properties;
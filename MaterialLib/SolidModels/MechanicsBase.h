@@ -80,17 +80,24 @@ struct MechanicsBase
     /// This should be implemented in the derived model. Fixed Kelvin vector and
     /// matrix size version; for dynamic size arguments there is an overloaded
     /// wrapper function.
-    /// Returns nothing in case of errors in the computation if Newton
-    /// iterations did not converge, for example.
-    virtual std::optional<std::tuple<
-        KelvinVector, std::unique_ptr<MaterialStateVariables>, KelvinMatrix>>
+    ///
+    /// The material state variables are updated in place. They keep the state
+    /// of the previous time step, which is stored by pushBackState(), next to
+    /// the current state. The current state is computed from the previous one
+    /// in every call, such that the state objects can be allocated once per
+    /// integration point and are reused in all iterations.
+    ///
+    /// Returns the stress and the tangent or nothing in case of errors in the
+    /// computation if Newton iterations did not converge, for example. Then
+    /// the current state is undefined, but the previous state is unchanged.
+    virtual std::optional<std::tuple<KelvinVector, KelvinMatrix>>
     integrateStress(
         MaterialPropertyLib::VariableArray const& variable_array_prev,
         MaterialPropertyLib::VariableArray const& variable_array,
         double const t,
         ParameterLib::SpatialPosition const& x,
         double const dt,
-        MaterialStateVariables const& material_state_variables) const = 0;
+        MaterialStateVariables& material_state_variables) const = 0;
 
     /// Helper type for providing access to internal variables.
     struct InternalVariable
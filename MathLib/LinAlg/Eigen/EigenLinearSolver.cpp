@@ -11,6 +11,8 @@
 #include "EigenLinearSolver.h"
 
 #include <Eigen/Sparse>
+#include <algorithm>
+#include <vector>
 
 #include "BaseLib/Logging.h"
 
@@ -44,11 +46,65 @@ public:
     //! Solves the linear equation system \f$ A x = b \f$ for \f$ x \f$.
     virtual bool solve(Matrix& A, Vector const& b, Vector& x,
                        EigenOption& opt) = 0;
+
+    EigenLinearSolverStatistics statistics;
 };
 
 namespace details
 {
+/// Keeps a copy of the sparsity pattern of a compressed matrix in order to
+/// detect changes of the pattern between subsequent solves.
+class SparsityPatternTracker
+{
+public:
+    using Matrix = EigenMatrix::RawMatrixType;
+
+    /// Stores the sparsity pattern of \c A and returns true if it differs
+    /// from the previously stored one.
+    bool update(Matrix const& A)
+    {
+        assert(A.isCompressed());
+        auto const* const outer = A.outerIndexPtr();
+        auto const* const inner = A.innerIndexPtr();
+        auto const outer_size = A.outerSize() + 1;
+        auto const non_zeros = A.nonZeros();
+
+        if (A.rows() == rows_ && A.cols() == cols_ &&
+            std::equal(outer, outer + outer_size, outer_.begin(),
+                       outer_.end()) &&
+            std::equal(inner, inner + non_zeros, inner_.begin(), inner_.end()))
+        {
+            return false;
+        }
+
+        rows_ = A.rows();
+        cols_ = A.cols();
+        outer_.assign(outer, outer + outer_size);
+        inner_.assign(inner, inner + non_zeros);
+        return true;
+    }
+
+    /// Forgets the stored pattern, such that the next update() reports a
+    /// change.
+    void reset()
+    {
+        rows_ = -1;
+        outer_.clear();
+        inner_.clear();
+    }
+
+private:
+    Eigen::Index rows_ = -1;
+    Eigen::Index cols_ = -1;
+    std::vector<Matrix::StorageIndex> outer_;
+    std::vector<Matrix::StorageIndex> inner_;
+};
+
 /// Template class for Eigen direct linear solvers
+///
+/// The symbolic analysis (the fill-reducing ordering) is only repeated if the
+/// sparsity pattern of the matrix has changed since the last solve; otherwise
+/// only the numerical factorization is computed.
 template <class T_SOLVER>
 class EigenDirectLinearSolver final : public EigenLinearSolverBase
 {
@@ -62,9 +118,19 @@ public:
             A.makeCompressed();
         }
 
-        solver_.compute(A);
+        if (sparsity_pattern_.update(A))
+        {
+            DBUG("-> analyze sparsity pattern");
+            solver_.analyzePattern(A);
+            ++statistics.pattern_analyses;
+        }
+
+        // Errors of the analysis are reported by the factorization, too.
+        solver_.factorize(A);
+        ++statistics.factorizations;
         if (solver_.info() != Eigen::Success)
         {
+            sparsity_pattern_.reset();
             ERR("Failed during Eigen linear solver initialization");
             return false;
         }
@@ -81,6 +147,7 @@ public:
 
 private:
     T_SOLVER solver_;
+    SparsityPatternTracker sparsity_pattern_;
 };
 
 // implementations for some iterative linear solver methods --------------------
@@ -180,6 +247,9 @@ void setResidualUpdateImpl(Eigen::IDRS<Matrix, Precon>& solver,
 // -----------------------------------------------------------------------------
 
 /// Template class for Eigen iterative linear solvers
+///
+/// The preconditioner can be kept for several subsequent solves, see
+/// EigenOption::reuse_preconditioner.
 template <class T_SOLVER>
 class EigenIterativeLinearSolver final : public EigenLinearSolverBase
 {
@@ -207,28 +277,108 @@ public:
             A.makeCompressed();
         }
 
-        solver_.compute(A);
-        if (solver_.info() != Eigen::Success)
+        bool const reuse = canReusePreconditioner(A, opt);
+        bool preconditioner_recomputed = !reuse;
+        if (reuse)
+        {
+            INFO("-> reuse preconditioner ({:d}/{:d})",
+                 solves_with_preconditioner_, opt.reuse_preconditioner);
+            ++statistics.preconditioner_reuses;
+        }
+        else if (!computePreconditioner(A, opt))
         {
-            ERR("Failed during Eigen linear solver initialization");
             return false;
         }
 
+        // Initial guess for a second attempt if the reused preconditioner
+        // does not work anymore.
+        Vector const x_initial = reuse ? x : Vector{};
+
         x = solver_.solveWithGuess(b, x);
+        ++solves_with_preconditioner_;
         INFO("\t iteration: {:d}/{:d}", solver_.iterations(),
              opt.max_iterations);
         INFO("\t residual: {:e}\n", solver_.error());
 
+        if (reuse && solver_.info() != Eigen::Success)
+        {
+            INFO("-> solve again with recomputed preconditioner");
+            if (!computePreconditioner(A, opt))
+            {
+                return false;
+            }
+            preconditioner_recomputed = true;
+            x = solver_.solveWithGuess(b, x_initial);
+            ++solves_with_preconditioner_;
+            INFO("\t iteration: {:d}/{:d}", solver_.iterations(),
+                 opt.max_iterations);
+            INFO("\t residual: {:e}\n", solver_.error());
+        }
+
         if (solver_.info() != Eigen::Success)
         {
             ERR("Failed during Eigen linear solve");
             return false;
         }
 
+        if (preconditioner_recomputed)
+        {
+            iterations_with_new_preconditioner_ = solver_.iterations();
+        }
+        else if (solver_.iterations() >
+                 convergence_degradation_factor *
+                     std::max(iterations_with_new_preconditioner_,
+                              Eigen::Index{1}))
+        {
+            DBUG(
+                "-> convergence has degraded, the preconditioner will be "
+                "recomputed");
+            solves_with_preconditioner_ = opt.reuse_preconditioner + 1;
+        }
+
         return true;
     }
 
 private:
+    /// A reused preconditioner is recomputed if the number of iterations
+    /// exceeds the number of iterations of the solve right after the
+    /// preconditioner's computation by this factor.
+    static constexpr Eigen::Index convergence_degradation_factor = 2;
+
+    /// The preconditioner is reused if allowed by the options and if the
+    /// matrix is the same object with the same storage and sparsity pattern
+    /// as in the last computation, because the solver keeps a reference to
+    /// the matrix' storage.
+    bool canReusePreconditioner(Matrix const& A, EigenOption const& opt)
+    {
+        if (solves_with_preconditioner_ > opt.reuse_preconditioner ||
+            &A != matrix_ || A.valuePtr() != matrix_values_)
+        {
+            return false;
+        }
+        return !sparsity_pattern_.update(A);
+    }
+
+    bool computePreconditioner(Matrix const& A, EigenOption const& opt)
+    {
+        solver_.compute(A);
+        ++statistics.preconditioner_computations;
+        solves_with_preconditioner_ = 0;
+        matrix_ = &A;
+        matrix_values_ = A.valuePtr();
+        if (opt.reuse_preconditioner > 0)
+        {
+            sparsity_pattern_.update(A);
+        }
+        if (solver_.info() != Eigen::Success)
+        {
+            matrix_ = nullptr;
+            ERR("Failed during Eigen linear solver initialization");
+            return false;
+        }
+        return true;
+    }
+
     T_SOLVER solver_;
     void setRestart(int const restart) { setRestartImpl(solver_, restart); }
     void setL(int const l) { setLImpl(solver_, l); }
@@ -242,6 +392,14 @@ private:
     {
         setResidualUpdateImpl(solver_, residual_update);
     }
+
+    /// Matrix and its value storage the preconditioner has been computed for.
+    Matrix const* matrix_ = nullptr;
+    double const* matrix_values_ = nullptr;
+    SparsityPatternTracker sparsity_pattern_;
+    /// Number of solves since the last computation of the preconditioner.
+    int solves_with_preconditioner_ = 0;
+    Eigen::Index iterations_with_new_preconditioner_ = 0;
 };
 
 template <template <typename, typename> class Solver, typename Precon>
@@ -394,6 +552,11 @@ EigenLinearSolver::EigenLinearSolver(std::string const& /*solver_name*/,
 
 EigenLinearSolver::~EigenLinearSolver() = default;
 
+EigenLinearSolverStatistics const& EigenLinearSolver::getStatistics() const
+{
+    return solver_->statistics;
+}
+
 bool EigenLinearSolver::solve(EigenMatrix& A, EigenVector& b, EigenVector& x)
 {
     INFO("------------------------------------------------------------------");
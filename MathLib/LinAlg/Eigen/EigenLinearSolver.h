@@ -22,6 +22,20 @@ class EigenVector;
 
 class EigenLinearSolverBase;
 
+/// Numbers of the expensive setup steps done by an EigenLinearSolver since its
+/// construction.
+struct EigenLinearSolverStatistics
+{
+    /// Symbolic analyses of the sparsity pattern by direct solvers.
+    int pattern_analyses = 0;
+    /// Numerical factorizations by direct solvers.
+    int factorizations = 0;
+    /// Preconditioner computations by iterative solvers.
+    int preconditioner_computations = 0;
+    /// Solves of iterative solvers with a reused preconditioner.
+    int preconditioner_reuses = 0;
+};
+
 class EigenLinearSolver final
 {
 public:
@@ -48,6 +62,10 @@ public:
 
     bool solve(EigenMatrix& A, EigenVector& b, EigenVector& x);
 
+    /// Returns how often the factorization or the preconditioner has been
+    /// (re)computed or reused.
+    EigenLinearSolverStatistics const& getStatistics() const;
+
 protected:
     EigenOption option_;
     std::unique_ptr<EigenLinearSolverBase> solver_;
@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "EigenMatrix.h"
+
+namespace MathLib
+{
+EigenMatrix::ColumnEntries const& EigenMatrix::getColumnEntries()
+{
+    if (!mat_.isCompressed())
+    {
+        mat_.makeCompressed();
+    }
+
+    auto const n_rows = mat_.rows();
+    auto const* const outer = mat_.outerIndexPtr();
+    auto& entries = column_entries_;
+    if (entries.column_begin.size() ==
+            static_cast<std::size_t>(mat_.cols()) + 1 &&
+        std::equal(outer, outer + n_rows + 1, entries.outer_index.begin(),
+                   entries.outer_index.end()))
+    {
+        return entries;
+    }
+
+    // Counting sort of the entries by column; the rows stay in ascending
+    // order within each column.
+    auto const* const inner = mat_.innerIndexPtr();
+    auto const non_zeros = static_cast<StorageIndex>(mat_.nonZeros());
+
+    entries.column_begin.assign(mat_.cols() + 1, 0);
+    for (StorageIndex p = 0; p < non_zeros; ++p)
+    {
+        entries.column_begin[inner[p] + 1]++;
+    }
+    for (Eigen::Index c = 0; c < mat_.cols(); ++c)
+    {
+        entries.column_begin[c + 1] += entries.column_begin[c];
+    }
+
+    entries.rows.resize(non_zeros);
+    entries.positions.resize(non_zeros);
+    std::vector<StorageIndex> next(entries.column_begin.begin(),
+                                   entries.column_begin.end() - 1);
+    for (Eigen::Index row = 0; row < n_rows; ++row)
+    {
+        for (StorageIndex p = outer[row]; p < outer[row + 1]; ++p)
+        {
+            auto const i = next[inner[p]]++;
+            entries.rows[i] = static_cast<StorageIndex>(row);
+            entries.positions[i] = p;
+        }
+    }
+
+    entries.outer_index.assign(outer, outer + n_rows + 1);
+    return entries;
+}
+}  // namespace MathLib
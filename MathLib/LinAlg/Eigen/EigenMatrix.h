@@ -11,8 +11,13 @@
 #pragma once
 
 #include <Eigen/Sparse>
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
+#include <limits>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "EigenVector.h"
 #include "MathLib/LinAlg/RowColumnIndices.h"
@@ -31,6 +36,14 @@ public:
     using RawMatrixType = Eigen::SparseMatrix<double, Eigen::RowMajor>;
     using IndexType = RawMatrixType::Index;
 
+    /// Caches the locations of the entries of a dense sub-matrix in the sparse
+    /// storage, see add(RowColumnIndices, T_DENSE_MATRIX, ScatterMap&). For
+    /// each entry, stored row-wise, the rank of its column among the non-zero
+    /// columns of its row is kept. The ranks are independent of whether the
+    /// matrix is compressed or not, so one scatter map can be shared by all
+    /// matrices of the same sparsity pattern.
+    using ScatterMap = std::vector<std::uint16_t>;
+
     // TODO The matrix constructor should take num_rows and num_cols as
     // arguments
     //      that is left for a later refactoring.
@@ -127,6 +140,28 @@ public:
              std::vector<IndexType> const& col_pos,
              const T_DENSE_MATRIX& sub_matrix, double fkt = 1.0);
 
+    /// Add sub-matrix at positions given by \c indices using and updating the
+    /// entry locations cached in \c scatter_map. Each cached location is
+    /// checked against the current sparsity pattern before it is used, so the
+    /// scatter map stays valid even if the pattern changes in between; then
+    /// the entry is searched and the scatter map updated. If the entry doesn't
+    /// exist, this class inserts the value.
+    template <class T_DENSE_MATRIX>
+    void add(RowColumnIndices<IndexType> const& indices,
+             T_DENSE_MATRIX const& sub_matrix, ScatterMap& scatter_map);
+
+    /// Like add(RowColumnIndices, T_DENSE_MATRIX, ScatterMap&), but only the
+    /// entries which are already part of the sparsity pattern are updated.
+    /// The values for all other entries are appended to \c missing_entries
+    /// instead of being inserted. The storage of the matrix is never
+    /// reallocated, so this method can be called concurrently as long as the
+    /// calls touch disjoint sets of rows.
+    template <class T_DENSE_MATRIX>
+    void addToExistingEntries(
+        RowColumnIndices<IndexType> const& indices,
+        T_DENSE_MATRIX const& sub_matrix, ScatterMap& scatter_map,
+        std::vector<Eigen::Triplet<double, IndexType>>& missing_entries);
+
     /// get value. This function returns zero if the element doesn't exist.
     double get(IndexType row, IndexType col) const
     {
@@ -162,8 +197,76 @@ public:
     RawMatrixType& getRawMatrix() { return mat_; }
     const RawMatrixType& getRawMatrix() const { return mat_; }
 
+    using StorageIndex = RawMatrixType::StorageIndex;
+
+    /// The transposed sparsity pattern of the compressed matrix: the rows and
+    /// the locations in the value array of the entries of each column, in
+    /// ascending row order.
+    struct ColumnEntries
+    {
+        /// Start of each column in \c rows and \c positions; one more entry
+        /// than columns.
+        std::vector<StorageIndex> column_begin;
+        std::vector<StorageIndex> rows;
+        std::vector<StorageIndex> positions;
+
+        /// Copy of the row starts of the matrix the entries were computed
+        /// for, used to detect changes of the sparsity pattern.
+        std::vector<StorageIndex> outer_index;
+    };
+
+    /// Returns the column entries of the matrix, which is compressed if
+    /// necessary. The entries are computed on the first call and recomputed
+    /// only if the number of entries of some row has changed. Entries are
+    /// never removed from the matrix, so any change of the pattern changes
+    /// the row sizes.
+    ColumnEntries const& getColumnEntries();
+
 protected:
     RawMatrixType mat_;
+
+private:
+    ColumnEntries column_entries_;
+
+    /// Returns the first location and the number of the entries of the given
+    /// row in the index and value arrays.
+    std::pair<StorageIndex, StorageIndex> rowRange(IndexType const row) const
+    {
+        auto const begin = mat_.outerIndexPtr()[row];
+        // Only present in uncompressed mode.
+        auto const* const inner_non_zeros = mat_.innerNonZeroPtr();
+        return {begin, inner_non_zeros
+                           ? inner_non_zeros[row]
+                           : mat_.outerIndexPtr()[row + 1] - begin};
+    }
+
+    /// Returns the location of the entry in column \c col of the row given by
+    /// its \c row_range in the index and value arrays or -1 if the entry is
+    /// not part of the sparsity pattern. The \c rank of the column within the
+    /// row is tried first and updated if the entry had to be searched.
+    StorageIndex findEntry(
+        std::pair<StorageIndex, StorageIndex> const row_range,
+        IndexType const col, std::uint16_t& rank) const
+    {
+        auto const [begin, row_size] = row_range;
+        StorageIndex const* const first = mat_.innerIndexPtr() + begin;
+        if (rank < row_size && first[rank] == col)
+        {
+            return begin + rank;
+        }
+
+        // The column indices within a row are sorted.
+        auto const* const last = first + row_size;
+        auto const* const it =
+            std::lower_bound(first, last, static_cast<StorageIndex>(col));
+        if (it == last || *it != col)
+        {
+            return -1;
+        }
+        rank = static_cast<std::uint16_t>(std::min<std::ptrdiff_t>(
+            it - first, std::numeric_limits<std::uint16_t>::max()));
+        return begin + static_cast<StorageIndex>(it - first);
+    }
 };
 
 template <class T_DENSE_MATRIX>
@@ -184,6 +287,78 @@ void EigenMatrix::add(std::vector<IndexType> const& row_pos,
     }
 };
 
+template <class T_DENSE_MATRIX>
+void EigenMatrix::add(RowColumnIndices<IndexType> const& indices,
+                      T_DENSE_MATRIX const& sub_matrix,
+                      ScatterMap& scatter_map)
+{
+    auto const n_rows = indices.rows.size();
+    auto const n_cols = indices.columns.size();
+    if (scatter_map.size() != n_rows * n_cols)
+    {
+        scatter_map.assign(n_rows * n_cols,
+                           std::numeric_limits<std::uint16_t>::max());
+    }
+
+    auto* rank = scatter_map.data();
+    for (auto i = decltype(n_rows){0}; i < n_rows; i++)
+    {
+        auto const row = indices.rows[i];
+        auto row_range = rowRange(row);
+        for (auto j = decltype(n_cols){0}; j < n_cols; j++, rank++)
+        {
+            auto const col = indices.columns[j];
+            auto const position = findEntry(row_range, col, *rank);
+            if (position >= 0)
+            {
+                mat_.valuePtr()[position] += sub_matrix(i, j);
+            }
+            else
+            {
+                // Inserts the entry; the rank is set on the next call.
+                mat_.coeffRef(row, col) += sub_matrix(i, j);
+                row_range = rowRange(row);
+            }
+        }
+    }
+}
+
+template <class T_DENSE_MATRIX>
+void EigenMatrix::addToExistingEntries(
+    RowColumnIndices<IndexType> const& indices,
+    T_DENSE_MATRIX const& sub_matrix, ScatterMap& scatter_map,
+    std::vector<Eigen::Triplet<double, IndexType>>& missing_entries)
+{
+    auto const n_rows = indices.rows.size();
+    auto const n_cols = indices.columns.size();
+    if (scatter_map.size() != n_rows * n_cols)
+    {
+        scatter_map.assign(n_rows * n_cols,
+                           std::numeric_limits<std::uint16_t>::max());
+    }
+
+    auto* const values = mat_.valuePtr();
+    auto* rank = scatter_map.data();
+    for (auto i = decltype(n_rows){0}; i < n_rows; i++)
+    {
+        auto const row = indices.rows[i];
+        auto const row_range = rowRange(row);
+        for (auto j = decltype(n_cols){0}; j < n_cols; j++, rank++)
+        {
+            auto const col = indices.columns[j];
+            auto const position = findEntry(row_range, col, *rank);
+            if (position >= 0)
+            {
+                values[position] += sub_matrix(i, j);
+            }
+            else
+            {
+                missing_entries.emplace_back(row, col, sub_matrix(i, j));
+            }
+        }
+    }
+}
+
 /// Sets the sparsity pattern of the underlying EigenMatrix.
 template <typename SPARSITY_PATTERN>
 struct SetMatrixSparsity<EigenMatrix, SPARSITY_PATTERN>
@@ -200,8 +375,50 @@ struct SetMatrixSparsity<EigenMatrix, SPARSITY_PATTERN>
         assert(matrix.getNumberOfRows() ==
                static_cast<EigenMatrix::IndexType>(sparsity_pattern.size()));
 
+        if constexpr (requires { sparsity_pattern.hasColumnIndices(); })
+        {
+            if (sparsity_pattern.hasColumnIndices())
+            {
+                allocateCompressed(matrix.getRawMatrix(), sparsity_pattern);
+                return;
+            }
+        }
+
         matrix.getRawMatrix().reserve(sparsity_pattern);
     }
+
+private:
+    /// Allocates the matrix in compressed storage with all entries of the
+    /// sparsity pattern set to zero, such that the assembly only updates
+    /// values.
+    static void allocateCompressed(EigenMatrix::RawMatrixType& m,
+                                   SPARSITY_PATTERN const& sparsity_pattern)
+    {
+        using StorageIndex = EigenMatrix::RawMatrixType::StorageIndex;
+
+        auto const column_indices = sparsity_pattern.columnIndices();
+        auto const n_rows = static_cast<EigenMatrix::IndexType>(
+            sparsity_pattern.size());
+
+        m.resize(m.rows(), m.cols());  // compressed and without entries.
+        m.resizeNonZeros(
+            static_cast<EigenMatrix::IndexType>(column_indices.size()));
+
+        auto* const outer = m.outerIndexPtr();
+        outer[0] = 0;
+        for (EigenMatrix::IndexType row = 0; row < n_rows; ++row)
+        {
+            outer[row + 1] =
+                outer[row] + static_cast<StorageIndex>(sparsity_pattern[row]);
+        }
+        assert(static_cast<std::size_t>(outer[n_rows]) ==
+               column_indices.size());
+
+        std::transform(column_indices.begin(), column_indices.end(),
+                       m.innerIndexPtr(), [](auto const column)
+                       { return static_cast<StorageIndex>(column); });
+        std::fill_n(m.valuePtr(), column_indices.size(), 0.0);
+    }
 };
 
 }  // end namespace MathLib
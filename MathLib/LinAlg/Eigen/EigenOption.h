@@ -46,6 +46,11 @@ struct EigenOption final
     int max_iterations;
     /// Error tolerance
     double error_tolerance;
+    /// Number of subsequent solves an iterative solver reuses its
+    /// preconditioner for, provided the matrix keeps its sparsity pattern and
+    /// the convergence does not degrade. Zero recomputes the preconditioner
+    /// for each solve.
+    int reuse_preconditioner;
 #ifdef USE_EIGEN_UNSUPPORTED
     /// Scaling the coefficient matrix and the RHS vector
     bool scaling;
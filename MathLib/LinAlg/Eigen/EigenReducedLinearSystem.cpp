@@ -0,0 +1,155 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "EigenReducedLinearSystem.h"
+
+#include <algorithm>
+
+#include "BaseLib/Logging.h"
+
+namespace MathLib
+{
+void EigenReducedLinearSystem::restrictSystem(
+    EigenMatrix& A, EigenVector const& b, EigenVector const& x,
+    std::vector<IndexType> const& known_solution_ids)
+{
+    auto& A_full = A.getRawMatrix();
+    if (!A_full.isCompressed())
+    {
+        A_full.makeCompressed();
+    }
+
+    std::vector<IndexType> known_ids(known_solution_ids);
+    std::sort(known_ids.begin(), known_ids.end());
+    known_ids.erase(std::unique(known_ids.begin(), known_ids.end()),
+                    known_ids.end());
+
+    if (!isUpToDate(A_full, known_ids))
+    {
+        rebuild(A_full, std::move(known_ids));
+    }
+
+    double const* const values_full = A_full.valuePtr();
+    double* const values = A_.getRawMatrix().valuePtr();
+    for (std::size_t k = 0; k < positions_.size(); ++k)
+    {
+        values[k] = values_full[positions_[k]];
+    }
+
+    auto const& b_full = b.getRawVector();
+    auto const& x_full = x.getRawVector();
+    auto& b_compact = b_.getRawVector();
+    auto& x_compact = x_.getRawVector();
+    for (std::size_t k = 0; k < free_ids_.size(); ++k)
+    {
+        b_compact[k] = b_full[free_ids_[k]];
+        x_compact[k] = x_full[free_ids_[k]];
+    }
+}
+
+void EigenReducedLinearSystem::prolongateSolution(EigenMatrix const& A,
+                                                  EigenVector const& b,
+                                                  EigenVector& x) const
+{
+    auto const& x_compact = x_.getRawVector();
+    auto& x_full = x.getRawVector();
+    for (std::size_t k = 0; k < free_ids_.size(); ++k)
+    {
+        x_full[free_ids_[k]] = x_compact[k];
+    }
+
+    auto const& A_full = A.getRawMatrix();
+    auto const& b_full = b.getRawVector();
+    for (auto const id : known_ids_)
+    {
+        x_full[id] = b_full[id] / A_full.coeff(id, id);
+    }
+}
+
+bool EigenReducedLinearSystem::isUpToDate(
+    EigenMatrix::RawMatrixType const& A,
+    std::vector<IndexType> const& known_solution_ids) const
+{
+    auto const* const outer = A.outerIndexPtr();
+    return known_solution_ids == known_ids_ &&
+           std::equal(outer, outer + A.rows() + 1, outer_index_.begin(),
+                      outer_index_.end());
+}
+
+void EigenReducedLinearSystem::rebuild(
+    EigenMatrix::RawMatrixType const& A,
+    std::vector<IndexType>&& known_solution_ids)
+{
+    known_ids_ = std::move(known_solution_ids);
+
+    auto const n_rows = A.rows();
+    auto const* const outer = A.outerIndexPtr();
+    auto const* const inner = A.innerIndexPtr();
+    outer_index_.assign(outer, outer + n_rows + 1);
+
+    // Compact numbering; -1 marks the known unknowns.
+    std::vector<StorageIndex> compact_ids(n_rows, 0);
+    for (auto const id : known_ids_)
+    {
+        compact_ids[id] = -1;
+    }
+    free_ids_.clear();
+    free_ids_.reserve(n_rows - known_ids_.size());
+    for (IndexType i = 0; i < n_rows; ++i)
+    {
+        if (compact_ids[i] >= 0)
+        {
+            compact_ids[i] = static_cast<StorageIndex>(free_ids_.size());
+            free_ids_.push_back(i);
+        }
+    }
+
+    // Sparsity pattern of the compact matrix. The columns of the known
+    // unknowns are zero after the known solutions have been applied and are
+    // dropped.
+    std::vector<StorageIndex> compact_outer;
+    std::vector<StorageIndex> compact_inner;
+    compact_outer.reserve(free_ids_.size() + 1);
+    compact_outer.push_back(0);
+    positions_.clear();
+    for (auto const row : free_ids_)
+    {
+        for (StorageIndex p = outer[row]; p < outer[row + 1]; ++p)
+        {
+            auto const compact_col = compact_ids[inner[p]];
+            if (compact_col < 0)
+            {
+                continue;
+            }
+            compact_inner.push_back(compact_col);
+            positions_.push_back(p);
+        }
+        compact_outer.push_back(
+            static_cast<StorageIndex>(compact_inner.size()));
+    }
+
+    auto const n = static_cast<IndexType>(free_ids_.size());
+    auto& A_compact = A_.getRawMatrix();
+    A_compact.resize(n, n);
+    A_compact.resizeNonZeros(static_cast<IndexType>(compact_inner.size()));
+    std::copy(compact_outer.begin(), compact_outer.end(),
+              A_compact.outerIndexPtr());
+    std::copy(compact_inner.begin(), compact_inner.end(),
+              A_compact.innerIndexPtr());
+
+    b_.getRawVector().resize(n);
+    x_.getRawVector().resize(n);
+
+    INFO(
+        "Rebuilt the reduced linear system: {:d} of {:d} unknowns are free, "
+        "{:d} non-zero entries.",
+        n, n_rows, compact_inner.size());
+}
+}  // namespace MathLib
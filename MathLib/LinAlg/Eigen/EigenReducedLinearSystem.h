@@ -0,0 +1,89 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "EigenMatrix.h"
+#include "EigenVector.h"
+
+namespace MathLib
+{
+/// Compact linear system on the free, i.e. not known, unknowns of an Eigen
+/// linear system.
+///
+/// After the known solutions have been applied, see applyKnownSolution(), the
+/// rows and columns of the known unknowns are decoupled from the rest of the
+/// system. Solving the compact system of the remaining unknowns is therefore
+/// exact, and the cost of the linear solver depends on the number of free
+/// unknowns only. This pays off if large parts of the domain are pinned, e.g.
+/// by the Dirichlet conditions of deactivated subdomains.
+///
+/// The compact numbering and the sparsity pattern of the compact matrix are
+/// rebuilt only if the set of known unknowns or the sparsity pattern of the
+/// full matrix changes. Otherwise only the values are copied.
+class EigenReducedLinearSystem final
+{
+public:
+    using IndexType = EigenMatrix::IndexType;
+    using StorageIndex = EigenMatrix::StorageIndex;
+
+    /// Copies the free rows and columns of \c A and the free entries of \c b
+    /// and \c x into the compact system.
+    ///
+    /// \pre The known solutions given by their ids must be applied to \c A
+    /// and \c b.
+    void restrictSystem(EigenMatrix& A, EigenVector const& b,
+                        EigenVector const& x,
+                        std::vector<IndexType> const& known_solution_ids);
+
+    /// Writes the solution of the compact system into the free entries of
+    /// \c x. The known entries are recovered from the diagonal entries of
+    /// \c A and the entries of \c b as set by applyKnownSolution().
+    void prolongateSolution(EigenMatrix const& A, EigenVector const& b,
+                            EigenVector& x) const;
+
+    EigenMatrix& getMatrix() { return A_; }
+    EigenVector& getRHS() { return b_; }
+    EigenVector& getSolution() { return x_; }
+
+    /// Number of unknowns of the compact system.
+    IndexType size() const { return static_cast<IndexType>(free_ids_.size()); }
+
+private:
+    /// Returns true if the compact numbering and the sparsity pattern are up
+    /// to date with the given sorted known solution ids and the sparsity
+    /// pattern of the compressed matrix \c A.
+    bool isUpToDate(EigenMatrix::RawMatrixType const& A,
+                    std::vector<IndexType> const& known_solution_ids) const;
+
+    void rebuild(EigenMatrix::RawMatrixType const& A,
+                 std::vector<IndexType>&& known_solution_ids);
+
+    /// Sorted ids of the known unknowns the compact system was built for.
+    std::vector<IndexType> known_ids_;
+
+    /// Ids in the full system of the unknowns of the compact system.
+    std::vector<IndexType> free_ids_;
+
+    /// Copy of the row starts of the full matrix the compact sparsity pattern
+    /// was built for, used to detect changes of the sparsity pattern.
+    std::vector<StorageIndex> outer_index_;
+
+    /// Location in the value array of the full matrix of each entry of the
+    /// compact matrix.
+    std::vector<StorageIndex> positions_;
+
+    EigenMatrix A_{0};
+    EigenVector b_;
+    EigenVector x_;
+};
+}  // namespace MathLib
@@ -10,21 +10,69 @@
 
 #include "EigenTools.h"
 
+#include <algorithm>
+
 #include "EigenVector.h"
 
 namespace MathLib
 {
+namespace
+{
+/// Location of the diagonal entry of the given row in the value array of the
+/// compressed(!) matrix or -1 if the entry is not part of the sparsity pattern.
+EigenMatrix::StorageIndex findDiagonalEntry(
+    EigenMatrix::RawMatrixType const& A, EigenMatrix::StorageIndex const row)
+{
+    auto const* const first = A.innerIndexPtr() + A.outerIndexPtr()[row];
+    auto const* const last = A.innerIndexPtr() + A.outerIndexPtr()[row + 1];
+    auto const* const it = std::lower_bound(first, last, row);
+    if (it == last || *it != row)
+    {
+        return -1;
+    }
+    return static_cast<EigenMatrix::StorageIndex>(it - A.innerIndexPtr());
+}
+}  // namespace
+
 void applyKnownSolution(
     EigenMatrix& A, EigenVector& b, EigenVector& /*x*/,
     const std::vector<EigenMatrix::IndexType>& vec_knownX_id,
     const std::vector<double>& vec_knownX_x)
 {
     using SpMat = EigenMatrix::RawMatrixType;
+    using StorageIndex = EigenMatrix::StorageIndex;
     static_assert(SpMat::IsRowMajor, "matrix is assumed to be row major!");
 
     auto& A_eigen = A.getRawMatrix();
     auto& b_eigen = b.getRawVector();
 
+    if (!A_eigen.isCompressed())
+    {
+        A_eigen.makeCompressed();
+    }
+
+    // For deactivated subdomains some rows and columns might be empty and
+    // have no diagonal entry. These entries are inserted first, such that the
+    // sparsity pattern does not change during the elimination.
+    std::vector<EigenMatrix::IndexType> missing_diagonal_entries;
+    for (auto const row_id : vec_knownX_id)
+    {
+        if (findDiagonalEntry(A_eigen, static_cast<StorageIndex>(row_id)) < 0)
+        {
+            missing_diagonal_entries.push_back(row_id);
+        }
+    }
+    if (!missing_diagonal_entries.empty())
+    {
+        for (auto const row_id : missing_diagonal_entries)
+        {
+            A_eigen.coeffRef(row_id, row_id) = 0.0;
+        }
+        A_eigen.makeCompressed();
+    }
+
+    double* const values = A_eigen.valuePtr();
+
     // A_eigen(k, j) = 0.
     // set row to zero
     for (auto row_id : vec_knownX_id)
@@ -38,33 +86,33 @@ void applyKnownSolution(
         }
     }
 
-    SpMat AT = A_eigen.transpose();
-
-    // Reserve space for at least one value (on the diagonal). For deactivated
-    // subdomains some rows and columns might end empty (in the A matrix) and so
-    // no space is reserved for the Dirichlet conditions in the transposed
-    // matrix. Then the coeffRef call will do costly reallocations.
-    AT.reserve(Eigen::VectorXi::Constant(A_eigen.rows(), 1));
+    // The columns are eliminated through the cached column entries of the
+    // matrix instead of a transposed copy of the matrix.
+    auto const& column_entries = A.getColumnEntries();
 
     for (std::size_t ix = 0; ix < vec_knownX_id.size(); ix++)
     {
-        SpMat::Index const row_id = vec_knownX_id[ix];
+        auto const row_id = static_cast<StorageIndex>(vec_knownX_id[ix]);
         auto const x = vec_knownX_x[ix];
 
         // b_i -= A_eigen(i,k)*val, i!=k
         // set column to zero, subtract from rhs
-        for (SpMat::InnerIterator it(AT, row_id); it; ++it)
+        for (auto i = column_entries.column_begin[row_id];
+             i < column_entries.column_begin[row_id + 1];
+             ++i)
         {
-            if (it.col() == row_id)
+            auto const row = column_entries.rows[i];
+            if (row == row_id)
             {
                 continue;
             }
 
-            b_eigen[it.col()] -= it.value() * x;
-            it.valueRef() = 0.0;
+            auto& value = values[column_entries.positions[i]];
+            b_eigen[row] -= value * x;
+            value = 0.0;
         }
 
-        auto& c = AT.coeffRef(row_id, row_id);
+        auto& c = values[findDiagonalEntry(A_eigen, row_id)];
         if (c != 0.0)
         {
             b_eigen[row_id] = x * c;
@@ -75,8 +123,6 @@ void applyKnownSolution(
             c = 1.0;
         }
     }
-
-    A_eigen = AT.transpose();
 }
 
 }  // namespace MathLib
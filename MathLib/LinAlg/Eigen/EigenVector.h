@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <cassert>
+#include <span>
 #include <vector>
 #ifndef NDEBUG
 #include <fstream>
@@ -72,6 +74,17 @@ public:
         return local_x;
     }
 
+    /// get entries into \c values, which must have the size of \c indices
+    void get(std::span<IndexType const> const indices,
+             std::span<double> const values) const
+    {
+        assert(indices.size() == values.size());
+        for (std::size_t i = 0; i < indices.size(); ++i)
+        {
+            values[i] = vec_[indices[i]];
+        }
+    }
+
     /// set entry
     void set(IndexType rowId, double v) { vec_[rowId] = v; }
 
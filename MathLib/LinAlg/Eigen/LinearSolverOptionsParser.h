@@ -79,6 +79,19 @@ struct LinearSolverOptionsParser<EigenLinearSolver> final
         {
             options.max_iterations = *max_iteration_step;
         }
+        if (auto reuse_preconditioner =
+                //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__reuse_preconditioner}
+            config->getConfigParameterOptional<int>("reuse_preconditioner"))
+        {
+            if (*reuse_preconditioner < 0)
+            {
+                OGS_FATAL(
+                    "The number of solves to reuse the preconditioner for "
+                    "must not be negative, got {:d}.",
+                    *reuse_preconditioner);
+            }
+            options.reuse_preconditioner = *reuse_preconditioner;
+        }
         if (auto scaling =
                 //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__scaling}
             config->getConfigParameterOptional<bool>("scaling"))
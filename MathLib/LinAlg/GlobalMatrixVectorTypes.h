@@ -62,4 +62,12 @@ static_assert(std::is_same_v<GlobalMatrix::IndexType, GlobalVector::IndexType>,
 // Both types are integral types and equal, define a single GlobalIndexType.
 using GlobalIndexType = GlobalMatrix::IndexType;
 
+#if defined(USE_PETSC)
 using GlobalSparsityPattern = MathLib::SparsityPattern<GlobalIndexType>;
+#else
+/// The column indices are stored in the index type of the compressed Eigen
+/// matrix storage, which is smaller than the GlobalIndexType.
+using GlobalSparsityPattern =
+    MathLib::SparsityPattern<GlobalIndexType,
+                             GlobalMatrix::RawMatrixType::StorageIndex>;
+#endif
@@ -195,7 +195,7 @@ void operator()(LisMatrix& matrix,
     row_sizes.reserve(n_rows);
 
     // LIS needs 1 more entry, otherwise it starts reallocating arrays.
-    transform(cbegin(sparsity_pattern), cend(sparsity_pattern),
+    transform(std::cbegin(sparsity_pattern), std::cend(sparsity_pattern),
               back_inserter(row_sizes), [](auto const i) { return i + 1; });
 
     int ierr = lis_matrix_malloc(matrix.AA_, 0, row_sizes.data());
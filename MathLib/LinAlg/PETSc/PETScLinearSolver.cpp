@@ -16,7 +16,7 @@
 
 #include "PETScLinearSolver.h"
 
-#include "BaseLib/RunTime.h"
+#include "BaseLib/Profiler.h"
 
 namespace MathLib
 {
@@ -44,8 +44,7 @@ PETScLinearSolver::PETScLinearSolver(std::string const& prefix,
 
 bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
 {
-    BaseLib::RunTime wtimer;
-    wtimer.start();
+    BaseLib::ProfilerRegion time_ksp_solve("ksp_solve");
 
 // define TEST_MEM_PETSC
 #ifdef TEST_MEM_PETSC
@@ -147,7 +146,7 @@ bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
         mem2, (int)(mem2 - mem1));
 #endif
 
-    elapsed_ctime_ += wtimer.elapsed();
+    elapsed_ctime_ += time_ksp_solve.elapsed();
 
     return converged;
 }
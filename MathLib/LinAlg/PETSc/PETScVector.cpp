@@ -206,6 +206,14 @@ std::vector<PetscScalar> PETScVector::get(
     std::vector<IndexType> const& indices) const
 {
     std::vector<PetscScalar> local_x(indices.size());
+    get(indices, local_x);
+    return local_x;
+}
+
+void PETScVector::get(std::span<IndexType const> const indices,
+                      std::span<PetscScalar> const local_x) const
+{
+    assert(indices.size() == local_x.size());
     // If VecGetValues can get values from different processors,
     // use VecGetValues(v_, indices.size(), indices.data(),
     //                    local_x.data());
@@ -227,8 +235,6 @@ std::vector<PetscScalar> PETScVector::get(
             local_x[i] = entry_array_[id_p];
         }
     }
-
-    return local_x;
 }
 
 PetscScalar* PETScVector::getLocalVector() const
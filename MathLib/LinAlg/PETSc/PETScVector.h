@@ -17,6 +17,7 @@
 #pragma once
 
 #include <map>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -150,6 +151,11 @@ public:
     /// called beforehand.
     std::vector<PetscScalar> get(std::vector<IndexType> const& indices) const;
 
+    /// Get several entries into \c values, which must have the size of
+    /// \c indices. setLocalAccessibleVector() must be called beforehand.
+    void get(std::span<IndexType const> const indices,
+             std::span<PetscScalar> const values) const;
+
     /// Get the value of an entry by [] operator.
     /// setLocalAccessibleVector() must be called beforehand.
     PetscScalar operator[](PetscInt idx) const { return get(idx); }
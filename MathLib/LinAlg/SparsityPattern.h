@@ -10,11 +10,79 @@
 
 #pragma once
 
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace MathLib
 {
-/// A vector telling how many nonzeros there are in each global matrix row.
-template <typename IndexType>
-using SparsityPattern = std::vector<IndexType>;
-}
+/// Tells how many nonzeros there are in each global matrix row.
+///
+/// Optionally, the exact column indices of the nonzeros are stored row by row
+/// in sorted order, i.e. in the layout of a compressed sparse row matrix. Then
+/// matrices can be allocated in their final compressed form once, and no
+/// entries have to be inserted during the assembly. The column indices can be
+/// stored in a smaller type than the row sizes, e.g. in the index type of the
+/// matrix storage.
+template <typename IndexType, typename ColumnIndexType = IndexType>
+class SparsityPattern
+{
+public:
+    using value_type = IndexType;
+    using column_index_type = ColumnIndexType;
+
+    SparsityPattern() = default;
+
+    /// Pattern with \c n_rows rows of \c row_size nonzeros each, without
+    /// column indices.
+    explicit SparsityPattern(std::size_t const n_rows,
+                             IndexType const row_size = 0)
+        : _row_sizes(n_rows, row_size)
+    {
+    }
+
+    /// Pattern with the given column indices, the ones of each row sorted and
+    /// stored one row after another.
+    SparsityPattern(std::vector<IndexType> row_sizes,
+                    std::vector<ColumnIndexType> column_indices)
+        : _row_sizes(std::move(row_sizes)),
+          _column_indices(std::move(column_indices))
+    {
+    }
+
+    std::size_t size() const { return _row_sizes.size(); }
+
+    /// The number of nonzeros in the given row.
+    IndexType operator[](std::size_t const row) const
+    {
+        return _row_sizes[row];
+    }
+
+    IndexType front() const { return _row_sizes.front(); }
+
+    auto begin() const { return _row_sizes.begin(); }
+    auto end() const { return _row_sizes.end(); }
+
+    /// True if the column indices of the nonzeros are known.
+    bool hasColumnIndices() const { return !_column_indices.empty(); }
+
+    /// Column indices of all nonzeros, ordered by rows.
+    std::span<ColumnIndexType const> columnIndices() const
+    {
+        return _column_indices;
+    }
+
+    /// Total number of nonzeros of the pattern with column indices.
+    std::size_t numberOfNonzeros() const
+    {
+        assert(hasColumnIndices());
+        return _column_indices.size();
+    }
+
+private:
+    std::vector<IndexType> _row_sizes;
+    std::vector<ColumnIndexType> _column_indices;
+};
+}  // namespace MathLib
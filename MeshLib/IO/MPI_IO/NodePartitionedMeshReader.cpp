@@ -21,7 +21,7 @@
 
 #include "BaseLib/FileTools.h"
 #include "BaseLib/Logging.h"
-#include "BaseLib/RunTime.h"
+#include "BaseLib/Profiler.h"
 #include "MeshLib/Elements/Elements.h"
 #include "MeshLib/MeshEnums.h"
 #include "MeshLib/Properties.h"
@@ -73,8 +73,7 @@ void NodePartitionedMeshReader::registerNodeDataMpiType()
 MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::read(
     const std::string& file_name_base)
 {
-    BaseLib::RunTime timer;
-    timer.start();
+    BaseLib::ProfilerRegion timer("read_mesh");
 
     MeshLib::NodePartitionedMesh* mesh = nullptr;
 
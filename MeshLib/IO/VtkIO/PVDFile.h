@@ -33,6 +33,19 @@ public:
     //! Add a VTU file to this PVD file.
     void addVTUFile(std::string const& vtu_fname, double timestep);
 
+    //! The (time, VTU file name) pairs added so far.
+    std::vector<std::pair<double, std::string>> const& getDatasets() const
+    {
+        return _datasets;
+    }
+
+    //! Replaces the datasets, e.g., when restarting a simulation. The PVD file
+    //! itself is rewritten with the next added VTU file.
+    void setDatasets(std::vector<std::pair<double, std::string>> datasets)
+    {
+        _datasets = std::move(datasets);
+    }
+
     std::string const pvd_filename;
 
 private:
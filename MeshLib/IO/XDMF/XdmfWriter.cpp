@@ -12,7 +12,7 @@
 #include <fstream>
 
 #include "BaseLib/Logging.h"
-#include "BaseLib/RunTime.h"
+#include "BaseLib/Profiler.h"
 #include "writeXdmf.h"
 
 namespace MeshLib::IO
@@ -26,8 +26,7 @@ XdmfWriter::XdmfWriter(std::string xdmf_filename,
 
 XdmfWriter::~XdmfWriter()
 {
-    BaseLib::RunTime time_output;
-    time_output.start();
+    BaseLib::ProfilerRegion time_output("xdmf_output");
     std::ofstream fout;
     fout.open(filename);
     fout << xdmf_writer(times);
@@ -0,0 +1,92 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include "ComponentGlobalIndexDict.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include "BaseLib/Error.h"
+
+namespace NumLib
+{
+namespace detail
+{
+void ComponentGlobalIndexDict::reserve(std::size_t const mesh_id,
+                                       MeshLib::MeshItemType const item_type,
+                                       std::size_t const number_of_items)
+{
+    auto& global_indices = getOrCreateTable(mesh_id, item_type).global_indices;
+    auto const size = number_of_items * _number_of_components;
+    if (global_indices.size() < size)
+    {
+        global_indices.reserve(size);
+        global_indices.resize(size, invalid_index);
+    }
+}
+
+void ComponentGlobalIndexDict::insert(MeshLib::Location const& l,
+                                      int const comp_id,
+                                      GlobalIndexType const global_index)
+{
+    if (comp_id < 0 || comp_id >= _number_of_components)
+    {
+        OGS_FATAL(
+            "The component id {:d} is out of the range [0, {:d}) of the "
+            "component ids of the dictionary.",
+            comp_id, _number_of_components);
+    }
+    if (global_index == invalid_index)
+    {
+        OGS_FATAL("Inserting an invalid global index into the dictionary.");
+    }
+
+    auto& global_indices =
+        getOrCreateTable(l.mesh_id, l.item_type).global_indices;
+    auto const i = l.item_id * _number_of_components + comp_id;
+    if (i >= global_indices.size())
+    {
+        global_indices.resize((l.item_id + 1) * _number_of_components,
+                              invalid_index);
+    }
+    if (global_indices[i] != invalid_index)
+    {
+        return;
+    }
+    global_indices[i] = global_index;
+    _size++;
+}
+
+std::size_t ComponentGlobalIndexDict::memoryUsage() const
+{
+    std::size_t bytes = _tables.capacity() * sizeof(Table);
+    for (auto const& table : _tables)
+    {
+        bytes += table.global_indices.capacity() * sizeof(GlobalIndexType);
+    }
+    return bytes;
+}
+
+ComponentGlobalIndexDict::Table& ComponentGlobalIndexDict::getOrCreateTable(
+    std::size_t const mesh_id, MeshLib::MeshItemType const item_type)
+{
+    auto const key = std::tie(mesh_id, item_type);
+    auto const it =
+        std::lower_bound(_tables.begin(), _tables.end(), key,
+                         [](Table const& table, auto const& key)
+                         { return std::tie(table.mesh_id, table.item_type) < key; });
+    if (it != _tables.end() && it->mesh_id == mesh_id &&
+        it->item_type == item_type)
+    {
+        return *it;
+    }
+    return *_tables.insert(it, Table{mesh_id, item_type, {}});
+}
+}  // namespace detail
+}  // namespace NumLib
@@ -12,12 +12,9 @@
 
 #pragma once
 
-#include <boost/multi_index/composite_key.hpp>
-#include <boost/multi_index/member.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index_container.hpp>
+#include <cstddef>
 #include <limits>
-#include <utility>
+#include <vector>
 
 #include "MeshLib/Location.h"
 #include "NumLib/NumericsConfig.h"
@@ -27,96 +24,161 @@ namespace NumLib
 /// \internal
 namespace detail
 {
-struct Line
+/// Dictionary of the global indices of the components at mesh item locations.
+///
+/// The global indices are stored per mesh and mesh item type in flat tables,
+/// which are indexed by the mesh item id and the component id, i.e. the entry
+/// of a location and a component is found in constant time. Entries not in the
+/// dictionary hold the value \c invalid_index.
+///
+/// Iterating over the dictionary visits the locations in their lexicographic
+/// order and the components of each location in ascending order.
+class ComponentGlobalIndexDict final
 {
-    MeshLib::Location location;
+public:
+    static constexpr GlobalIndexType invalid_index =
+        std::numeric_limits<GlobalIndexType>::max();
+
+    /// \param number_of_components all component ids inserted in the
+    /// dictionary must be smaller than this number.
+    explicit ComponentGlobalIndexDict(int const number_of_components)
+        : _number_of_components(number_of_components)
+    {
+    }
+
+    /// Number of entries in the dictionary.
+    std::size_t size() const { return _size; }
 
-    // Physical component
-    int comp_id;
+    int numberOfComponents() const { return _number_of_components; }
 
-    // Position in global matrix or vector
-    GlobalIndexType global_index;
+    /// Reserves the memory for the mesh items with ids less than
+    /// \c number_of_items at the given mesh and mesh item type.
+    void reserve(std::size_t mesh_id, MeshLib::MeshItemType item_type,
+                 std::size_t number_of_items);
 
-    Line(MeshLib::Location l, int c, GlobalIndexType i)
-        : location(std::move(l)), comp_id(c), global_index(i)
+    /// Inserts the global index for the given location and component. If the
+    /// dictionary already contains an entry for them, the dictionary is not
+    /// modified.
+    void insert(MeshLib::Location const& l, int comp_id,
+                GlobalIndexType global_index);
+
+    /// Global index of the given location and component or \c invalid_index
+    /// if there is no such entry in the dictionary.
+    GlobalIndexType find(MeshLib::Location const& l, int const comp_id) const
     {
+        if (comp_id < 0 || comp_id >= _number_of_components)
+        {
+            return invalid_index;
+        }
+        auto const* const table = findTable(l.mesh_id, l.item_type);
+        if (table == nullptr)
+        {
+            return invalid_index;
+        }
+        auto const i = l.item_id * _number_of_components + comp_id;
+        return i < table->global_indices.size() ? table->global_indices[i]
+                                                : invalid_index;
     }
 
-    Line(MeshLib::Location l, int c)
-        : location(std::move(l)),
-          comp_id(c),
-          global_index(std::numeric_limits<GlobalIndexType>::max())
+    /// Calls \c f(comp_id, global_index) for all components at the given
+    /// location in ascending order of the component ids.
+    template <typename F>
+    void forEachComponentAt(MeshLib::Location const& l, F&& f) const
     {
+        auto const* const table = findTable(l.mesh_id, l.item_type);
+        if (table == nullptr)
+        {
+            return;
+        }
+        auto const begin = l.item_id * _number_of_components;
+        if (begin >= table->global_indices.size())
+        {
+            return;
+        }
+        for (int c = 0; c < _number_of_components; ++c)
+        {
+            auto const global_index = table->global_indices[begin + c];
+            if (global_index != invalid_index)
+            {
+                f(c, global_index);
+            }
+        }
     }
 
-    explicit Line(MeshLib::Location l)
-        : location(std::move(l)),
-          comp_id(std::numeric_limits<int>::max()),
-          global_index(std::numeric_limits<GlobalIndexType>::max())
+    /// Calls \c f(location, comp_id, global_index) for all entries ordered by
+    /// location and component id. The global index is passed by reference
+    /// and may be modified by \c f.
+    template <typename F>
+    void forEach(F&& f)
     {
+        forEachEntry(*this, f);
     }
 
-    friend std::ostream& operator<<(std::ostream& os, Line const& l)
+    template <typename F>
+    void forEach(F&& f) const
     {
-        return os << l.location << ", " << l.comp_id << ", " << l.global_index;
+        forEachEntry(*this, f);
     }
-};
 
-struct LineByLocationComparator
-{
-    bool operator()(Line const& a, Line const& b) const
+    /// Number of bytes allocated for the tables.
+    std::size_t memoryUsage() const;
+
+private:
+    /// Global indices of all components of the items of one mesh and item
+    /// type. The entry of item \c i and component \c c is at position
+    /// <tt>i * number_of_components + c</tt>.
+    struct Table
     {
-        return a.location < b.location;
-    }
-};
+        std::size_t mesh_id;
+        MeshLib::MeshItemType item_type;
+        std::vector<GlobalIndexType> global_indices;
+    };
 
-struct LineByLocationAndComponentComparator
-{
-    bool operator()(Line const& a, Line const& b) const
+    template <typename Self, typename F>
+    static void forEachEntry(Self& self, F& f)
     {
-        if (a.location < b.location)
+        auto const n = static_cast<std::size_t>(self._number_of_components);
+        for (auto& table : self._tables)
         {
-            return true;
+            auto& global_indices = table.global_indices;
+            for (std::size_t i = 0; i < global_indices.size(); ++i)
+            {
+                if (global_indices[i] == invalid_index)
+                {
+                    continue;
+                }
+                f(MeshLib::Location{table.mesh_id, table.item_type, i / n},
+                  static_cast<int>(i % n), global_indices[i]);
+            }
         }
-        if (b.location < a.location)
+    }
+
+    Table const* findTable(std::size_t const mesh_id,
+                           MeshLib::MeshItemType const item_type) const
+    {
+        // There are only a few tables, usually one.
+        for (auto const& table : _tables)
         {
-            return false;
+            if (table.mesh_id == mesh_id && table.item_type == item_type)
+            {
+                return &table;
+            }
         }
-
-        // a.loc == b.loc
-        return a.comp_id < b.comp_id;
+        return nullptr;
     }
-};
 
-struct ByLocation
-{
-};
-struct ByLocationAndComponent
-{
-};
-struct ByComponent
-{
-};
-struct ByGlobalIndex
-{
-};
+    /// Returns the table for the given mesh and item type creating a new one
+    /// if necessary.
+    Table& getOrCreateTable(std::size_t mesh_id,
+                            MeshLib::MeshItemType item_type);
+
+    int _number_of_components;
 
-using ComponentGlobalIndexDict = boost::multi_index::multi_index_container<
-    Line, boost::multi_index::indexed_by<
-              boost::multi_index::ordered_unique<
-                  boost::multi_index::tag<ByLocationAndComponent>,
-                  boost::multi_index::identity<Line>,
-                  LineByLocationAndComponentComparator>,
-              boost::multi_index::ordered_non_unique<
-                  boost::multi_index::tag<ByLocation>,
-                  boost::multi_index::identity<Line>, LineByLocationComparator>,
-              boost::multi_index::ordered_non_unique<
-                  boost::multi_index::tag<ByComponent>,
-                  boost::multi_index::member<Line, int, &Line::comp_id>>,
-              boost::multi_index::ordered_non_unique<
-                  boost::multi_index::tag<ByGlobalIndex>,
-                  boost::multi_index::member<Line, GlobalIndexType,
-                                             &Line::global_index>>>>;
+    /// Tables sorted by mesh id and item type.
+    std::vector<Table> _tables;
+
+    std::size_t _size = 0;
+};
 
 }  // namespace detail
 }  // namespace NumLib
@@ -10,6 +10,9 @@
 
 #include "ComputeSparsityPattern.h"
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
 #include <numeric>
 
 #include "LocalToGlobalIndexMap.h"
@@ -49,22 +52,61 @@ GlobalSparsityPattern computeSparsityPatternNonPETSc(
         global_idcs.push_back(dof_table.getGlobalIndices(l));
     }
 
-    GlobalSparsityPattern sparsity_pattern(dof_table.dofSizeWithGhosts());
-
-    // Map adjacent mesh nodes to "adjacent global indices".
+    // The columns of all rows of a node are the global indices of the
+    // adjacent nodes. The rows are collected per node first, such that the
+    // columns can be copied row by row in the order of the global indices.
+    auto const n_rows = dof_table.dofSizeWithGhosts();
+    std::vector<std::size_t> node_of_row(n_rows,
+                                         std::numeric_limits<std::size_t>::max());
+    std::vector<GlobalIndexType> row_sizes(n_rows, 0);
     for (std::size_t n = 0; n < mesh.getNumberOfNodes(); ++n)
     {
         auto const& an = node_adjacency_table.getAdjacentNodes(n);
         auto const n_connected_dof =
-            std::accumulate(cbegin(an), cend(an), 0,
+            std::accumulate(cbegin(an), cend(an), GlobalIndexType{0},
                             [&](auto const result, auto const i)
-                            { return result + global_idcs[i].size(); });
+                            {
+                                return result + static_cast<GlobalIndexType>(
+                                                    global_idcs[i].size());
+                            });
         for (auto global_index : global_idcs[n])
         {
-            sparsity_pattern[global_index] = n_connected_dof;
+            row_sizes[global_index] = n_connected_dof;
+            node_of_row[global_index] = n;
+        }
+    }
+
+    using ColumnIndexType = GlobalSparsityPattern::column_index_type;
+    std::vector<ColumnIndexType> column_indices;
+    column_indices.reserve(
+        std::accumulate(cbegin(row_sizes), cend(row_sizes), std::size_t{0}));
+    std::vector<ColumnIndexType> node_columns;
+    for (std::size_t row = 0; row < n_rows; ++row)
+    {
+        auto const n = node_of_row[row];
+        if (n == std::numeric_limits<std::size_t>::max())
+        {
+            continue;
+        }
+        // Consecutive rows often belong to the same node.
+        if (row == 0 || node_of_row[row - 1] != n)
+        {
+            node_columns.clear();
+            for (auto const a : node_adjacency_table.getAdjacentNodes(n))
+            {
+                std::transform(
+                    global_idcs[a].begin(), global_idcs[a].end(),
+                    std::back_inserter(node_columns), [](auto const column)
+                    { return static_cast<ColumnIndexType>(column); });
+            }
+            std::sort(node_columns.begin(), node_columns.end());
         }
+        column_indices.insert(column_indices.end(), node_columns.begin(),
+                              node_columns.end());
     }
 
+    GlobalSparsityPattern sparsity_pattern(std::move(row_sizes),
+                                           std::move(column_indices));
     return sparsity_pattern;
 }
 #endif
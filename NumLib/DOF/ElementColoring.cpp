@@ -0,0 +1,106 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ElementColoring.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <numeric>
+
+#include "DOFTableUtil.h"
+#include "LocalToGlobalIndexMap.h"
+
+namespace NumLib
+{
+std::vector<std::vector<std::size_t>> computeElementColoring(
+    LocalToGlobalIndexMap const& dof_table)
+{
+    std::size_t const number_of_items = dof_table.size();
+
+    // Global indices of each mesh item in compressed row storage. Ghost
+    // indices are negative in DDC; their absolute value identifies the entry.
+    std::vector<std::size_t> item_offsets(number_of_items + 1, 0);
+    std::vector<GlobalIndexType> item_indices;
+    for (std::size_t item = 0; item < number_of_items; ++item)
+    {
+        for (auto const index : getIndices(item, dof_table))
+        {
+            if (index != NumLib::MeshComponentMap::nop)
+            {
+                item_indices.push_back(std::abs(index));
+            }
+        }
+        item_offsets[item + 1] = item_indices.size();
+    }
+
+    // Inverse map: the mesh items using each global index.
+    std::size_t const number_of_indices =
+        item_indices.empty()
+            ? 0
+            : *std::max_element(item_indices.begin(), item_indices.end()) + 1;
+    std::vector<std::size_t> index_offsets(number_of_indices + 1, 0);
+    for (auto const index : item_indices)
+    {
+        ++index_offsets[index + 1];
+    }
+    std::partial_sum(index_offsets.begin(), index_offsets.end(),
+                     index_offsets.begin());
+    std::vector<std::size_t> index_items(item_indices.size());
+    {
+        auto position = index_offsets;
+        for (std::size_t item = 0; item < number_of_items; ++item)
+        {
+            for (auto k = item_offsets[item]; k < item_offsets[item + 1]; ++k)
+            {
+                index_items[position[item_indices[k]]++] = item;
+            }
+        }
+    }
+
+    // Greedy coloring: each mesh item gets the smallest color not used by any
+    // already colored mesh item sharing a global index with it.
+    constexpr std::size_t uncolored = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> item_colors(number_of_items, uncolored);
+    // Stores for each color the last mesh item it was forbidden for.
+    std::vector<std::size_t> forbidden_for;
+    std::vector<std::vector<std::size_t>> colors;
+    for (std::size_t item = 0; item < number_of_items; ++item)
+    {
+        for (auto k = item_offsets[item]; k < item_offsets[item + 1]; ++k)
+        {
+            auto const index = item_indices[k];
+            for (auto l = index_offsets[index]; l < index_offsets[index + 1];
+                 ++l)
+            {
+                auto const color = item_colors[index_items[l]];
+                if (color != uncolored)
+                {
+                    forbidden_for[color] = item;
+                }
+            }
+        }
+
+        auto const color = static_cast<std::size_t>(
+            std::find_if(forbidden_for.begin(), forbidden_for.end(),
+                         [item](std::size_t const i) { return i != item; }) -
+            forbidden_for.begin());
+        if (color == colors.size())
+        {
+            colors.emplace_back();
+            forbidden_for.push_back(uncolored);
+        }
+        item_colors[item] = color;
+        colors[color].push_back(item);
+    }
+
+    return colors;
+}
+}  // namespace NumLib
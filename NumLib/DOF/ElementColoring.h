@@ -0,0 +1,38 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace NumLib
+{
+class LocalToGlobalIndexMap;
+
+/**
+ * Groups the mesh items of the given \c dof_table into colors such that no two
+ * mesh items of the same color share a global index.
+ *
+ * The local contributions of mesh items of one color can thus be added to the
+ * global matrices and vectors concurrently. Because the degrees of freedom are
+ * attached to the nodes of the mesh, this is a coloring of the element-node
+ * connectivity graph restricted to nodes carrying degrees of freedom.
+ *
+ * A greedy algorithm visiting the mesh items in their natural order is used.
+ * The mesh item ids within each color are sorted ascendingly.
+ *
+ * @param dof_table maps the mesh items to global indices
+ *
+ * @return The mesh item ids for each color.
+ */
+std::vector<std::vector<std::size_t>> computeElementColoring(
+    LocalToGlobalIndexMap const& dof_table);
+}  // namespace NumLib
@@ -11,9 +11,12 @@
 #include "LocalToGlobalIndexMap.h"
 
 #include <algorithm>
+#include <cassert>
 #include <numeric>
 #include <unordered_set>
 
+#include "ElementColoring.h"
+
 namespace NumLib
 {
 namespace
@@ -151,6 +154,8 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
                               global_component_id);
         }
     }
+
+    storeElementIndices();
 }
 
 LocalToGlobalIndexMap::LocalToGlobalIndexMap(
@@ -198,6 +203,8 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
                 mesh_id, global_component_id, global_component_id);
         }
     }
+
+    storeElementIndices();
 }
 
 LocalToGlobalIndexMap::LocalToGlobalIndexMap(
@@ -231,6 +238,8 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
         findGlobalIndices(elements.cbegin(), elements.cend(), ms.getNodes(),
                           mesh_id, global_component_ids[i], i);
     }
+
+    storeElementIndices();
 }
 
 std::unique_ptr<LocalToGlobalIndexMap>
@@ -344,6 +353,50 @@ std::size_t LocalToGlobalIndexMap::size() const
     return _rows.rows();
 }
 
+void LocalToGlobalIndexMap::storeElementIndices()
+{
+    auto const number_of_items = static_cast<std::size_t>(_rows.rows());
+    _element_indices_offsets.resize(number_of_items + 1);
+    _element_indices_offsets[0] = 0;
+    for (std::size_t i = 0; i < number_of_items; ++i)
+    {
+        _element_indices_offsets[i + 1] =
+            _element_indices_offsets[i] + getNumberOfElementDOF(i);
+    }
+
+    _element_indices.clear();
+    _element_indices.reserve(_element_indices_offsets.back());
+    // Same order as in NumLib::getIndices(), i.e. ordered by component.
+    for (std::size_t i = 0; i < number_of_items; ++i)
+    {
+        for (Table::Index c = 0; c < _rows.cols(); ++c)
+        {
+            auto const& indices = _rows(i, c);
+            _element_indices.insert(_element_indices.end(), indices.begin(),
+                                    indices.end());
+        }
+    }
+}
+
+std::span<GlobalIndexType const> LocalToGlobalIndexMap::getElementIndices(
+    std::size_t const mesh_item_id) const
+{
+    assert(mesh_item_id < size());
+    auto const begin = _element_indices_offsets[mesh_item_id];
+    auto const end = _element_indices_offsets[mesh_item_id + 1];
+    return {_element_indices.data() + begin, end - begin};
+}
+
+std::vector<std::vector<std::size_t>> const&
+LocalToGlobalIndexMap::getElementColors() const
+{
+    if (_element_colors.empty() && size() > 0)
+    {
+        _element_colors = computeElementColoring(*this);
+    }
+    return _element_colors;
+}
+
 LocalToGlobalIndexMap::RowColumnIndices LocalToGlobalIndexMap::operator()(
     std::size_t const mesh_item_id, const int global_component_id) const
 {
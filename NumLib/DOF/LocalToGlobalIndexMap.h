@@ -15,6 +15,7 @@
 #endif  // NDEBUG
 
 #include <Eigen/Dense>
+#include <span>
 #include <vector>
 
 #include "MathLib/LinAlg/RowColumnIndices.h"
@@ -163,6 +164,19 @@ public:
     /// component (like x, or y, or z).
     int getGlobalComponent(int const variable_id, int const component_id) const;
 
+    /// Returns the global indices of all components of the given mesh item in
+    /// the same order as NumLib::getIndices(), but without copying them.
+    std::span<GlobalIndexType const> getElementIndices(
+        std::size_t const mesh_item_id) const;
+
+    /// Returns the mesh item ids grouped by color such that no two mesh items
+    /// of the same color share a global index, see computeElementColoring().
+    /// The coloring is computed on the first call and cached afterwards.
+    ///
+    /// \attention The first call must not happen concurrently with other
+    /// calls of this method.
+    std::vector<std::vector<std::size_t>> const& getElementColors() const;
+
     /// Private constructor (ensured by ConstructorTag) used by internally
     /// created local-to-global index maps. The mesh_component_map is passed as
     /// argument instead of being created by the constructor.
@@ -190,6 +204,10 @@ private:
         std::vector<MeshLib::Node*> const& nodes, std::size_t const mesh_id,
         const int comp_id, const int comp_id_write);
 
+    /// Stores the rows of the table contiguously for getElementIndices().
+    /// Must be called after the table has been filled.
+    void storeElementIndices();
+
     /// A vector of mesh subsets for each process variables' components.
     std::vector<MeshLib::MeshSubset> _mesh_subsets;
     NumLib::MeshComponentMap _mesh_component_map;
@@ -206,6 +224,14 @@ private:
     Table const& _columns = _rows;
 
     std::vector<int> const _variable_component_offsets;
+
+    /// The global indices of all mesh items, see getElementIndices(), and the
+    /// offsets of each mesh item's indices therein.
+    std::vector<GlobalIndexType> _element_indices;
+    std::vector<std::size_t> _element_indices_offsets;
+
+    /// Cache of getElementColors(); empty until its first call.
+    mutable std::vector<std::vector<std::size_t>> _element_colors;
 #ifndef NDEBUG
     /// Prints first rows of the table, every line, and the mesh component map.
     friend std::ostream& operator<<(std::ostream& os,
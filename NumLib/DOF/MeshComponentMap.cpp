@@ -13,6 +13,8 @@
 #include "MeshComponentMap.h"
 
 #include "BaseLib/Error.h"
+#include "BaseLib/Logging.h"
+#include "BaseLib/RunTime.h"
 #include "MeshLib/MeshSubset.h"
 #include "MeshLib/Node.h"
 
@@ -25,12 +27,15 @@ namespace NumLib
 using namespace detail;
 
 GlobalIndexType const MeshComponentMap::nop =
-    std::numeric_limits<GlobalIndexType>::max();
+    ComponentGlobalIndexDict::invalid_index;
 
-#ifdef USE_PETSC
 MeshComponentMap::MeshComponentMap(
     std::vector<MeshLib::MeshSubset> const& components, ComponentOrder order)
 {
+    BaseLib::RunTime time_setup;
+    time_setup.start();
+
+#ifdef USE_PETSC
     // Use PETSc with single thread
     const MeshLib::NodePartitionedMesh& partitioned_mesh =
         static_cast<const MeshLib::NodePartitionedMesh&>(
@@ -38,21 +43,21 @@ MeshComponentMap::MeshComponentMap(
     if (partitioned_mesh.isForSingleThread())
     {
         createSerialMeshComponentMap(components, order);
-        return;
     }
     else
     {
         createParallelMeshComponentMap(components, order);
     }
-}
 #else
-MeshComponentMap::MeshComponentMap(
-    std::vector<MeshLib::MeshSubset> const& components, ComponentOrder order)
-{
     createSerialMeshComponentMap(components, order);
-}
 #endif  // end of USE_PETSC
 
+    DBUG(
+        "Created the mesh component map of {:d} degrees of freedom in {:g} s "
+        "using {:d} KiB.",
+        _dict.size(), time_setup.elapsed(), _dict.memoryUsage() / 1024);
+}
+
 MeshComponentMap MeshComponentMap::getSubset(
     std::vector<MeshLib::MeshSubset> const& bulk_mesh_subsets,
     MeshLib::MeshSubset const& new_mesh_subset,
@@ -89,7 +94,15 @@ MeshComponentMap MeshComponentMap::getSubset(
             "bulk_node_ids", MeshLib::MeshItemType::Node, 1);
 
     // New dictionary for the subset.
-    ComponentGlobalIndexDict subset_dict;
+    ComponentGlobalIndexDict subset_dict(
+        new_global_component_ids.empty()
+            ? 0
+            : *std::max_element(begin(new_global_component_ids),
+                                end(new_global_component_ids)) +
+                  1);
+    subset_dict.reserve(new_mesh_subset.getMeshID(),
+                        MeshLib::MeshItemType::Node,
+                        new_mesh_subset.getMesh().getNumberOfNodes());
 
     std::size_t const new_mesh_id = new_mesh_subset.getMeshID();
     // Lookup the locations in the current mesh component map and
@@ -133,65 +146,46 @@ MeshComponentMap MeshComponentMap::getSubset(
                 }
                 continue;
             }
-            subset_dict.insert({new_location, component_id, global_index});
+            subset_dict.insert(new_location, component_id, global_index);
         }
     }
 
-    return MeshComponentMap(subset_dict);
+    return MeshComponentMap(std::move(subset_dict));
 }
 
 void MeshComponentMap::renumberByLocation(GlobalIndexType offset)
 {
     GlobalIndexType global_index = offset;
 
-    auto& m = _dict.get<ByLocation>();  // view as sorted by mesh item
-    for (auto itr_mesh_item = m.begin(); itr_mesh_item != m.end();
-         ++itr_mesh_item)
-    {
-        Line pos = *itr_mesh_item;
-        pos.global_index = global_index++;
-        m.replace(itr_mesh_item, pos);
-    }
+    // The dictionary is traversed sorted by mesh item.
+    _dict.forEach([&global_index](Location const& /*l*/, int const /*comp_id*/,
+                                  GlobalIndexType& line_global_index)
+                  { line_global_index = global_index++; });
 }
 
 std::vector<int> MeshComponentMap::getComponentIDs(const Location& l) const
 {
-    auto const& m = _dict.get<ByLocation>();
-    auto const p = m.equal_range(Line(l));
     std::vector<int> vec_compID;
-    for (auto itr = p.first; itr != p.second; ++itr)
-    {
-        vec_compID.push_back(itr->comp_id);
-    }
+    _dict.forEachComponentAt(
+        l, [&vec_compID](int const comp_id, GlobalIndexType const /*gi*/)
+        { vec_compID.push_back(comp_id); });
     return vec_compID;
 }
 
-Line MeshComponentMap::getLine(Location const& l, int const comp_id) const
-{
-    auto const& m = _dict.get<ByLocationAndComponent>();
-    auto const itr = m.find(Line(l, comp_id));
-    assert(itr != m.end());  // The line must exist in the current dictionary.
-    return *itr;
-}
-
 GlobalIndexType MeshComponentMap::getGlobalIndex(Location const& l,
                                                  int const comp_id) const
 {
-    auto const& m = _dict.get<ByLocationAndComponent>();
-    auto const itr = m.find(Line(l, comp_id));
-    return itr != m.end() ? itr->global_index : nop;
+    return _dict.find(l, comp_id);
 }
 
 std::vector<GlobalIndexType> MeshComponentMap::getGlobalIndices(
     const Location& l) const
 {
-    auto const& m = _dict.get<ByLocation>();
-    auto const p = m.equal_range(Line(l));
     std::vector<GlobalIndexType> global_indices;
-    for (auto itr = p.first; itr != p.second; ++itr)
-    {
-        global_indices.push_back(itr->global_index);
-    }
+    _dict.forEachComponentAt(
+        l, [&global_indices](int const /*comp_id*/,
+                             GlobalIndexType const global_index)
+        { global_indices.push_back(global_index); });
     return global_indices;
 }
 
@@ -204,14 +198,12 @@ std::vector<GlobalIndexType> MeshComponentMap::getGlobalIndicesByLocation(
     std::vector<GlobalIndexType> global_indices;
     global_indices.reserve(ls.size());
 
-    auto const& m = _dict.get<ByLocation>();
     for (const auto& l : ls)
     {
-        auto const p = m.equal_range(Line(l));
-        for (auto itr = p.first; itr != p.second; ++itr)
-        {
-            global_indices.push_back(itr->global_index);
-        }
+        _dict.forEachComponentAt(
+            l, [&global_indices](int const /*comp_id*/,
+                                 GlobalIndexType const global_index)
+            { global_indices.push_back(global_index); });
     }
 
     return global_indices;
@@ -226,14 +218,11 @@ std::vector<GlobalIndexType> MeshComponentMap::getGlobalIndicesByComponent(
     pairs.reserve(ls.size());
 
     // Create a sub dictionary containing all lines with location from ls.
-    auto const& m = _dict.get<ByLocation>();
     for (const auto& l : ls)
     {
-        auto const p = m.equal_range(Line(l));
-        for (auto itr = p.first; itr != p.second; ++itr)
-        {
-            pairs.emplace_back(itr->comp_id, itr->global_index);
-        }
+        _dict.forEachComponentAt(
+            l, [&pairs](int const comp_id, GlobalIndexType const global_index)
+            { pairs.emplace_back(comp_id, global_index); });
     }
 
     auto CIPairLess = [](CIPair const& a, CIPair const& b)
@@ -299,6 +288,13 @@ GlobalIndexType MeshComponentMap::getLocalIndex(
 void MeshComponentMap::createSerialMeshComponentMap(
     std::vector<MeshLib::MeshSubset> const& components, ComponentOrder order)
 {
+    _dict = ComponentGlobalIndexDict(static_cast<int>(components.size()));
+    for (auto const& c : components)
+    {
+        _dict.reserve(c.getMeshID(), MeshLib::MeshItemType::Node,
+                      c.getMesh().getNumberOfNodes());
+    }
+
     // construct dict (and here we number global_index by component type)
     GlobalIndexType global_index = 0;
     int comp_id = 0;
@@ -310,9 +306,8 @@ void MeshComponentMap::createSerialMeshComponentMap(
         for (std::size_t j = 0; j < mesh_subset_nodes.size(); j++)
         {
             auto const node_id = mesh_subset_nodes[j]->getID();
-            _dict.insert(
-                Line(Location(mesh_id, MeshLib::MeshItemType::Node, node_id),
-                     comp_id, global_index++));
+            _dict.insert(Location(mesh_id, MeshLib::MeshItemType::Node, node_id),
+                         comp_id, global_index++);
         }
         comp_id++;
     }
@@ -426,6 +421,13 @@ void MeshComponentMap::createParallelMeshComponentMap(
     //
     int const n_components = components.size();
 
+    _dict = ComponentGlobalIndexDict(n_components);
+    for (auto const& c : components)
+    {
+        _dict.reserve(c.getMeshID(), MeshLib::MeshItemType::Node,
+                      c.getMesh().getNumberOfNodes());
+    }
+
     int comp_id = 0;
     int comp_id_at_high_order_node = 0;
     _num_global_dof = 0;
@@ -476,8 +478,8 @@ void MeshComponentMap::createParallelMeshComponentMap(
             }
 
             _dict.insert(
-                Line(Location(mesh_id, MeshLib::MeshItemType::Node, node_id),
-                     comp_id, global_index));
+                Location(mesh_id, MeshLib::MeshItemType::Node, node_id),
+                comp_id, global_index);
         }
 
         bool const use_whole_nodes =
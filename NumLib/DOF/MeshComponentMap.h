@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include "ComponentGlobalIndexDict.h"
 #include "MeshLib/MeshSubset.h"
 #include "numlib_export.h"
@@ -148,28 +150,24 @@ public:
     friend std::ostream& operator<<(std::ostream& os, MeshComponentMap const& m)
     {
         os << "Dictionary size: " << m._dict.size() << "\n";
-        for (auto l : m._dict)
-            os << l << "\n";
+        m._dict.forEach(
+            [&os](Location const& l, int const comp_id,
+                  GlobalIndexType const global_index)
+            { os << l << ", " << comp_id << ", " << global_index << "\n"; });
         return os;
     }
 #endif  // NDEBUG
 
 private:
     /// Private constructor used by internally created mesh component maps.
-    explicit MeshComponentMap(detail::ComponentGlobalIndexDict& dict)
-        : _dict(dict)
+    explicit MeshComponentMap(detail::ComponentGlobalIndexDict dict)
+        : _dict(std::move(dict))
     {
     }
 
-    /// Looks up if a line is already stored in the dictionary.
-    /// \attention The line for the location l and component id must exist,
-    /// the behaviour is undefined otherwise.
-    /// \return a copy of the line.
-    detail::Line getLine(Location const& l, int const comp_id) const;
-
     void renumberByLocation(GlobalIndexType offset = 0);
 
-    detail::ComponentGlobalIndexDict _dict;
+    detail::ComponentGlobalIndexDict _dict{0};
 
     /// Number of local unknowns excluding those associated
     /// with ghost nodes (for domain decomposition).
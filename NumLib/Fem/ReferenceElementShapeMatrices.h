@@ -0,0 +1,237 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+#include <boost/math/constants/constants.hpp>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "BaseLib/Error.h"
+#include "MeshLib/ElementCoordinatesMappingLocal.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Node.h"
+
+namespace NumLib
+{
+/// Shape functions and their derivatives w.r.t. the natural coordinates at the
+/// integration points of the reference element.
+///
+/// These do not depend on the element geometry, hence one instance is shared
+/// by all elements with the same shape function and integration order, see
+/// getReferenceElementShapeMatrices().
+template <typename ShapeMatricesType>
+struct ReferenceElementShapeMatrices
+{
+    using ShapeType = typename ShapeMatricesType::ShapeMatrices::ShapeType;
+    using DrShapeType = typename ShapeMatricesType::ShapeMatrices::DrShapeType;
+
+    std::vector<ShapeType, Eigen::aligned_allocator<ShapeType>> N;
+    std::vector<DrShapeType, Eigen::aligned_allocator<DrShapeType>> dNdr;
+    /// Quadrature weights of the integration points.
+    std::vector<double> weights;
+};
+
+/// Geometry dependent quantities at one integration point of an element.
+template <typename ShapeMatricesType>
+struct GeometricShapeMatrices
+{
+    typename ShapeMatricesType::ShapeMatrices::DxShapeType dNdx;
+    /// Product of the quadrature weight, the integral measure and detJ.
+    double integration_weight;
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
+};
+
+namespace detail
+{
+template <typename ShapeFunction, typename ShapeMatricesType,
+          typename IntegrationMethod>
+ReferenceElementShapeMatrices<ShapeMatricesType>
+computeReferenceElementShapeMatrices(
+    IntegrationMethod const& integration_method)
+{
+    unsigned const n_integration_points =
+        integration_method.getNumberOfPoints();
+
+    ReferenceElementShapeMatrices<ShapeMatricesType> reference;
+    reference.N.reserve(n_integration_points);
+    reference.dNdr.reserve(n_integration_points);
+    reference.weights.reserve(n_integration_points);
+    for (unsigned ip = 0; ip < n_integration_points; ip++)
+    {
+        auto const& p = integration_method.getWeightedPoint(ip);
+
+        auto& N = reference.N.emplace_back(ShapeFunction::NPOINTS);
+        N.setZero();
+        ShapeFunction::computeShapeFunction(p.data(), N);
+
+        auto& dNdr = reference.dNdr.emplace_back(ShapeFunction::DIM,
+                                                 ShapeFunction::NPOINTS);
+        dNdr.setZero();
+        if constexpr (ShapeFunction::DIM != 0)
+        {
+            double* const dNdr_data = dNdr.data();
+            ShapeFunction::computeGradShapeFunction(p.data(), dNdr_data);
+        }
+
+        reference.weights.push_back(p.getWeight());
+    }
+    return reference;
+}
+}  // namespace detail
+
+/// Returns the shape matrices of the reference element for the given shape
+/// function and integration order. They are computed on the first request and
+/// cached for the whole run.
+///
+/// The function is thread-safe. The returned reference stays valid until the
+/// program ends.
+template <typename ShapeFunction, typename ShapeMatricesType,
+          typename IntegrationMethod>
+ReferenceElementShapeMatrices<ShapeMatricesType> const&
+getReferenceElementShapeMatrices(IntegrationMethod const& integration_method)
+{
+    static std::mutex mutex;
+    // std::map does not invalidate references to its elements on insertion.
+    static std::map<unsigned, ReferenceElementShapeMatrices<ShapeMatricesType>>
+        cache;
+
+    std::lock_guard<std::mutex> const lock(mutex);
+    unsigned const order = integration_method.getIntegrationOrder();
+    auto it = cache.find(order);
+    if (it == cache.end())
+    {
+        it = cache
+                 .emplace(order,
+                          detail::computeReferenceElementShapeMatrices<
+                              ShapeFunction, ShapeMatricesType>(
+                              integration_method))
+                 .first;
+    }
+    return it->second;
+}
+
+/// Computes dNdx and the integration weight at the integration point \c ip
+/// from the cached reference element quantities.
+///
+/// This is the same computation as done by NaturalCoordinatesMapping for
+/// ShapeMatrixType::ALL, without recomputing N and dNdr. It is cheap enough to
+/// be called in every assembly if storing dNdx for all integration points of
+/// a large mesh is not affordable.
+///
+/// \param ele_local_coord Node coordinates of \c e mapped to the element's
+///                        local coordinate system. It can be reused for all
+///                        integration points of the element.
+template <typename ShapeFunction, typename ShapeMatricesType>
+void computeGeometricShapeMatrices(
+    MeshLib::Element const& e,
+    MeshLib::ElementCoordinatesMappingLocal const& ele_local_coord,
+    bool const is_axially_symmetric,
+    ReferenceElementShapeMatrices<ShapeMatricesType> const& reference,
+    unsigned const ip,
+    GeometricShapeMatrices<ShapeMatricesType>& geometric)
+{
+    static_assert(ShapeFunction::DIM != 0,
+                  "Point elements do not have shape function derivatives.");
+    auto constexpr dim = ShapeFunction::DIM;
+    auto constexpr nnodes = ShapeFunction::NPOINTS;
+
+    auto const& N = reference.N[ip];
+    auto const& dNdr = reference.dNdr[ip];
+
+    // jacobian: J=[dx/dr dy/dr // dx/ds dy/ds]
+    typename ShapeMatricesType::ShapeMatrices::JacobianType J(dim, dim);
+    J.setZero();
+    for (unsigned k = 0; k < nnodes; k++)
+    {
+        MathLib::Point3d const& mapped_pt =
+            ele_local_coord.getMappedCoordinates(k);
+        for (unsigned i_r = 0; i_r < dim; i_r++)
+        {
+            for (unsigned j_x = 0; j_x < dim; j_x++)
+            {
+                J(i_r, j_x) += dNdr(i_r, k) * mapped_pt[j_x];
+            }
+        }
+    }
+    double const detJ = J.determinant();
+    if (detJ <= 0)
+    {
+        OGS_FATAL(
+            "det J = {:g} is not positive for element {:d}. Please check the "
+            "node numbering of the element.",
+            detJ, e.getID());
+    }
+    typename ShapeMatricesType::ShapeMatrices::JacobianType const invJ =
+        J.inverse();
+
+    unsigned const global_dim = ele_local_coord.getGlobalDimension();
+    geometric.dNdx.setZero(global_dim, nnodes);
+    if (global_dim == dim)
+    {
+        geometric.dNdx.template topLeftCorner<dim, nnodes>().noalias() =
+            invJ * dNdr;
+    }
+    else
+    {
+        auto const& matR =
+            (ele_local_coord.getRotationMatrixToGlobal().topLeftCorner(
+                 global_dim, dim))
+                .eval();
+        auto const invJ_dNdr = invJ * dNdr;
+        auto const dshape_global = matR * invJ_dNdr;
+        geometric.dNdx = dshape_global.topLeftCorner(global_dim, nnodes);
+    }
+
+    double integral_measure = 1.0;
+    if (is_axially_symmetric)
+    {
+        typename ReferenceElementShapeMatrices<ShapeMatricesType>::ShapeType
+            xs(nnodes);
+        for (unsigned k = 0; k < nnodes; k++)
+        {
+            xs[k] = (*e.getNode(k))[0];
+        }
+        integral_measure =
+            boost::math::constants::two_pi<double>() * N.dot(xs);
+    }
+
+    geometric.integration_weight =
+        reference.weights[ip] * integral_measure * detJ;
+}
+
+/// Computes the geometric shape matrices for all integration points of the
+/// element, e.g., to be stored by a local assembler.
+template <typename ShapeFunction, typename ShapeMatricesType, int GlobalDim>
+std::vector<GeometricShapeMatrices<ShapeMatricesType>,
+            Eigen::aligned_allocator<GeometricShapeMatrices<ShapeMatricesType>>>
+initGeometricShapeMatrices(
+    MeshLib::Element const& e, bool const is_axially_symmetric,
+    ReferenceElementShapeMatrices<ShapeMatricesType> const& reference)
+{
+    MeshLib::ElementCoordinatesMappingLocal const ele_local_coord(e,
+                                                                  GlobalDim);
+
+    std::vector<
+        GeometricShapeMatrices<ShapeMatricesType>,
+        Eigen::aligned_allocator<GeometricShapeMatrices<ShapeMatricesType>>>
+        geometric(reference.N.size());
+    for (unsigned ip = 0; ip < geometric.size(); ip++)
+    {
+        computeGeometricShapeMatrices<ShapeFunction>(
+            e, ele_local_coord, is_axially_symmetric, reference, ip,
+            geometric[ip]);
+    }
+    return geometric;
+}
+}  // namespace NumLib
@@ -12,16 +12,56 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include "BaseLib/AllocationCounter.h"
 #include "BaseLib/ConfigTree.h"
 #include "BaseLib/Error.h"
 #include "BaseLib/Logging.h"
-#include "BaseLib/RunTime.h"
+#include "BaseLib/Profiler.h"
 #include "ConvergenceCriterion.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "NumLib/DOF/GlobalMatrixProviders.h"
 #include "NumLib/Exceptions.h"
 #include "PETScNonlinearSolver.h"
 
+namespace
+{
+void logAssemblyAllocations(BaseLib::AllocationCounter const& allocations)
+{
+    if (BaseLib::AllocationCounter::isEnabled())
+    {
+        INFO("Assembly did {:d} heap allocations.", allocations.count());
+    }
+}
+
+/// Solves the linear system \f$ A x = b \f$. If a reduced linear system is
+/// given, only the unknowns without known solutions are passed to the linear
+/// solver.
+template <typename System>
+bool solveLinearSystem(
+    GlobalLinearSolver& linear_solver,
+    [[maybe_unused]] MathLib::EigenReducedLinearSystem* const reduced_system,
+    [[maybe_unused]] System const& sys, GlobalMatrix& A, GlobalVector& b,
+    GlobalVector& x)
+{
+#ifndef USE_PETSC
+    if (reduced_system != nullptr)
+    {
+        reduced_system->restrictSystem(A, b, x, sys.getKnownSolutionIds());
+        if (reduced_system->size() > 0 &&
+            !linear_solver.solve(reduced_system->getMatrix(),
+                                 reduced_system->getRHS(),
+                                 reduced_system->getSolution()))
+        {
+            return false;
+        }
+        reduced_system->prolongateSolution(A, b, x);
+        return true;
+    }
+#endif  // USE_PETSC
+    return linear_solver.solve(A, b, x);
+}
+}  // namespace
+
 namespace NumLib
 {
 void NonlinearSolver<NonlinearSolverTag::Picard>::
@@ -62,6 +102,17 @@ void NonlinearSolver<NonlinearSolverTag::Picard>::
     NumLib::GlobalVectorProvider::provider.releaseVector(rhs);
 }
 
+void NonlinearSolver<NonlinearSolverTag::Picard>::
+    setNonEquilibriumInitialResiduum(GlobalVector const& r_neq)
+{
+    if (_r_neq != nullptr)
+    {
+        NumLib::GlobalVectorProvider::provider.releaseVector(*_r_neq);
+    }
+    _r_neq =
+        &NumLib::GlobalVectorProvider::provider.getVector(r_neq, _r_neq_id);
+}
+
 NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
     std::vector<GlobalVector*>& x,
     std::vector<GlobalVector*> const& x_prev,
@@ -87,25 +138,29 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
     int iteration = 1;
     for (; iteration <= _maxiter; ++iteration, _convergence_criterion->reset())
     {
-        BaseLib::RunTime timer_dirichlet;
+        BaseLib::ProfilerRegion time_iteration("nonlinear_iteration");
+        BaseLib::Profiler::count("nonlinear_iterations");
         double time_dirichlet = 0.0;
 
-        BaseLib::RunTime time_iteration;
-        time_iteration.start();
-
-        timer_dirichlet.start();
-        sys.computeKnownSolutions(*x_new[process_id], process_id);
-        sys.applyKnownSolutions(*x_new[process_id]);
-        time_dirichlet += timer_dirichlet.elapsed();
+        {
+            BaseLib::ProfilerRegion timer_dirichlet("dirichlet_bcs");
+            sys.computeKnownSolutions(*x_new[process_id], process_id);
+            sys.applyKnownSolutions(*x_new[process_id]);
+            time_dirichlet += timer_dirichlet.elapsed();
+        }
 
         sys.preIteration(iteration, *x_new[process_id]);
 
-        BaseLib::RunTime time_assembly;
-        time_assembly.start();
-        sys.assemble(x_new, x_prev, process_id);
-        sys.getA(A);
-        sys.getRhs(*x_prev[process_id], rhs);
-        INFO("[time] Assembly took {:g} s.", time_assembly.elapsed());
+        {
+            BaseLib::ProfilerRegion time_assembly("assembly");
+            BaseLib::AllocationCounter assembly_allocations;
+            assembly_allocations.start();
+            sys.assemble(x_new, x_prev, process_id);
+            sys.getA(A);
+            sys.getRhs(*x_prev[process_id], rhs);
+            INFO("[time] Assembly took {:g} s.", time_assembly.elapsed());
+            logAssemblyAllocations(assembly_allocations);
+        }
 
         // Subtract non-equilibrium initial residuum if set
         if (_r_neq != nullptr)
@@ -113,9 +168,11 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
             LinAlg::axpy(rhs, -1, *_r_neq);
         }
 
-        timer_dirichlet.start();
-        sys.applyKnownSolutionsPicard(A, rhs, *x_new[process_id]);
-        time_dirichlet += timer_dirichlet.elapsed();
+        {
+            BaseLib::ProfilerRegion timer_dirichlet("dirichlet_bcs");
+            sys.applyKnownSolutionsPicard(A, rhs, *x_new[process_id]);
+            time_dirichlet += timer_dirichlet.elapsed();
+        }
         INFO("[time] Applying Dirichlet BCs took {:g} s.", time_dirichlet);
 
         if (!sys.isLinear() && _convergence_criterion->hasResidualCheck())
@@ -126,11 +183,15 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
             _convergence_criterion->checkResidual(res);
         }
 
-        BaseLib::RunTime time_linear_solver;
-        time_linear_solver.start();
-        bool iteration_succeeded =
-            _linear_solver.solve(A, rhs, *x_new[process_id]);
-        INFO("[time] Linear solver took {:g} s.", time_linear_solver.elapsed());
+        bool iteration_succeeded;
+        {
+            BaseLib::ProfilerRegion time_linear_solver("linear_solver");
+            iteration_succeeded =
+                solveLinearSystem(_linear_solver, _reduced_linear_system.get(),
+                                  sys, A, rhs, *x_new[process_id]);
+            INFO("[time] Linear solver took {:g} s.",
+                 time_linear_solver.elapsed());
+        }
 
         if (!iteration_succeeded)
         {
@@ -255,6 +316,17 @@ void NonlinearSolver<NonlinearSolverTag::Newton>::
     MathLib::LinAlg::finalizeAssembly(*_r_neq);
 }
 
+void NonlinearSolver<NonlinearSolverTag::Newton>::
+    setNonEquilibriumInitialResiduum(GlobalVector const& r_neq)
+{
+    if (_r_neq != nullptr)
+    {
+        NumLib::GlobalVectorProvider::provider.releaseVector(*_r_neq);
+    }
+    _r_neq =
+        &NumLib::GlobalVectorProvider::provider.getVector(r_neq, _r_neq_id);
+}
+
 NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
     std::vector<GlobalVector*>& x,
     std::vector<GlobalVector*> const& x_prev,
@@ -281,36 +353,41 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
     int iteration = 1;
     for (; iteration <= _maxiter; ++iteration, _convergence_criterion->reset())
     {
-        BaseLib::RunTime timer_dirichlet;
+        BaseLib::ProfilerRegion time_iteration("nonlinear_iteration");
+        BaseLib::Profiler::count("nonlinear_iterations");
         double time_dirichlet = 0.0;
 
-        BaseLib::RunTime time_iteration;
-        time_iteration.start();
-
-        timer_dirichlet.start();
-        sys.computeKnownSolutions(*x[process_id], process_id);
-        sys.applyKnownSolutions(*x[process_id]);
-        time_dirichlet += timer_dirichlet.elapsed();
+        {
+            BaseLib::ProfilerRegion timer_dirichlet("dirichlet_bcs");
+            sys.computeKnownSolutions(*x[process_id], process_id);
+            sys.applyKnownSolutions(*x[process_id]);
+            time_dirichlet += timer_dirichlet.elapsed();
+        }
 
         sys.preIteration(iteration, *x[process_id]);
 
-        BaseLib::RunTime time_assembly;
-        time_assembly.start();
-        try
-        {
-            sys.assemble(x, x_prev, process_id);
-        }
-        catch (AssemblyException const& e)
         {
-            ERR("Abort nonlinear iteration. Repeating timestep. Reason: {:s}",
-                e.what());
-            error_norms_met = false;
-            iteration = _maxiter;
-            break;
+            BaseLib::ProfilerRegion time_assembly("assembly");
+            BaseLib::AllocationCounter assembly_allocations;
+            assembly_allocations.start();
+            try
+            {
+                sys.assemble(x, x_prev, process_id);
+            }
+            catch (AssemblyException const& e)
+            {
+                ERR("Abort nonlinear iteration. Repeating timestep. Reason: "
+                    "{:s}",
+                    e.what());
+                error_norms_met = false;
+                iteration = _maxiter;
+                break;
+            }
+            sys.getResidual(*x[process_id], *x_prev[process_id], res);
+            sys.getJacobian(J);
+            INFO("[time] Assembly took {:g} s.", time_assembly.elapsed());
+            logAssemblyAllocations(assembly_allocations);
         }
-        sys.getResidual(*x[process_id], *x_prev[process_id], res);
-        sys.getJacobian(J);
-        INFO("[time] Assembly took {:g} s.", time_assembly.elapsed());
 
         // Subtract non-equilibrium initial residuum if set
         if (_r_neq != nullptr)
@@ -318,9 +395,11 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
 
         minus_delta_x.setZero();
 
-        timer_dirichlet.start();
-        sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
-        time_dirichlet += timer_dirichlet.elapsed();
+        {
+            BaseLib::ProfilerRegion timer_dirichlet("dirichlet_bcs");
+            sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
+            time_dirichlet += timer_dirichlet.elapsed();
+        }
         INFO("[time] Applying Dirichlet BCs took {:g} s.", time_dirichlet);
 
         if (!sys.isLinear() && _convergence_criterion->hasResidualCheck())
@@ -328,10 +407,15 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             _convergence_criterion->checkResidual(res);
         }
 
-        BaseLib::RunTime time_linear_solver;
-        time_linear_solver.start();
-        bool iteration_succeeded = _linear_solver.solve(J, res, minus_delta_x);
-        INFO("[time] Linear solver took {:g} s.", time_linear_solver.elapsed());
+        bool iteration_succeeded;
+        {
+            BaseLib::ProfilerRegion time_linear_solver("linear_solver");
+            iteration_succeeded =
+                solveLinearSystem(_linear_solver, _reduced_linear_system.get(),
+                                  sys, J, res, minus_delta_x);
+            INFO("[time] Linear solver took {:g} s.",
+                 time_linear_solver.elapsed());
+        }
 
         if (!iteration_succeeded)
         {
@@ -441,13 +525,25 @@ createNonlinearSolver(GlobalLinearSolver& linear_solver,
     auto const type = config.getConfigParameter<std::string>("type");
     //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__max_iter}
     auto const max_iter = config.getConfigParameter<int>("max_iter");
+    auto const reduce_linear_system =
+        //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__reduce_linear_system}
+        config.getConfigParameter<bool>("reduce_linear_system", false);
+#ifdef USE_PETSC
+    if (reduce_linear_system)
+    {
+        OGS_FATAL(
+            "The reduced linear system is not available for PETSc matrices.");
+    }
+#endif  // USE_PETSC
 
     if (type == "Picard")
     {
         auto const tag = NonlinearSolverTag::Picard;
         using ConcreteNLS = NonlinearSolver<tag>;
         return std::make_pair(
-            std::make_unique<ConcreteNLS>(linear_solver, max_iter), tag);
+            std::make_unique<ConcreteNLS>(linear_solver, max_iter,
+                                          reduce_linear_system),
+            tag);
     }
     if (type == "Newton")
     {
@@ -463,7 +559,8 @@ createNonlinearSolver(GlobalLinearSolver& linear_solver,
         auto const tag = NonlinearSolverTag::Newton;
         using ConcreteNLS = NonlinearSolver<tag>;
         return std::make_pair(
-            std::make_unique<ConcreteNLS>(linear_solver, max_iter, damping),
+            std::make_unique<ConcreteNLS>(linear_solver, max_iter, damping,
+                                          reduce_linear_system),
             tag);
     }
 #ifdef USE_PETSC
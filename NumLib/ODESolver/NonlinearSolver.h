@@ -14,6 +14,7 @@
 #include <utility>
 
 #include "ConvergenceCriterion.h"
+#include "MathLib/LinAlg/Eigen/EigenReducedLinearSystem.h"
 #include "NonlinearSolverStatus.h"
 #include "NonlinearSystem.h"
 #include "Types.h"
@@ -39,6 +40,18 @@ public:
         std::vector<GlobalVector*> const& x,
         std::vector<GlobalVector*> const& x_prev, int const process_id) = 0;
 
+    /// True if the non-equilibrium initial residuum is compensated.
+    virtual bool isNonEquilibriumInitialResiduumCompensated() const = 0;
+
+    /// The non-equilibrium initial residuum, or nullptr if it has been neither
+    /// calculated nor set.
+    virtual GlobalVector const* getNonEquilibriumInitialResiduum() const = 0;
+
+    /// Sets the non-equilibrium initial residuum instead of calculating it,
+    /// e.g. on a restart, where the current state is not the initial one.
+    virtual void setNonEquilibriumInitialResiduum(
+        GlobalVector const& r_neq) = 0;
+
     /*! Assemble and solve the equation system.
      *
      * \param x   in: the initial guess, out: the solution.
@@ -85,13 +98,21 @@ public:
      * \param maxiter the maximum number of iterations used to solve the
      *                equation.
      * \param damping A positive damping factor.
+     * \param reduce_linear_system solve the linear system for the unknowns
+     *        without known solutions only.
      * \see _damping
      */
     explicit NonlinearSolver(GlobalLinearSolver& linear_solver,
                              int const maxiter,
-                             double const damping = 1.0)
+                             double const damping = 1.0,
+                             bool const reduce_linear_system = false)
         : _linear_solver(linear_solver), _maxiter(maxiter), _damping(damping)
     {
+        if (reduce_linear_system)
+        {
+            _reduced_linear_system =
+                std::make_unique<MathLib::EigenReducedLinearSystem>();
+        }
     }
 
     ~NonlinearSolver();
@@ -109,6 +130,18 @@ public:
         std::vector<GlobalVector*> const& x_prev,
         int const process_id) override;
 
+    bool isNonEquilibriumInitialResiduumCompensated() const override
+    {
+        return _compensate_non_equilibrium_initial_residuum;
+    }
+
+    GlobalVector const* getNonEquilibriumInitialResiduum() const override
+    {
+        return _r_neq;
+    }
+
+    void setNonEquilibriumInitialResiduum(GlobalVector const& r_neq) override;
+
     NonlinearSolverStatus solve(
         std::vector<GlobalVector*>& x,
         std::vector<GlobalVector*> const& x_prev,
@@ -150,6 +183,11 @@ private:
     /// During the simulation the new residuum reads \f$ \tilde r = r - r_{\rm
     /// neq} \f$.
     bool _compensate_non_equilibrium_initial_residuum = false;
+
+    /// Compact linear system of the unknowns without known solutions, e.g.
+    /// without the unknowns of deactivated subdomains. Only used if the
+    /// reduction is enabled.
+    std::unique_ptr<MathLib::EigenReducedLinearSystem> _reduced_linear_system;
 };
 
 /*! Find a solution to a nonlinear equation using the Picard fixpoint iteration
@@ -169,11 +207,19 @@ public:
      * \param linear_solver the linear solver used by this nonlinear solver.
      * \param maxiter the maximum number of iterations used to solve the
      *                equation.
+     * \param reduce_linear_system solve the linear system for the unknowns
+     *        without known solutions only.
      */
     explicit NonlinearSolver(GlobalLinearSolver& linear_solver,
-                             const int maxiter)
+                             const int maxiter,
+                             bool const reduce_linear_system = false)
         : _linear_solver(linear_solver), _maxiter(maxiter)
     {
+        if (reduce_linear_system)
+        {
+            _reduced_linear_system =
+                std::make_unique<MathLib::EigenReducedLinearSystem>();
+        }
     }
 
     ~NonlinearSolver();
@@ -191,6 +237,18 @@ public:
         std::vector<GlobalVector*> const& x_prev,
         int const process_id) override;
 
+    bool isNonEquilibriumInitialResiduumCompensated() const override
+    {
+        return _compensate_non_equilibrium_initial_residuum;
+    }
+
+    GlobalVector const* getNonEquilibriumInitialResiduum() const override
+    {
+        return _r_neq;
+    }
+
+    void setNonEquilibriumInitialResiduum(GlobalVector const& r_neq) override;
+
     NonlinearSolverStatus solve(
         std::vector<GlobalVector*>& x,
         std::vector<GlobalVector*> const& x_prev,
@@ -222,6 +280,8 @@ private:
     // clang-format off
     /// \copydoc NumLib::NonlinearSolver<NonlinearSolverTag::Newton>::_compensate_non_equilibrium_initial_residuum
     bool _compensate_non_equilibrium_initial_residuum = false;
+    /// \copydoc NumLib::NonlinearSolver<NonlinearSolverTag::Newton>::_reduced_linear_system
+    std::unique_ptr<MathLib::EigenReducedLinearSystem> _reduced_linear_system;
     // clang-format on
 };
 
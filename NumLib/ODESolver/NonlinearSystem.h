@@ -77,6 +77,10 @@ public:
         GlobalMatrix& Jac, GlobalVector& res,
         GlobalVector& minus_delta_x) const = 0;
 
+    //! Returns the global indices of all known solutions.
+    //! \pre computeKnownSolutions() must have been called before.
+    virtual std::vector<GlobalIndexType> getKnownSolutionIds() const = 0;
+
     virtual void updateConstraints(GlobalVector& /*lower*/,
                                    GlobalVector& /*upper*/,
                                    int /*process_id*/) = 0;
@@ -126,6 +130,10 @@ public:
     //! \pre computeKnownSolutions() must have been called before.
     virtual void applyKnownSolutionsPicard(GlobalMatrix& A, GlobalVector& rhs,
                                            GlobalVector& x) const = 0;
+
+    //! Returns the global indices of all known solutions.
+    //! \pre computeKnownSolutions() must have been called before.
+    virtual std::vector<GlobalIndexType> getKnownSolutionIds() const = 0;
 };
 
 //! @}
@@ -15,7 +15,8 @@
 #include <petscmat.h>
 #include <petscvec.h>
 
-#include "BaseLib/RunTime.h"
+#include "BaseLib/AllocationCounter.h"
+#include "BaseLib/Profiler.h"
 
 namespace
 {
@@ -40,11 +41,17 @@ PetscErrorCode updateResidual(SNES /*snes*/, Vec x, Vec petsc_r,
     VecCopy(x, context->x[context->process_id]->getRawVector());
 
     // Assemble in ogs context.
-    BaseLib::RunTime time_assembly;
-    time_assembly.start();
+    BaseLib::ProfilerRegion time_assembly("assembly");
+    BaseLib::AllocationCounter assembly_allocations;
+    assembly_allocations.start();
     context->system->assemble(context->x, context->x_prev, context->process_id);
 
     INFO("[time] Assembly took {} s.", time_assembly.elapsed());
+    if (BaseLib::AllocationCounter::isEnabled())
+    {
+        INFO("Assembly did {:d} heap allocations.",
+             assembly_allocations.count());
+    }
     context->system->getResidual(*context->x[context->process_id],
                                  *context->x_prev[context->process_id],
                                  *context->r);
@@ -130,6 +137,14 @@ void PETScNonlinearSolver::calculateNonEquilibriumInitialResiduum(
         "PETScNonlinearSolver.");
 }
 
+void PETScNonlinearSolver::setNonEquilibriumInitialResiduum(
+    GlobalVector const& /*r_neq*/)
+{
+    OGS_FATAL(
+        "Non-equilibrium initial residuum is not implemented for the "
+        "PETScNonlinearSolver.");
+}
+
 NonlinearSolverStatus PETScNonlinearSolver::solve(
     std::vector<GlobalVector*>& x,
     std::vector<GlobalVector*> const& x_prev,
@@ -156,14 +171,13 @@ NonlinearSolverStatus PETScNonlinearSolver::solve(
     // during the SNES' solve call.
     auto& J_snes = NumLib::GlobalMatrixProvider::provider.getMatrix(
         system->getMatrixSpecifications(process_id), _petsc_jacobian_id);
-    BaseLib::RunTime timer_dirichlet;
-    double time_dirichlet = 0.0;
-
-    timer_dirichlet.start();
-    system->computeKnownSolutions(*x[process_id], process_id);
-    system->applyKnownSolutions(*x[process_id]);
-    time_dirichlet += timer_dirichlet.elapsed();
-    INFO("[time] Applying Dirichlet BCs took {} s.", time_dirichlet);
+    {
+        BaseLib::ProfilerRegion timer_dirichlet("dirichlet_bcs");
+        system->computeKnownSolutions(*x[process_id], process_id);
+        system->applyKnownSolutions(*x[process_id]);
+        INFO("[time] Applying Dirichlet BCs took {} s.",
+             timer_dirichlet.elapsed());
+    }
 
     auto& r_snes = NumLib::GlobalVectorProvider::provider.getVector(
         system->getMatrixSpecifications(process_id), _petsc_residual_id);
@@ -48,6 +48,18 @@ public:
         std::vector<GlobalVector*> const& x_prev,
         int const process_id) override;
 
+    bool isNonEquilibriumInitialResiduumCompensated() const override
+    {
+        return _compensate_non_equilibrium_initial_residuum;
+    }
+
+    GlobalVector const* getNonEquilibriumInitialResiduum() const override
+    {
+        return nullptr;
+    }
+
+    void setNonEquilibriumInitialResiduum(GlobalVector const& r_neq) override;
+
     NonlinearSolverStatus solve(
         std::vector<GlobalVector*>& x,
         std::vector<GlobalVector*> const& x_prev,
@@ -38,6 +38,24 @@ void applyKnownSolutions(std::vector<Solutions> const* const known_solutions,
     }
     MathLib::LinAlg::finalizeAssembly(x);
 }
+
+//! Collects the global indices of all known solutions.
+template <typename Solutions>
+std::vector<GlobalIndexType> knownSolutionIds(
+    std::vector<Solutions> const* const known_solutions)
+{
+    std::vector<GlobalIndexType> ids;
+    if (!known_solutions)
+    {
+        return ids;
+    }
+
+    for (auto const& bc : *known_solutions)
+    {
+        ids.insert(end(ids), begin(bc.ids), end(bc.ids));
+    }
+    return ids;
+}
 }  // namespace detail
 
 namespace NumLib
@@ -184,6 +202,14 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     MathLib::applyKnownSolution(Jac, res, minus_delta_x, ids, values);
 }
 
+std::vector<GlobalIndexType>
+TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
+                         NonlinearSolverTag::Newton>::getKnownSolutionIds()
+    const
+{
+    return ::detail::knownSolutionIds(_known_solutions);
+}
+
 TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
                          NonlinearSolverTag::Picard>::
     TimeDiscretizedODESystem(const int process_id, ODE& ode,
@@ -285,4 +311,12 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     MathLib::applyKnownSolution(A, rhs, x, ids, values);
 }
 
+std::vector<GlobalIndexType>
+TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
+                         NonlinearSolverTag::Picard>::getKnownSolutionIds()
+    const
+{
+    return ::detail::knownSolutionIds(_known_solutions);
+}
+
 }  // namespace NumLib
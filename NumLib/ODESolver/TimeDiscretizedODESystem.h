@@ -108,6 +108,8 @@ public:
     void applyKnownSolutionsNewton(GlobalMatrix& Jac, GlobalVector& res,
                                    GlobalVector& minus_delta_x) const override;
 
+    std::vector<GlobalIndexType> getKnownSolutionIds() const override;
+
     void updateConstraints(GlobalVector& lower, GlobalVector& upper,
                            int const process_id) override
     {
@@ -219,6 +221,8 @@ public:
     void applyKnownSolutionsPicard(GlobalMatrix& A, GlobalVector& rhs,
                                    GlobalVector& x) const override;
 
+    std::vector<GlobalIndexType> getKnownSolutionIds() const override;
+
     bool isLinear() const override { return _ode.isLinear(); }
 
     void preIteration(const unsigned iter, GlobalVector const& x) override
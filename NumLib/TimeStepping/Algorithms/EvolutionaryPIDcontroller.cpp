@@ -148,4 +148,18 @@ bool EvolutionaryPIDcontroller::canReduceTimestepSize(
     return NumLib::canReduceTimestepSize(timestep_previous, timestep_current,
                                          _h_min);
 }
+
+void EvolutionaryPIDcontroller::setInternalState(
+    std::vector<double> const& state)
+{
+    if (state.size() != 2)
+    {
+        OGS_FATAL(
+            "The state of the EvolutionaryPIDcontroller consists of 2 values, "
+            "but {:d} values were given.",
+            state.size());
+    }
+    _e_n_minus1 = state[0];
+    _e_n_minus2 = state[1];
+}
 }  // namespace NumLib
@@ -73,6 +73,13 @@ public:
         NumLib::TimeStep const& timestep_previous,
         NumLib::TimeStep const& timestep_current) const override;
 
+    std::vector<double> getInternalState() const override
+    {
+        return {_e_n_minus1, _e_n_minus2};
+    }
+
+    void setInternalState(std::vector<double> const& state) override;
+
 private:
     const double _kP = 0.075;  ///< Parameter. \see EvolutionaryPIDcontroller
     const double _kI = 0.175;  ///< Parameter. \see EvolutionaryPIDcontroller
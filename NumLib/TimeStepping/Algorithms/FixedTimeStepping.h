@@ -74,6 +74,17 @@ public:
         return true;
     }
 
+    /// The step sizes, which are extended by resetCurrentTimeStep().
+    std::vector<double> getInternalState() const override
+    {
+        return _dt_vector;
+    }
+
+    void setInternalState(std::vector<double> const& state) override
+    {
+        _dt_vector = state;
+    }
+
 private:
     /// a vector of time step sizes
     std::vector<double> _dt_vector;
@@ -146,4 +146,18 @@ bool IterationNumberBasedTimeStepping::canReduceTimestepSize(
                                          _min_dt);
 }
 
+void IterationNumberBasedTimeStepping::setInternalState(
+    std::vector<double> const& state)
+{
+    if (state.size() != 2)
+    {
+        OGS_FATAL(
+            "The state of the IterationNumberBasedTimeStepping consists of 2 "
+            "values, but {:d} values were given.",
+            state.size());
+    }
+    _iter_times = static_cast<int>(state[0]);
+    _previous_time_step_accepted = state[1] != 0.;
+}
+
 }  // namespace NumLib
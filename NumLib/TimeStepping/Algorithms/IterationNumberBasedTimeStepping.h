@@ -102,6 +102,14 @@ public:
         NumLib::TimeStep const& timestep_previous,
         NumLib::TimeStep const& timestep_current) const override;
 
+    std::vector<double> getInternalState() const override
+    {
+        return {static_cast<double>(_iter_times),
+                _previous_time_step_accepted ? 1. : 0.};
+    }
+
+    void setInternalState(std::vector<double> const& state) override;
+
 private:
     /// Calculate the next time step size.
     double getNextTimeStepSize(NumLib::TimeStep const& ts_previous,
@@ -77,6 +77,22 @@ public:
         return false;
     }
 
+    /// Returns the internal state of the algorithm, which depends on the
+    /// history of the time stepping, e.g. for writing a checkpoint.
+    virtual std::vector<double> getInternalState() const { return {}; }
+
+    /// Restores the internal state returned by getInternalState().
+    virtual void setInternalState(std::vector<double> const& state)
+    {
+        if (!state.empty())
+        {
+            OGS_FATAL(
+                "The time stepping algorithm has no internal state, but {:d} "
+                "values were given.",
+                state.size());
+        }
+    }
+
 private:
     /// initial time
     const double _t_initial;
@@ -53,6 +53,24 @@ public:
     {
     }
 
+    /**
+     * Initialize a time step with a given step size, e.g. when restarting a
+     * simulation. Because of round-off errors the step size is not
+     * necessarily equal to the difference of the current and previous times.
+     * @param previous_time    previous time
+     * @param current_time     current time
+     * @param dt               time step size
+     * @param n                the number of time steps
+     */
+    TimeStep(double previous_time, double current_time, double dt,
+             std::size_t n)
+        : _previous(previous_time),
+          _current(current_time),
+          _dt(dt),
+          _time_step_number(n)
+    {
+    }
+
     /// copy a time step
     TimeStep(const TimeStep& src) = default;
 
@@ -50,6 +50,41 @@ struct ConstantParameter final : public Parameter<T>
         return this->rotateWithCoordinateSystem(_values, pos);
     }
 
+    std::span<T> evaluate(double const /*t*/, SpatialPosition const& pos,
+                          std::span<T> const values) const override
+    {
+        assert(values.size() >= _values.size());
+        std::copy(_values.begin(), _values.end(), values.begin());
+
+        if (!this->_coordinate_system)
+        {
+            return values.first(_values.size());
+        }
+
+        return this->rotateWithCoordinateSystem(values, _values.size(), pos);
+    }
+
+    void evaluateAtIntegrationPoints(
+        MeshLib::Element const& element, double const t,
+        std::span<MathLib::Point3d const> const ip_coordinates,
+        std::span<T> const values) const override
+    {
+        // The rotation might depend on the position.
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::evaluateAtIntegrationPoints(element, t,
+                                                      ip_coordinates, values);
+            return;
+        }
+
+        assert(values.size() == ip_coordinates.size() * _values.size());
+        for (auto it = values.begin(); it != values.end();
+             it += _values.size())
+        {
+            std::copy(_values.begin(), _values.end(), it);
+        }
+    }
+
     Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
         MeshLib::Element const& element, double const /*t*/) const override
     {
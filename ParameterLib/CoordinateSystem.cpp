@@ -150,7 +150,7 @@ Eigen::Matrix<double, 3, 3> CoordinateSystem::transformation_3d(
 
 template <int Dimension>
 Eigen::Matrix<double, Dimension, Dimension> CoordinateSystem::rotateTensor(
-    std::vector<double> const& values, SpatialPosition const& pos) const
+    std::span<double const> const values, SpatialPosition const& pos) const
 {
     assert(values.size() == Dimension * Dimension ||
            "Input vector has wrong dimension; expected 4 or 9 entries.");
@@ -163,7 +163,7 @@ Eigen::Matrix<double, Dimension, Dimension> CoordinateSystem::rotateTensor(
 
 template <int Dimension>
 Eigen::Matrix<double, Dimension, Dimension>
-CoordinateSystem::rotateDiagonalTensor(std::vector<double> const& values,
+CoordinateSystem::rotateDiagonalTensor(std::span<double const> const values,
                                        SpatialPosition const& pos) const
 {
     assert(values.size() == Dimension ||
@@ -175,11 +175,11 @@ CoordinateSystem::rotateDiagonalTensor(std::vector<double> const& values,
 }
 
 template Eigen::Matrix<double, 2, 2> CoordinateSystem::rotateTensor<2>(
-    std::vector<double> const& values, SpatialPosition const& pos) const;
+    std::span<double const> values, SpatialPosition const& pos) const;
 template Eigen::Matrix<double, 3, 3> CoordinateSystem::rotateTensor<3>(
-    std::vector<double> const& values, SpatialPosition const& pos) const;
+    std::span<double const> values, SpatialPosition const& pos) const;
 template Eigen::Matrix<double, 2, 2> CoordinateSystem::rotateDiagonalTensor<2>(
-    std::vector<double> const& values, SpatialPosition const& pos) const;
+    std::span<double const> values, SpatialPosition const& pos) const;
 template Eigen::Matrix<double, 3, 3> CoordinateSystem::rotateDiagonalTensor<3>(
-    std::vector<double> const& values, SpatialPosition const& pos) const;
+    std::span<double const> values, SpatialPosition const& pos) const;
 }  // namespace ParameterLib
@@ -12,7 +12,7 @@
 
 #include <Eigen/Dense>
 #include <array>
-#include <vector>
+#include <span>
 
 namespace ParameterLib
 {
@@ -40,24 +40,24 @@ struct CoordinateSystem final
 
     template <int Dimension>
     Eigen::Matrix<double, Dimension, Dimension> rotateTensor(
-        std::vector<double> const& values, SpatialPosition const& pos) const;
+        std::span<double const> values, SpatialPosition const& pos) const;
 
     template <int Dimension>
     Eigen::Matrix<double, Dimension, Dimension> rotateDiagonalTensor(
-        std::vector<double> const& values, SpatialPosition const& pos) const;
+        std::span<double const> values, SpatialPosition const& pos) const;
 
 private:
     std::array<Parameter<double> const*, 3> _base;
 };
 
 extern template Eigen::Matrix<double, 2, 2> CoordinateSystem::rotateTensor<2>(
-    std::vector<double> const& values, SpatialPosition const& pos) const;
+    std::span<double const> values, SpatialPosition const& pos) const;
 extern template Eigen::Matrix<double, 3, 3> CoordinateSystem::rotateTensor<3>(
-    std::vector<double> const& values, SpatialPosition const& pos) const;
+    std::span<double const> values, SpatialPosition const& pos) const;
 extern template Eigen::Matrix<double, 2, 2>
-CoordinateSystem::rotateDiagonalTensor<2>(std::vector<double> const& values,
+CoordinateSystem::rotateDiagonalTensor<2>(std::span<double const> values,
                                           SpatialPosition const& pos) const;
 extern template Eigen::Matrix<double, 3, 3>
-CoordinateSystem::rotateDiagonalTensor<3>(std::vector<double> const& values,
+CoordinateSystem::rotateDiagonalTensor<3>(std::span<double const> values,
                                           SpatialPosition const& pos) const;
 }  // namespace ParameterLib
@@ -39,6 +39,11 @@ struct CurveScaledParameter final : public Parameter<T>
         ParameterBase::_mesh = _parameter->mesh();
     }
 
+    void preTimestep(double const t) override
+    {
+        _scaling.set(t, _curve.getValue(t));
+    }
+
     int getNumberOfGlobalComponents() const override
     {
         return _parameter->getNumberOfGlobalComponents();
@@ -53,20 +58,60 @@ struct CurveScaledParameter final : public Parameter<T>
                "Coordinate system not expected to be set for curve scaled "
                "parameters.");
 
-        auto const& tup = (*_parameter)(t, pos);
-        auto const scaling = _curve.getValue(t);
-
-        auto const num_comp = _parameter->getNumberOfGlobalComponents();
-        std::vector<T> cache(num_comp);
-        for (int c = 0; c < num_comp; ++c)
+        auto cache = (*_parameter)(t, pos);
+        auto const scaling = getScaling(t);
+        for (auto& v : cache)
         {
-            cache[c] = scaling * tup[c];
+            v *= scaling;
         }
         return cache;
     }
 
+    std::span<T> evaluate(double const t, SpatialPosition const& pos,
+                          std::span<T> const values) const override
+    {
+        // No local coordinate transformation here, which might happen twice
+        // otherwise.
+        assert(!this->_coordinate_system ||
+               "Coordinate system not expected to be set for curve scaled "
+               "parameters.");
+
+        auto const scaled_values = _parameter->evaluate(t, pos, values);
+        auto const scaling = getScaling(t);
+        for (auto& v : scaled_values)
+        {
+            v *= scaling;
+        }
+        return scaled_values;
+    }
+
+    void evaluateAtIntegrationPoints(
+        MeshLib::Element const& element, double const t,
+        std::span<MathLib::Point3d const> const ip_coordinates,
+        std::span<T> const values) const override
+    {
+        _parameter->evaluateAtIntegrationPoints(element, t, ip_coordinates,
+                                                values);
+        auto const scaling = getScaling(t);
+        for (auto& v : values)
+        {
+            v *= scaling;
+        }
+    }
+
 private:
+    double getScaling(double const t) const
+    {
+        if (auto const* const scaling = _scaling.get(t))
+        {
+            return *scaling;
+        }
+        return _curve.getValue(t);
+    }
+
     MathLib::PiecewiseLinearInterpolation const& _curve;
+    /// Curve value at the time of the current time step.
+    TimeStepCache<double> _scaling;
     Parameter<T> const* _parameter;
     std::string const _referenced_parameter_name;
 };
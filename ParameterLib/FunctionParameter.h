@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <boost/algorithm/string/predicate.hpp>
+#include <deque>
 #include <exprtk.hpp>
 #include <utility>
 #include <vector>
@@ -90,17 +93,46 @@ struct FunctionParameter final : public Parameter<T>
         {
             _vec_expression[i].register_symbol_table(_symbol_table);
             parser_t parser;
+            parser.dec().collect_variables() = true;
             if (!parser.compile(vec_expression_str[i], _vec_expression[i]))
             {
                 OGS_FATAL("Error: {:s}\tExpression: {:s}\n",
                           parser.error(),
                           vec_expression_str[i]);
             }
+
+            std::deque<
+                typename parser_t::dependent_entity_collector::symbol_t>
+                variables;
+            parser.dec().symbols(variables);
+            if (std::any_of(variables.begin(), variables.end(),
+                            [](auto const& variable)
+                            {
+                                // exprtk symbols are case-insensitive.
+                                auto const& name = variable.first;
+                                return boost::iequals(name, "x") ||
+                                       boost::iequals(name, "y") ||
+                                       boost::iequals(name, "z");
+                            }))
+            {
+                _is_time_only = false;
+            }
         }
     }
 
     bool isTimeDependent() const override { return true; }
 
+    void preTimestep(double const t) override
+    {
+        if (!_is_time_only)
+        {
+            return;
+        }
+        std::vector<T> values(_vec_expression.size());
+        evaluateExpressions(t, std::nullopt, values);
+        _time_only_values.set(t, std::move(values));
+    }
+
     int getNumberOfGlobalComponents() const override
     {
         return _vec_expression.size();
@@ -109,40 +141,67 @@ struct FunctionParameter final : public Parameter<T>
     std::vector<T> operator()(double const t,
                               SpatialPosition const& pos) const override
     {
-        std::vector<T> cache(getNumberOfGlobalComponents());
-        auto& x = _symbol_table.get_variable("x")->ref();
-        auto& y = _symbol_table.get_variable("y")->ref();
-        auto& z = _symbol_table.get_variable("z")->ref();
-        auto& time = _symbol_table.get_variable("t")->ref();
-        if (!pos.getCoordinates())
+        std::vector<T> cache(
+            std::max<std::size_t>(9, getNumberOfGlobalComponents()));
+        auto const values = evaluate(t, pos, cache);
+        cache.resize(values.size());
+        return cache;
+    }
+
+    std::span<T> evaluate(double const t, SpatialPosition const& pos,
+                          std::span<T> const values) const override
+    {
+        auto const num_comp = _vec_expression.size();
+        assert(values.size() >= num_comp);
+        if (auto const* const cached = _time_only_values.get(t))
         {
-            OGS_FATAL(
-                "FunctionParameter: The spatial position has to be set by "
-                "coordinates.");
+            std::copy(cached->begin(), cached->end(), values.begin());
         }
-        auto const coords = pos.getCoordinates().value();
-        x = coords[0];
-        y = coords[1];
-        z = coords[2];
-        time = t;
-
-        for (unsigned i = 0; i < _vec_expression.size(); i++)
+        else
         {
-            cache[i] = _vec_expression[i].value();
+            if (!_is_time_only && !pos.getCoordinates())
+            {
+                OGS_FATAL(
+                    "FunctionParameter: The spatial position has to be set by "
+                    "coordinates.");
+            }
+            evaluateExpressions(t, pos.getCoordinates(), values);
         }
 
         if (!this->_coordinate_system)
         {
-            return cache;
+            return values.first(num_comp);
         }
 
-        return this->rotateWithCoordinateSystem(cache, pos);
+        return this->rotateWithCoordinateSystem(values, num_comp, pos);
     }
 
 private:
+    void evaluateExpressions(double const t,
+                             std::optional<MathLib::Point3d> const& coordinates,
+                             std::span<T> const values) const
+    {
+        if (coordinates)
+        {
+            _symbol_table.get_variable("x")->ref() = (*coordinates)[0];
+            _symbol_table.get_variable("y")->ref() = (*coordinates)[1];
+            _symbol_table.get_variable("z")->ref() = (*coordinates)[2];
+        }
+        _symbol_table.get_variable("t")->ref() = t;
+
+        for (unsigned i = 0; i < _vec_expression.size(); i++)
+        {
+            values[i] = _vec_expression[i].value();
+        }
+    }
+
     symbol_table_t _symbol_table;
     std::vector<expression_t> _vec_expression;
     std::vector<std::pair<std::string, CurveWrapper>> _curves;
+    /// True if none of the expressions depends on the coordinates.
+    bool _is_time_only = true;
+    /// Values of time-only expressions at the current time step.
+    TimeStepCache<std::vector<T>> _time_only_values;
 };
 
 std::unique_ptr<ParameterBase> createFunctionParameter(
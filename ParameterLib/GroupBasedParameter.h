@@ -61,15 +61,7 @@ struct GroupBasedParameter final : public Parameter<T>
     std::vector<T> operator()(double const /*t*/,
                               SpatialPosition const& pos) const override
     {
-        auto const item_id = getMeshItemID(pos, type<MeshItemType>());
-        assert(item_id);
-        int const index = _property_index[item_id.value()];
-        auto const v = _vec_values.find(index);
-        if (v == _vec_values.end())
-        {
-            OGS_FATAL("No data found for the group index {:d}", index);
-        }
-        auto const& values = v->second;
+        auto const& values = getGroupValues(pos);
 
         if (!this->_coordinate_system)
         {
@@ -79,7 +71,36 @@ struct GroupBasedParameter final : public Parameter<T>
         return this->rotateWithCoordinateSystem(values, pos);
     }
 
+    std::span<T> evaluate(double const /*t*/, SpatialPosition const& pos,
+                          std::span<T> const values) const override
+    {
+        auto const& group_values = getGroupValues(pos);
+        assert(values.size() >= group_values.size());
+        std::copy(group_values.begin(), group_values.end(), values.begin());
+
+        if (!this->_coordinate_system)
+        {
+            return values.first(group_values.size());
+        }
+
+        return this->rotateWithCoordinateSystem(values, group_values.size(),
+                                                pos);
+    }
+
 private:
+    std::vector<T> const& getGroupValues(SpatialPosition const& pos) const
+    {
+        auto const item_id = getMeshItemID(pos, type<MeshItemType>());
+        assert(item_id);
+        int const index = _property_index[item_id.value()];
+        auto const v = _vec_values.find(index);
+        if (v == _vec_values.end())
+        {
+            OGS_FATAL("No data found for the group index {:d}", index);
+        }
+        return v->second;
+    }
+
     template <MeshLib::MeshItemType ITEM_TYPE>
     struct type
     {
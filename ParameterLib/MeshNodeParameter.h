@@ -42,8 +42,18 @@ struct MeshNodeParameter final : public Parameter<T>
         return _property.getNumberOfGlobalComponents();
     }
 
-    std::vector<T> operator()(double const /*t*/,
+    std::vector<T> operator()(double const t,
                               SpatialPosition const& pos) const override
+    {
+        std::vector<T> cache(
+            std::max<std::size_t>(9, getNumberOfGlobalComponents()));
+        auto const values = evaluate(t, pos, cache);
+        cache.resize(values.size());
+        return cache;
+    }
+
+    std::span<T> evaluate(double const /*t*/, SpatialPosition const& pos,
+                          std::span<T> const values) const override
     {
         auto const n = pos.getNodeID();
         if (!n)
@@ -53,18 +63,18 @@ struct MeshNodeParameter final : public Parameter<T>
                 "specified.");
         }
         auto const num_comp = _property.getNumberOfGlobalComponents();
-        std::vector<T> cache(num_comp);
+        assert(values.size() >= static_cast<std::size_t>(num_comp));
         for (int c = 0; c < num_comp; ++c)
         {
-            cache[c] = _property.getComponent(*n, c);
+            values[c] = _property.getComponent(*n, c);
         }
 
         if (!this->_coordinate_system)
         {
-            return cache;
+            return values.first(num_comp);
         }
 
-        return this->rotateWithCoordinateSystem(cache, pos);
+        return this->rotateWithCoordinateSystem(values, num_comp, pos);
     }
 
     Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
@@ -74,12 +84,13 @@ struct MeshNodeParameter final : public Parameter<T>
         Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(
             n_nodes, getNumberOfGlobalComponents());
 
+        detail::ParameterValueBuffer<T> buffer(getNumberOfGlobalComponents());
         SpatialPosition x_position;
         auto const nodes = element.getNodes();
         for (unsigned i = 0; i < n_nodes; ++i)
         {
             x_position.setNodeID(nodes[i]->getID());
-            auto const& values = this->operator()(t, x_position);
+            auto const values = evaluate(t, x_position, buffer.span());
             result.row(i) =
                 Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
                     values.data(), values.size());
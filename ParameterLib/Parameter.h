@@ -11,14 +11,19 @@
 #pragma once
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <utility>
 #include <vector>
 
 #include "BaseLib/Error.h"
 #include "CoordinateSystem.h"
+#include "MathLib/Point3d.h"
 #include "MeshLib/Elements/Element.h"
 #include "MeshLib/Node.h"
 #include "SpatialPosition.h"
@@ -67,58 +72,91 @@ struct ParameterBase
     {
     }
 
+    /// Evaluates and stores the parts of the parameter which depend only on
+    /// time, e.g., curve values. It is called once per time step before the
+    /// assembly, while the parameter is not evaluated by other threads.
+    /// Evaluations at time \c t use the stored values, evaluations at other
+    /// times compute them again.
+    virtual void preTimestep(double const /*t*/) {}
+
     MeshLib::Mesh const* mesh() const { return _mesh; }
 
     std::string const name;
 
 protected:
     std::vector<double> rotateWithCoordinateSystem(
-        std::vector<double> const& values, SpatialPosition const& pos) const
+        std::vector<double> values, SpatialPosition const& pos) const
+    {
+        auto const n_components = values.size();
+        // Diagonal tensors are expanded to full tensors.
+        if (n_components == 2)
+        {
+            values.resize(4);
+        }
+        else if (n_components == 3)
+        {
+            values.resize(9);
+        }
+        rotateWithCoordinateSystem(values, n_components, pos);
+        return values;
+    }
+
+    /// Rotates the first \c n_components entries of \c values in place and
+    /// returns the rotated values, which are more than \c n_components for
+    /// diagonal tensors.
+    std::span<double> rotateWithCoordinateSystem(
+        std::span<double> const values, std::size_t const n_components,
+        SpatialPosition const& pos) const
     {
         assert(!!_coordinate_system);  // It is checked before calling this
                                        // function.
 
+        auto const input = values.first(n_components);
+
         // Don't rotate isotropic/scalar values.
-        if (values.size() == 1)
+        if (n_components == 1)
         {
-            return values;
+            return input;
         }
-        if (values.size() == 2)
+        if (n_components == 2)
         {
-            auto const result =
-                _coordinate_system->rotateDiagonalTensor<2>(values, pos);
-            return {result(0, 0), result(0, 1), result(1, 0), result(1, 1)};
+            return storeRowMajor<2>(
+                _coordinate_system->rotateDiagonalTensor<2>(input, pos),
+                values);
         }
-        if (values.size() == 3)
+        if (n_components == 3)
         {
-            auto const result =
-                _coordinate_system->rotateDiagonalTensor<3>(values, pos);
-            return {
-                result(0, 0), result(0, 1), result(0, 2),
-                result(1, 0), result(1, 1), result(1, 2),
-                result(2, 0), result(2, 1), result(2, 2),
-            };
+            return storeRowMajor<3>(
+                _coordinate_system->rotateDiagonalTensor<3>(input, pos),
+                values);
         }
-        if (values.size() == 4)
+        if (n_components == 4)
         {
-            auto const result =
-                _coordinate_system->rotateTensor<2>(values, pos);
-            return {result(0, 0), result(0, 1), result(1, 0), result(1, 1)};
+            return storeRowMajor<2>(
+                _coordinate_system->rotateTensor<2>(input, pos), values);
         }
-        if (values.size() == 9)
+        if (n_components == 9)
         {
-            auto const result =
-                _coordinate_system->rotateTensor<3>(values, pos);
-            return {
-                result(0, 0), result(0, 1), result(0, 2),
-                result(1, 0), result(1, 1), result(1, 2),
-                result(2, 0), result(2, 1), result(2, 2),
-            };
+            return storeRowMajor<3>(
+                _coordinate_system->rotateTensor<3>(input, pos), values);
         }
         OGS_FATAL(
             "Coordinate transformation for a {:d}-component parameter is not "
             "implemented.",
-            values.size());
+            n_components);
+    }
+
+private:
+    template <int Dimension>
+    static std::span<double> storeRowMajor(
+        Eigen::Matrix<double, Dimension, Dimension> const& tensor,
+        std::span<double> const values)
+    {
+        assert(values.size() >= Dimension * Dimension);
+        using RowMajorTensor =
+            Eigen::Matrix<double, Dimension, Dimension, Eigen::RowMajor>;
+        Eigen::Map<RowMajorTensor>(values.data()) = tensor;
+        return values.first(Dimension * Dimension);
     }
 
 protected:
@@ -129,6 +167,58 @@ protected:
     MeshLib::Mesh const* _mesh;
 };
 
+/// A value computed for a single point in time, which is valid until the time
+/// changes. See ParameterBase::preTimestep().
+template <typename Value>
+class TimeStepCache
+{
+public:
+    void set(double const t, Value value)
+    {
+        _t = t;
+        _value = std::move(value);
+    }
+
+    /// Returns the stored value if it was computed for time \c t, or nullptr
+    /// otherwise.
+    Value const* get(double const t) const
+    {
+        return (_value && _t == t) ? &*_value : nullptr;
+    }
+
+private:
+    double _t = 0;
+    std::optional<Value> _value;
+};
+
+namespace detail
+{
+/// Storage for the values of a single parameter evaluation. Up to nine values,
+/// i.e., scalars, vectors, and 3x3 tensors, are kept on the stack; only larger
+/// parameters allocate.
+template <typename T>
+class ParameterValueBuffer
+{
+public:
+    explicit ParameterValueBuffer(std::size_t const size)
+    {
+        if (size > _stack.size())
+        {
+            _heap.resize(size);
+        }
+    }
+
+    std::span<T> span()
+    {
+        return _heap.empty() ? std::span<T>{_stack} : std::span<T>{_heap};
+    }
+
+private:
+    std::array<T, 9> _stack;
+    std::vector<T> _heap;
+};
+}  // namespace detail
+
 /*! A Parameter is a function \f$ (t, x) \mapsto f(t, x) \in T^n \f$.
  *
  * Where \f$ t \f$ is the time and \f$ x \f$ is the SpatialPosition.
@@ -150,6 +240,67 @@ struct Parameter : public ParameterBase
     virtual std::vector<T> operator()(double const t,
                                       SpatialPosition const& pos) const = 0;
 
+    //! Writes the parameter value at the given time and position into
+    //! \c values and returns the written part of it.
+    //!
+    //! \c values must hold at least getNumberOfGlobalComponents() entries, or
+    //! nine entries if a diagonal tensor is rotated to a local coordinate
+    //! system. The default implementation copies the result of operator();
+    //! the derived classes write directly into \c values without allocating.
+    virtual std::span<T> evaluate(double const t, SpatialPosition const& pos,
+                                  std::span<T> const values) const
+    {
+        auto const result = this->operator()(t, pos);
+        assert(values.size() >= result.size());
+        std::copy(result.begin(), result.end(), values.begin());
+        return values.first(result.size());
+    }
+
+    //! Returns the parameter value at the given time and position as a
+    //! fixed-size vector. \c N must be the number of returned values.
+    template <int N>
+    Eigen::Matrix<T, N, 1> evaluateFixedSize(double const t,
+                                             SpatialPosition const& pos) const
+    {
+        // More storage than N in case of a wrong N; checked below.
+        std::array<T, std::max(N, 9)> buffer;
+        [[maybe_unused]] auto const values = evaluate(t, pos, buffer);
+        assert(values.size() == N);
+        return Eigen::Map<Eigen::Matrix<T, N, 1> const>(buffer.data());
+    }
+
+    //! Evaluates the parameter at all integration points of an element.
+    //!
+    //! \c values is split evenly into one part per integration point, e.g.,
+    //! for a scalar parameter it has one entry per integration point. Each part
+    //! receives the values at the corresponding entry of \c ip_coordinates
+    //! like in evaluate().
+    //!
+    //! The default implementation evaluates the parameter point by point.
+    //! Parameters which are constant in an element evaluate only once.
+    virtual void evaluateAtIntegrationPoints(
+        MeshLib::Element const& element, double const t,
+        std::span<MathLib::Point3d const> const ip_coordinates,
+        std::span<T> const values) const
+    {
+        auto const n_integration_points = ip_coordinates.size();
+        if (n_integration_points == 0)
+        {
+            return;
+        }
+        assert(values.size() % n_integration_points == 0);
+        auto const n_values = values.size() / n_integration_points;
+
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+        {
+            SpatialPosition const pos{std::nullopt, element.getID(), ip,
+                                      ip_coordinates[ip]};
+            [[maybe_unused]] auto const ip_values =
+                evaluate(t, pos, values.subspan(ip * n_values, n_values));
+            assert(ip_values.size() == n_values);
+        }
+    }
+
     //! Returns a matrix of values for all nodes of the given element.
     //
     // The matrix is of the shape NxC, where N is the number of nodes and C is
@@ -168,18 +319,17 @@ struct Parameter : public ParameterBase
         Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(n_nodes,
                                                                 n_components);
 
-        // Column vector of values, copied for each node.
+        detail::ParameterValueBuffer<T> buffer(n_components);
         SpatialPosition x_position;
         auto const nodes = element.getNodes();
         for (int i = 0; i < n_nodes; ++i)
         {
             x_position.setAll(
                 nodes[i]->getID(), element.getID(), std::nullopt, *nodes[i]);
-            auto const& values = this->operator()(t, x_position);
-            auto const row_values =
+            auto const values = evaluate(t, x_position, buffer.span());
+            result.row(i) =
                 Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
                     values.data(), values.size());
-            result.row(i) = row_values;
         }
 
         return result;
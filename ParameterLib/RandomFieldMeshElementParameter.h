@@ -38,8 +38,18 @@ struct RandomFieldMeshElementParameter final : public Parameter<T>
         return _property.getNumberOfGlobalComponents();
     }
 
-    std::vector<T> operator()(double const /*t*/,
+    std::vector<T> operator()(double const t,
                               SpatialPosition const& pos) const override
+    {
+        std::vector<T> cache(
+            std::max<std::size_t>(9, getNumberOfGlobalComponents()));
+        auto const values = evaluate(t, pos, cache);
+        cache.resize(values.size());
+        return cache;
+    }
+
+    std::span<T> evaluate(double const /*t*/, SpatialPosition const& pos,
+                          std::span<T> const values) const override
     {
         auto const e = pos.getElementID();
         if (!e)
@@ -49,18 +59,43 @@ struct RandomFieldMeshElementParameter final : public Parameter<T>
                 "the element id is not specified.");
         }
         auto const num_comp = _property.getNumberOfGlobalComponents();
-        std::vector<T> cache(num_comp);
+        assert(values.size() >= static_cast<std::size_t>(num_comp));
         for (int c = 0; c < num_comp; ++c)
         {
-            cache[c] = _property.getComponent(*e, c);
+            values[c] = _property.getComponent(*e, c);
         }
 
         if (!this->_coordinate_system)
         {
-            return cache;
+            return values.first(num_comp);
+        }
+
+        return this->rotateWithCoordinateSystem(values, num_comp, pos);
+    }
+
+    void evaluateAtIntegrationPoints(
+        MeshLib::Element const& element, double const t,
+        std::span<MathLib::Point3d const> const ip_coordinates,
+        std::span<T> const values) const override
+    {
+        // The rotation might depend on the position.
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::evaluateAtIntegrationPoints(element, t,
+                                                      ip_coordinates, values);
+            return;
         }
 
-        return this->rotateWithCoordinateSystem(cache, pos);
+        auto const num_comp = _property.getNumberOfGlobalComponents();
+        assert(values.size() == ip_coordinates.size() * num_comp);
+        auto const e = element.getID();
+        for (auto it = values.begin(); it != values.end(); it += num_comp)
+        {
+            for (int c = 0; c < num_comp; ++c)
+            {
+                it[c] = _property.getComponent(e, c);
+            }
+        }
     }
 
     Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
@@ -71,9 +106,10 @@ struct RandomFieldMeshElementParameter final : public Parameter<T>
             n_nodes, getNumberOfGlobalComponents());
 
         // Column vector of values, copied for each node.
+        detail::ParameterValueBuffer<T> buffer(getNumberOfGlobalComponents());
         SpatialPosition x_position;
         x_position.setElementID(element.getID());
-        auto const& values = this->operator()(t, x_position);
+        auto const values = evaluate(t, x_position, buffer.span());
         auto const row_values =
             Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
                 values.data(), values.size());
@@ -10,6 +10,8 @@
 
 #include "TimeDependentHeterogeneousParameter.h"
 
+#include <algorithm>
+
 #include "BaseLib/ConfigTree.h"
 #include "BaseLib/Error.h"
 #include "Utils.h"
@@ -37,19 +39,64 @@ bool TimeDependentHeterogeneousParameter::isTimeDependent() const
 
 std::vector<double> TimeDependentHeterogeneousParameter::operator()(
     double const t, SpatialPosition const& pos) const
+{
+    // Room for diagonal tensors rotated by the referenced parameters.
+    std::vector<double> cache(std::max(getNumberOfGlobalComponents(), 9));
+    auto const values = evaluate(t, pos, cache);
+    cache.resize(values.size());
+    return cache;
+}
+
+std::span<double> TimeDependentHeterogeneousParameter::evaluate(
+    double const t, SpatialPosition const& pos,
+    std::span<double> const values) const
 {
     // No local coordinate transformation here, which might happen twice
     // otherwise.
     assert(!this->_coordinate_system ||
            "Coordinate system not expected to be set for curve scaled "
            "parameters.");
+    auto const [p0, p1, alpha] = getInterpolation(t);
+
+    auto const r0 = p0->evaluate(t, pos, values);
+    if (p1 == nullptr)
+    {
+        return r0;
+    }
+    detail::ParameterValueBuffer<double> buffer(values.size());
+    auto const r1 = p1->evaluate(t, pos, buffer.span());
+    assert(r0.size() == r1.size());
+    std::transform(r0.begin(), r0.end(), r1.begin(), r0.begin(),
+                   [alpha = alpha](auto const& v0, auto const& v1)
+                   { return (1 - alpha) * v0 + alpha * v1; });
+    return r0;
+}
+
+void TimeDependentHeterogeneousParameter::preTimestep(double const t)
+{
+    _interpolation.set(t, computeInterpolation(t));
+}
+
+TimeDependentHeterogeneousParameter::Interpolation
+TimeDependentHeterogeneousParameter::getInterpolation(double const t) const
+{
+    if (auto const* const interpolation = _interpolation.get(t))
+    {
+        return *interpolation;
+    }
+    return computeInterpolation(t);
+}
+
+TimeDependentHeterogeneousParameter::Interpolation
+TimeDependentHeterogeneousParameter::computeInterpolation(double const t) const
+{
     if (t < _time_parameter_mapping[0].first)
     {
-        return _time_parameter_mapping[0].second->operator()(t, pos);
+        return {_time_parameter_mapping[0].second, nullptr, 0};
     }
     if (_time_parameter_mapping.back().first <= t)
     {
-        return _time_parameter_mapping.back().second->operator()(t, pos);
+        return {_time_parameter_mapping.back().second, nullptr, 0};
     }
     std::size_t k(1);
     for (; k < _time_parameter_mapping.size(); ++k)
@@ -62,17 +109,8 @@ std::vector<double> TimeDependentHeterogeneousParameter::operator()(
     }
     auto const t0 = _time_parameter_mapping[k - 1].first;
     auto const t1 = _time_parameter_mapping[k].first;
-    auto const alpha = (t - t0) / (t1 - t0);
-
-    auto r0 = _time_parameter_mapping[k - 1].second->operator()(t, pos);
-    std::transform(r0.begin(), r0.end(), r0.begin(),
-                   [alpha](auto const& v) { return (1 - alpha) * v; });
-    auto r1 = _time_parameter_mapping[k].second->operator()(t, pos);
-    std::transform(r1.begin(), r1.end(), r1.begin(),
-                   [alpha](auto const& v) { return alpha * v; });
-    std::transform(r0.begin(), r0.end(), r1.begin(), r0.begin(),
-                   [](auto const& v0, auto const& v1) { return v0 + v1; });
-    return r0;
+    return {_time_parameter_mapping[k - 1].second,
+            _time_parameter_mapping[k].second, (t - t0) / (t1 - t0)};
 }
 
 void TimeDependentHeterogeneousParameter::initialize(
@@ -38,6 +38,10 @@ public:
     std::vector<double> operator()(double const t,
                                    SpatialPosition const& pos) const override;
 
+    /// @copydoc Parameter::evaluate()
+    std::span<double> evaluate(double const t, SpatialPosition const& pos,
+                               std::span<double> const values) const override;
+
     /// The TimeDependentHeterogeneousParameter depends in each time step on a
     /// parameter. Since, at construction time of the
     /// TimeDependentHeterogeneousParameter other parameter needs not to be
@@ -46,9 +50,25 @@ public:
     void initialize(
         std::vector<std::unique_ptr<ParameterBase>> const& parameters) override;
 
+    void preTimestep(double const t) override;
+
 private:
+    /// The parameters to be interpolated at a time and the interpolation
+    /// weight of the second one. The second parameter is nullptr if the time
+    /// is outside of the given time points.
+    struct Interpolation
+    {
+        Parameter<double> const* p0;
+        Parameter<double> const* p1;
+        double alpha;
+    };
+
+    Interpolation getInterpolation(double const t) const;
+    Interpolation computeInterpolation(double const t) const;
+
     std::vector<PairTimeParameterName> _time_parameter_name_mapping;
     std::vector<PairTimeParameter> _time_parameter_mapping;
+    TimeStepCache<Interpolation> _interpolation;
 };
 
 std::unique_ptr<ParameterBase> createTimeDependentHeterogeneousParameter(
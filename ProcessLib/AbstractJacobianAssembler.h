@@ -11,6 +11,7 @@
 #pragma once
 
 #include <Eigen/Dense>
+#include <memory>
 #include <vector>
 
 #include "BaseLib/Error.h"
@@ -50,6 +51,11 @@ public:
         OGS_FATAL("not implemented.");
     }
 
+    //! Creates an independent instance of this Jacobian assembler with the
+    //! same settings but its own scratch data. Used to equip each thread of
+    //! a parallel global assembly with its own Jacobian assembler.
+    virtual std::unique_ptr<AbstractJacobianAssembler> copy() const = 0;
+
     virtual ~AbstractJacobianAssembler() = default;
 };
 
@@ -17,6 +17,7 @@
 #include "BaseLib/ConfigTree.h"
 #include "FlushStdoutGuard.h"
 #include "MeshLib/MeshSearch/NodeSearch.h"
+#include "ProcessLib/BoundaryConditionAndSourceTerm/Python/Utils/AssembleBatched.h"
 #include "ProcessLib/BoundaryConditionAndSourceTerm/Python/Utils/CreateLocalAssemblers.h"
 #include "ProcessLib/ProcessVariable.h"
 #include "PythonBoundaryConditionLocalAssembler.h"
@@ -104,6 +105,12 @@ void PythonBoundaryCondition::getEssentialBCValues(
 
     initBCValues(bc_values, boundary_nodes.size());
 
+    if (bc_object->isOverriddenEssentialBatched() &&
+        getEssentialBCValuesBatched(t, x, bc_values))
+    {
+        return;
+    }
+
     std::vector<double> primary_variables;
 
     for (auto const* boundary_node : boundary_nodes)
@@ -151,6 +158,87 @@ void PythonBoundaryCondition::getEssentialBCValues(
     }
 }
 
+bool PythonBoundaryCondition::getEssentialBCValuesBatched(
+    const double t, GlobalVector const& x,
+    NumLib::IndexValueVector<GlobalIndexType>& bc_values) const
+{
+    namespace BcAndStPython = BoundaryConditionAndSourceTerm::Python;
+
+    auto const& boundary_nodes = _bc_data.bc_or_st_mesh.getNodes();
+    auto const* bc_object = _bc_data.bc_or_st_object;
+
+    // Only nodes having a d.o.f. of this BC's variable and component are
+    // passed to Python, cf. the per-node loop in getEssentialBCValues().
+    std::vector<MeshLib::Node const*> nodes;
+    std::vector<GlobalIndexType> dof_indices;
+    nodes.reserve(boundary_nodes.size());
+    dof_indices.reserve(boundary_nodes.size());
+
+    for (auto const* boundary_node : boundary_nodes)
+    {
+        auto const dof_idx = getDofIdx(boundary_node->getID());
+        if (dof_idx == NumLib::MeshComponentMap::nop || dof_idx < 0)
+        {
+            continue;
+        }
+        nodes.push_back(boundary_node);
+        dof_indices.push_back(dof_idx);
+    }
+
+    auto const num_nodes = static_cast<Eigen::Index>(nodes.size());
+    auto const num_comp_total =
+        _dof_table_boundary->getNumberOfGlobalComponents();
+
+    BcAndStPython::RowMajorMatrix coords(num_nodes, 3);
+    BcAndStPython::NodeIdVector node_ids(num_nodes);
+    BcAndStPython::RowMajorMatrix primary_variables_all(num_nodes,
+                                                        num_comp_total);
+    std::vector<double> primary_variables;
+
+    for (Eigen::Index i = 0; i < num_nodes; ++i)
+    {
+        auto const& node = *nodes[i];
+        coords.row(i) << node[0], node[1], node[2];
+        node_ids[i] = node.getID();
+
+        collectPrimaryVariables(primary_variables, node, x);
+        primary_variables_all.row(i) =
+            MathLib::toVector(primary_variables).transpose();
+    }
+
+    auto const [apply_bc, bc_value] = bc_object->getDirichletBCValues(
+        t, coords, node_ids, primary_variables_all);
+
+    if (!bc_object->isOverriddenEssentialBatched())
+    {
+        DBUG(
+            "Method `getDirichletBCValues' not overridden in Python script.");
+        return false;
+    }
+
+    if (apply_bc.size() != num_nodes || bc_value.size() != num_nodes)
+    {
+        OGS_FATAL(
+            "Method `getDirichletBCValues' must return values for each of the "
+            "{:d} boundary nodes. {:d} flags and {:d} values have been "
+            "returned from Python.",
+            num_nodes, apply_bc.size(), bc_value.size());
+    }
+
+    for (Eigen::Index i = 0; i < num_nodes; ++i)
+    {
+        if (!apply_bc[i])
+        {
+            continue;
+        }
+
+        bc_values.ids.emplace_back(dof_indices[i]);
+        bc_values.values.emplace_back(bc_value[i]);
+    }
+
+    return true;
+}
+
 GlobalIndexType PythonBoundaryCondition::getDofIdx(
     std::size_t const boundary_node_id) const
 {
@@ -240,6 +328,14 @@ void PythonBoundaryCondition::applyNaturalBC(
 {
     FlushStdoutGuard guard(_flush_stdout);
 
+    if (_bc_data.bc_or_st_object->isOverriddenNaturalBatched() &&
+        BoundaryConditionAndSourceTerm::Python::assembleBatched(
+            _local_assemblers, _bc_data, *_dof_table_boundary, t,
+            *x[process_id], b, Jac))
+    {
+        return;
+    }
+
     try
     {
         GlobalExecutor::executeMemberOnDereferenced(
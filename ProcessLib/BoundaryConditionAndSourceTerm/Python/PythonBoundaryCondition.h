@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "NumLib/IndexValueVector.h"
 #include "ProcessLib/BoundaryConditionAndSourceTerm/BoundaryCondition.h"
@@ -51,6 +53,30 @@ struct PythonBcData final
 
         return {flag, flux, std::move(dFlux)};
     }
+
+    //! Batched counterpart of getFlagAndFluxAndDFlux().
+    //!
+    //! Returns nothing if the batched interface is not overridden in Python.
+    std::optional<ProcessLib::BoundaryConditionAndSourceTerm::Python::
+                      FlagsAndFluxesAndDFluxes>
+    getFlagsAndFluxesAndDFluxes(
+        double const t,
+        BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const& coords,
+        BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const& prim_vars)
+        const
+    {
+        auto [flags, fluxes, dFluxes] =
+            bc_or_st_object->getFluxes(t, coords, prim_vars);
+
+        if (!bc_or_st_object->isOverriddenNaturalBatched())
+        {
+            return std::nullopt;
+        }
+
+        return ProcessLib::BoundaryConditionAndSourceTerm::Python::
+            FlagsAndFluxesAndDFluxes{std::move(flags), std::move(fluxes),
+                                     std::move(dFluxes)};
+    }
 };
 
 //! A boundary condition whose values are computed by a Python script.
@@ -73,6 +99,14 @@ public:
                         GlobalMatrix* Jac) override;
 
 private:
+    //! Computes the Dirichlet BC values with a single call of
+    //! getDirichletBCValues() in Python.
+    //!
+    //! \return false if getDirichletBCValues() is not overridden in Python.
+    bool getEssentialBCValuesBatched(
+        const double t, GlobalVector const& x,
+        NumLib::IndexValueVector<GlobalIndexType>& bc_values) const;
+
     //! Collects primary variables at the passed node from the passed
     //! GlobalVector to \c primary_variables.
     //!
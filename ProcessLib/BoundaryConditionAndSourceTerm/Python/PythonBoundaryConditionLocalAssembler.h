@@ -48,6 +48,32 @@ public:
                        *xs[process_id], b, Jac);
     }
 
+    unsigned getNumberOfIntegrationPoints() const override
+    {
+        return impl_.getNumberOfIntegrationPoints();
+    }
+
+    void collectIntegrationPointData(
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        GlobalVector const& x, Eigen::Ref<RowMajorMatrix> coords,
+        Eigen::Ref<RowMajorMatrix> prim_vars) const override
+    {
+        impl_.collectIntegrationPointData(dof_table_boundary, x, coords,
+                                          prim_vars);
+    }
+
+    void assembleFromFluxes(
+        std::size_t const boundary_element_id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        Eigen::Ref<BoolVector const> const& flags,
+        Eigen::Ref<Eigen::VectorXd const> const& fluxes,
+        Eigen::Ref<RowMajorMatrix const> const& dFluxes, GlobalVector& b,
+        GlobalMatrix* const Jac) const override
+    {
+        impl_.assembleFromFluxes(boundary_element_id, dof_table_boundary, flags,
+                                 fluxes, dFluxes, b, Jac);
+    }
+
     double interpolate(unsigned const local_node_id,
                        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
                        GlobalVector const& x, int const var,
@@ -12,6 +12,7 @@
 
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "ProcessLib/BoundaryConditionAndSourceTerm/GenericNaturalBoundaryCondition.h"
+#include "Utils/BatchedTypes.h"
 
 namespace ProcessLib
 {
@@ -20,6 +21,10 @@ class PythonBoundaryConditionLocalAssemblerInterface
     : public GenericNaturalBoundaryConditionLocalAssemblerInterface
 {
 public:
+    using RowMajorMatrix =
+        BoundaryConditionAndSourceTerm::Python::RowMajorMatrix;
+    using BoolVector = BoundaryConditionAndSourceTerm::Python::BoolVector;
+
     //! Interpolates the given component of the given variable to the given \c
     //! local_node_id.
     //!
@@ -29,6 +34,29 @@ public:
         unsigned const local_node_id,
         NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
         GlobalVector const& x, int const var, int const comp) const = 0;
+
+    //! Number of integration points of this element.
+    virtual unsigned getNumberOfIntegrationPoints() const = 0;
+
+    //! Writes the coordinates of and the primary variables at all integration
+    //! points of this element to the passed matrices, one row per integration
+    //! point.
+    virtual void collectIntegrationPointData(
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        GlobalVector const& x,
+        Eigen::Ref<RowMajorMatrix> coords,
+        Eigen::Ref<RowMajorMatrix> prim_vars) const = 0;
+
+    //! Assembles this element's contribution from fluxes that have been
+    //! computed in a single batched call for all integration points, which
+    //! have been collected by collectIntegrationPointData().
+    virtual void assembleFromFluxes(
+        std::size_t const boundary_element_id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        Eigen::Ref<BoolVector const> const& flags,
+        Eigen::Ref<Eigen::VectorXd const> const& fluxes,
+        Eigen::Ref<RowMajorMatrix const> const& dFluxes,
+        GlobalVector& b, GlobalMatrix* Jac) const = 0;
 };
 
 }  // namespace ProcessLib
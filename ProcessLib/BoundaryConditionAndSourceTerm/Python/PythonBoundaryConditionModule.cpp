@@ -10,6 +10,7 @@
 
 #include "PythonBoundaryConditionModule.h"
 
+#include <pybind11/eigen.h>
 #include <pybind11/stl.h>
 
 #include "PythonBoundaryConditionPythonSideInterface.h"
@@ -44,6 +45,40 @@ public:
         PYBIND11_OVERLOAD(Ret, PythonBoundaryConditionPythonSideInterface,
                           getFlux, t, x, primary_variables);
     }
+
+    std::pair<BoundaryConditionAndSourceTerm::Python::BoolVector,
+              Eigen::VectorXd>
+    getDirichletBCValues(
+        double t,
+        BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const& coords,
+        BoundaryConditionAndSourceTerm::Python::NodeIdVector const& node_ids,
+        BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const&
+            primary_variables) const override
+    {
+        using Ret =
+            std::pair<BoundaryConditionAndSourceTerm::Python::BoolVector,
+                      Eigen::VectorXd>;
+        PYBIND11_OVERLOAD(Ret, PythonBoundaryConditionPythonSideInterface,
+                          getDirichletBCValues, t, coords, node_ids,
+                          primary_variables);
+    }
+
+    std::tuple<BoundaryConditionAndSourceTerm::Python::BoolVector,
+               Eigen::VectorXd,
+               BoundaryConditionAndSourceTerm::Python::RowMajorMatrix>
+    getFluxes(double t,
+              BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const&
+                  coords,
+              BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const&
+                  primary_variables) const override
+    {
+        using Ret =
+            std::tuple<BoundaryConditionAndSourceTerm::Python::BoolVector,
+                       Eigen::VectorXd,
+                       BoundaryConditionAndSourceTerm::Python::RowMajorMatrix>;
+        PYBIND11_OVERLOAD(Ret, PythonBoundaryConditionPythonSideInterface,
+                          getFluxes, t, coords, primary_variables);
+    }
 };
 
 void pythonBindBoundaryCondition(pybind11::module& m)
@@ -59,6 +94,10 @@ void pythonBindBoundaryCondition(pybind11::module& m)
     pybc.def("getDirichletBCValue",
              &PythonBoundaryConditionPythonSideInterface::getDirichletBCValue);
     pybc.def("getFlux", &PythonBoundaryConditionPythonSideInterface::getFlux);
+    pybc.def("getDirichletBCValues",
+             &PythonBoundaryConditionPythonSideInterface::getDirichletBCValues);
+    pybc.def("getFluxes",
+             &PythonBoundaryConditionPythonSideInterface::getFluxes);
 }
 
 }  // namespace ProcessLib
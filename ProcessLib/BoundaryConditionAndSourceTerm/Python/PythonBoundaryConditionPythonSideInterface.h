@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "Utils/BatchedTypes.h"
+
 namespace ProcessLib
 {
 //! Base class for boundary conditions.
@@ -52,6 +54,64 @@ public:
             false, std::numeric_limits<double>::quiet_NaN(), {}};
     }
 
+    /*!
+     * Batched version of getDirichletBCValue() computing the Dirichlet
+     * boundary condition values at all boundary nodes in a single call.
+     *
+     * The arguments are the time, the positions of the nodes (\#nodes x 3),
+     * the node ids and the primary variables at the nodes (\#nodes x
+     * \#components). On the Python side they are NumPy arrays.
+     *
+     * \return a pair (is_dirichlet, values) of arrays of length \#nodes with
+     * the same meaning as the return value of getDirichletBCValue().
+     *
+     * If this method is overridden in Python, getDirichletBCValue() is not
+     * called.
+     */
+    virtual std::pair<
+        BoundaryConditionAndSourceTerm::Python::BoolVector,
+        Eigen::VectorXd>
+    getDirichletBCValues(
+        double /*t*/,
+        BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const&
+        /*coords*/,
+        BoundaryConditionAndSourceTerm::Python::NodeIdVector const&
+        /*node_ids*/,
+        BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const&
+        /*primary_variables*/) const
+    {
+        _overridden_essential_batched = false;
+        return {};
+    }
+
+    /*!
+     * Batched version of getFlux() computing the fluxes at all integration
+     * points of all boundary elements in a single call.
+     *
+     * The arguments are the time, the positions of the integration points
+     * (\#points x 3) and the primary variables at the integration points
+     * (\#points x \#components). On the Python side they are NumPy arrays.
+     *
+     * \return a tuple (is_natural, fluxes, flux_jacobians) of arrays with
+     * \#points rows each; flux_jacobians has \#components columns. If
+     * is_natural is false at any integration point of an element, no flux is
+     * applied on that element.
+     *
+     * If this method is overridden in Python, getFlux() is not called.
+     */
+    virtual std::tuple<BoundaryConditionAndSourceTerm::Python::BoolVector,
+                       Eigen::VectorXd,
+                       BoundaryConditionAndSourceTerm::Python::RowMajorMatrix>
+    getFluxes(double /*t*/,
+              BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const&
+              /*coords*/,
+              BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const&
+              /*primary_variables*/) const
+    {
+        _overridden_natural_batched = false;
+        return {};
+    }
+
     //! Tells if getDirichletBCValue() has been overridden in the derived class
     //! in Python.
     //!
@@ -64,6 +124,21 @@ public:
     //! \pre getFlux() must already have been called once.
     bool isOverriddenNatural() const { return _overridden_natural; }
 
+    //! Tells if getDirichletBCValues() has been overridden in the derived
+    //! class in Python. Returns true as long as getDirichletBCValues() has not
+    //! been called.
+    bool isOverriddenEssentialBatched() const
+    {
+        return _overridden_essential_batched;
+    }
+
+    //! Tells if getFluxes() has been overridden in the derived class in
+    //! Python. Returns true as long as getFluxes() has not been called.
+    bool isOverriddenNaturalBatched() const
+    {
+        return _overridden_natural_batched;
+    }
+
     virtual ~PythonBoundaryConditionPythonSideInterface() = default;
 
 private:
@@ -72,5 +147,11 @@ private:
     mutable bool _overridden_essential = true;
     //! Tells if getFlux() has been overridden in the derived class in Python.
     mutable bool _overridden_natural = true;
+    //! Tells if getDirichletBCValues() has been overridden in the derived
+    //! class in Python.
+    mutable bool _overridden_essential_batched = true;
+    //! Tells if getFluxes() has been overridden in the derived class in
+    //! Python.
+    mutable bool _overridden_natural_batched = true;
 };
 }  // namespace ProcessLib
@@ -17,6 +17,7 @@
 #include "FlushStdoutGuard.h"
 #include "MeshLib/MeshSearch/NodeSearch.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "ProcessLib/BoundaryConditionAndSourceTerm/Python/Utils/AssembleBatched.h"
 #include "ProcessLib/BoundaryConditionAndSourceTerm/Python/Utils/CreateLocalAssemblers.h"
 #include "PythonSourceTermLocalAssembler.h"
 
@@ -47,6 +48,14 @@ void PythonSourceTerm::integrate(const double t, const GlobalVector& x,
 {
     FlushStdoutGuard guard(_flush_stdout);
 
+    if (_source_term_data.bc_or_st_object->isOverriddenBatched() &&
+        BoundaryConditionAndSourceTerm::Python::assembleBatched(
+            _local_assemblers, _source_term_data, *_source_term_dof_table, t,
+            x, b, Jac))
+    {
+        return;
+    }
+
     GlobalExecutor::executeMemberOnDereferenced(
         &PythonSourceTermLocalAssemblerInterface::assemble, _local_assemblers,
         *_source_term_dof_table, t, x, b, Jac);
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include "ProcessLib/BoundaryConditionAndSourceTerm/SourceTerm.h"
 #include "PythonSourceTermLocalAssemblerInterface.h"
 #include "PythonSourceTermPythonSideInterface.h"
@@ -38,6 +40,33 @@ struct PythonStData final
 
         return {true, flux, std::move(dFlux)};
     }
+
+    //! Batched counterpart of getFlagAndFluxAndDFlux().
+    //!
+    //! Returns nothing if the batched interface is not overridden in Python.
+    std::optional<ProcessLib::BoundaryConditionAndSourceTerm::Python::
+                      FlagsAndFluxesAndDFluxes>
+    getFlagsAndFluxesAndDFluxes(
+        double const t,
+        BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const& coords,
+        BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const& prim_vars)
+        const
+    {
+        auto [fluxes, dFluxes] =
+            bc_or_st_object->getFluxes(t, coords, prim_vars);
+
+        if (!bc_or_st_object->isOverriddenBatched())
+        {
+            return std::nullopt;
+        }
+
+        auto const num_points = fluxes.size();
+        return ProcessLib::BoundaryConditionAndSourceTerm::Python::
+            FlagsAndFluxesAndDFluxes{
+                ProcessLib::BoundaryConditionAndSourceTerm::Python::
+                    BoolVector::Constant(num_points, true),
+                std::move(fluxes), std::move(dFluxes)};
+    }
 };
 
 //! A source term whose values are computed by a Python script.
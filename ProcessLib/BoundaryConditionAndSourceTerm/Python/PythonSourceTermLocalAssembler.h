@@ -49,6 +49,33 @@ public:
                        Jac);
     }
 
+    unsigned getNumberOfIntegrationPoints() const override
+    {
+        return impl_.getNumberOfIntegrationPoints();
+    }
+
+    void collectIntegrationPointData(
+        NumLib::LocalToGlobalIndexMap const& dof_table_source_term,
+        GlobalVector const& x, Eigen::Ref<RowMajorMatrix> coords,
+        Eigen::Ref<RowMajorMatrix> prim_vars) const override
+    {
+        impl_.collectIntegrationPointData(dof_table_source_term, x, coords,
+                                          prim_vars);
+    }
+
+    void assembleFromFluxes(
+        std::size_t const source_term_element_id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_source_term,
+        Eigen::Ref<BoolVector const> const& flags,
+        Eigen::Ref<Eigen::VectorXd const> const& fluxes,
+        Eigen::Ref<RowMajorMatrix const> const& dFluxes, GlobalVector& b,
+        GlobalMatrix* const Jac) const override
+    {
+        impl_.assembleFromFluxes(source_term_element_id,
+                                 dof_table_source_term, flags, fluxes, dFluxes,
+                                 b, Jac);
+    }
+
 private:
     LocAsmImpl const impl_;
 };
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "Utils/BatchedTypes.h"
+
 namespace ProcessLib
 {
 namespace SourceTerms
@@ -19,12 +21,39 @@ namespace Python
 class PythonSourceTermLocalAssemblerInterface
 {
 public:
+    using RowMajorMatrix =
+        BoundaryConditionAndSourceTerm::Python::RowMajorMatrix;
+    using BoolVector = BoundaryConditionAndSourceTerm::Python::BoolVector;
+
     virtual void assemble(
         std::size_t const source_term_element_id,
         NumLib::LocalToGlobalIndexMap const& source_term_dof_table,
         double const t, const GlobalVector& x, GlobalVector& b,
         GlobalMatrix* Jac) = 0;
 
+    //! Number of integration points of this element.
+    virtual unsigned getNumberOfIntegrationPoints() const = 0;
+
+    //! Writes the coordinates of and the primary variables at all integration
+    //! points of this element to the passed matrices, one row per integration
+    //! point.
+    virtual void collectIntegrationPointData(
+        NumLib::LocalToGlobalIndexMap const& source_term_dof_table,
+        GlobalVector const& x,
+        Eigen::Ref<RowMajorMatrix> coords,
+        Eigen::Ref<RowMajorMatrix> prim_vars) const = 0;
+
+    //! Assembles this element's contribution from fluxes that have been
+    //! computed in a single batched call for all integration points, which
+    //! have been collected by collectIntegrationPointData().
+    virtual void assembleFromFluxes(
+        std::size_t const source_term_element_id,
+        NumLib::LocalToGlobalIndexMap const& source_term_dof_table,
+        Eigen::Ref<BoolVector const> const& flags,
+        Eigen::Ref<Eigen::VectorXd const> const& fluxes,
+        Eigen::Ref<RowMajorMatrix const> const& dFluxes,
+        GlobalVector& b, GlobalMatrix* Jac) const = 0;
+
     virtual ~PythonSourceTermLocalAssemblerInterface() = default;
 };
 
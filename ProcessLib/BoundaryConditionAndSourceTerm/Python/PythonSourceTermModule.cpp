@@ -10,6 +10,7 @@
 
 #include "PythonSourceTermModule.h"
 
+#include <pybind11/eigen.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -39,6 +40,21 @@ public:
         PYBIND11_OVERLOAD_PURE(Ret, PythonSourceTermPythonSideInterface,
                                getFlux, t, x, primary_variables);
     }
+
+    std::pair<Eigen::VectorXd,
+              BoundaryConditionAndSourceTerm::Python::RowMajorMatrix>
+    getFluxes(double t,
+              BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const&
+                  coords,
+              BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const&
+                  primary_variables) const override
+    {
+        using Ret =
+            std::pair<Eigen::VectorXd,
+                      BoundaryConditionAndSourceTerm::Python::RowMajorMatrix>;
+        PYBIND11_OVERLOAD(Ret, PythonSourceTermPythonSideInterface, getFluxes,
+                          t, coords, primary_variables);
+    }
 };
 
 void pythonBindSourceTerm(pybind11::module& m)
@@ -52,6 +68,7 @@ void pythonBindSourceTerm(pybind11::module& m)
     pybc.def(py::init());
 
     pybc.def("getFlux", &PythonSourceTermPythonSideInterface::getFlux);
+    pybc.def("getFluxes", &PythonSourceTermPythonSideInterface::getFluxes);
 }
 
 }  // namespace Python
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "Utils/BatchedTypes.h"
+
 namespace ProcessLib
 {
 namespace SourceTerms
@@ -33,7 +35,41 @@ public:
         double /*t*/, std::array<double, 3> const& /*x*/,
         std::vector<double> const& /*primary_variables*/) const = 0;
 
+    /*!
+     * Batched version of getFlux() computing the fluxes at all integration
+     * points of all source term elements in a single call.
+     *
+     * The arguments are the time, the positions of the integration points
+     * (\#points x 3) and the primary variables at the integration points
+     * (\#points x \#components). On the Python side they are NumPy arrays.
+     *
+     * \return a pair (fluxes, flux_jacobians) of arrays with \#points rows
+     * each; flux_jacobians has \#components columns.
+     *
+     * If this method is overridden in Python, getFlux() is not called.
+     */
+    virtual std::pair<Eigen::VectorXd,
+                      BoundaryConditionAndSourceTerm::Python::RowMajorMatrix>
+    getFluxes(double /*t*/,
+              BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const&
+              /*coords*/,
+              BoundaryConditionAndSourceTerm::Python::RowMajorMatrix const&
+              /*primary_variables*/) const
+    {
+        _overridden_batched = false;
+        return {};
+    }
+
+    //! Tells if getFluxes() has been overridden in the derived class in
+    //! Python. Returns true as long as getFluxes() has not been called.
+    bool isOverriddenBatched() const { return _overridden_batched; }
+
     virtual ~PythonSourceTermPythonSideInterface() = default;
+
+private:
+    //! Tells if getFluxes() has been overridden in the derived class in
+    //! Python.
+    mutable bool _overridden_batched = true;
 };
 }  // namespace Python
 }  // namespace SourceTerms
@@ -0,0 +1,105 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "BaseLib/Error.h"
+#include "BatchedTypes.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+
+namespace ProcessLib::BoundaryConditionAndSourceTerm::Python
+{
+/// Assembles a Python BC or ST with a single call to Python for all
+/// integration points of all elements.
+///
+/// First the coordinates of and the primary variables at all integration
+/// points are collected, then the fluxes are computed by \c bc_or_st_data in
+/// one batch, and finally every local assembler assembles its part.
+///
+/// \return false if the batched interface is not overridden in Python. Then
+/// nothing has been assembled.
+template <typename LocalAssemblerInterface, typename BcOrStData>
+bool assembleBatched(
+    std::vector<std::unique_ptr<LocalAssemblerInterface>> const&
+        local_assemblers,
+    BcOrStData const& bc_or_st_data,
+    NumLib::LocalToGlobalIndexMap const& dof_table, double const t,
+    GlobalVector const& x, GlobalVector& b, GlobalMatrix* const Jac)
+{
+    auto const num_elements = local_assemblers.size();
+
+    // Rows of the first integration point of each element.
+    std::vector<Eigen::Index> offsets;
+    offsets.reserve(num_elements + 1);
+    offsets.push_back(0);
+    for (auto const& local_assembler : local_assemblers)
+    {
+        offsets.push_back(offsets.back() +
+                          local_assembler->getNumberOfIntegrationPoints());
+    }
+
+    auto const num_points = offsets.back();
+    auto const num_comp_total = dof_table.getNumberOfGlobalComponents();
+
+    RowMajorMatrix coords(num_points, 3);
+    RowMajorMatrix prim_vars(num_points, num_comp_total);
+
+    for (std::size_t e = 0; e < num_elements; ++e)
+    {
+        auto const n = offsets[e + 1] - offsets[e];
+        local_assemblers[e]->collectIntegrationPointData(
+            dof_table, x, coords.middleRows(offsets[e], n),
+            prim_vars.middleRows(offsets[e], n));
+    }
+
+    auto const result =
+        bc_or_st_data.getFlagsAndFluxesAndDFluxes(t, coords, prim_vars);
+
+    if (!result)
+    {
+        return false;
+    }
+
+    auto const& [flags, fluxes, dFluxes] = *result;
+
+    if (flags.size() != num_points || fluxes.size() != num_points ||
+        dFluxes.rows() != num_points)
+    {
+        OGS_FATAL(
+            "The batched Python BC or ST must return values for each of the "
+            "{:d} integration points. {:d} flags, {:d} fluxes, and {:d} rows "
+            "of flux derivatives have been returned from Python.",
+            num_points, flags.size(), fluxes.size(), dFluxes.rows());
+    }
+
+    if (dFluxes.cols() != num_comp_total)
+    {
+        OGS_FATAL(
+            "The batched Python BC or ST must return the derivative of the "
+            "flux w.r.t. each component of each primary variable. {:d} "
+            "columns expected. {:d} columns returned from Python.",
+            num_comp_total, dFluxes.cols());
+    }
+
+    for (std::size_t e = 0; e < num_elements; ++e)
+    {
+        auto const n = offsets[e + 1] - offsets[e];
+        local_assemblers[e]->assembleFromFluxes(
+            e, dof_table, flags.segment(offsets[e], n),
+            fluxes.segment(offsets[e], n), dFluxes.middleRows(offsets[e], n),
+            b, Jac);
+    }
+
+    return true;
+}
+}  // namespace ProcessLib::BoundaryConditionAndSourceTerm::Python
@@ -0,0 +1,26 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+
+namespace ProcessLib::BoundaryConditionAndSourceTerm::Python
+{
+//! Types exchanged with the batched Python BC and ST interfaces.
+//!
+//! The matrices are stored row-major, such that their memory layout matches
+//! that of C-ordered NumPy arrays: one row per node or integration point.
+using RowMajorMatrix =
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+using BoolVector = Eigen::Matrix<bool, Eigen::Dynamic, 1>;
+using NodeIdVector = Eigen::Matrix<std::size_t, Eigen::Dynamic, 1>;
+}  // namespace ProcessLib::BoundaryConditionAndSourceTerm::Python
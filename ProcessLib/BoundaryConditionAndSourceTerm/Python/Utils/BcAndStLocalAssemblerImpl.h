@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "BatchedTypes.h"
 #include "CollectAndInterpolateNodalDof.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "NsAndWeight.h"
@@ -162,6 +163,110 @@ public:
         }
     }
 
+    unsigned getNumberOfIntegrationPoints() const
+    {
+        return integration_method.getNumberOfPoints();
+    }
+
+    //! Writes the coordinates of and the primary variables at all integration
+    //! points of this element to the passed matrices, one row per integration
+    //! point. Used for the batched evaluation of the flux in Python.
+    void collectIntegrationPointData(
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        GlobalVector const& x, Eigen::Ref<RowMajorMatrix> coords,
+        Eigen::Ref<RowMajorMatrix> prim_vars_ips) const
+    {
+        Eigen::MatrixXd const primary_variables_mat = ProcessLib::
+            BoundaryConditionAndSourceTerm::Python::collectDofsToMatrix(
+                element, bc_or_st_data.bc_or_st_mesh.getID(),
+                dof_table_boundary, x);
+
+        Eigen::VectorXd prim_vars(prim_vars_ips.cols());
+
+        unsigned const num_integration_points =
+            integration_method.getNumberOfPoints();
+        auto const fe = NumLib::createIsoparametricFiniteElement<
+            ShapeFunction, ShapeMatrixPolicy>(element);
+
+        for (unsigned ip = 0; ip < num_integration_points; ip++)
+        {
+            auto const& ns_and_weight = nss_and_weights[ip];
+            auto const ip_coords = interpolateCoords(ns_and_weight, fe);
+            coords.row(ip) << ip_coords[0], ip_coords[1], ip_coords[2];
+
+            ProcessLib::BoundaryConditionAndSourceTerm::Python::interpolate(
+                primary_variables_mat,
+                bc_or_st_data.all_process_variables_for_this_process,
+                ns_and_weight, prim_vars);
+            prim_vars_ips.row(ip) = prim_vars.transpose();
+        }
+    }
+
+    //! Assembles the local rhs and (possibly) Jacobian from fluxes that have
+    //! been computed for all integration points of this element beforehand,
+    //! cf. collectIntegrationPointData(), and adds them to the global rhs
+    //! vector and Jacobian matrix, respectively.
+    void assembleFromFluxes(
+        std::size_t const boundary_element_id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        Eigen::Ref<BoolVector const> const& flags,
+        Eigen::Ref<Eigen::VectorXd const> const& fluxes,
+        Eigen::Ref<RowMajorMatrix const> const& dFluxes, GlobalVector& b,
+        GlobalMatrix* const Jac) const
+    {
+        if (!flags.all())
+        {
+            // No flux value for some integration point. Skip assembly of the
+            // entire element.
+            return;
+        }
+
+        auto const& indices_this_component =
+            dof_table_boundary(boundary_element_id,
+                               bc_or_st_data.global_component_id)
+                .rows;
+        auto const num_dof_this_component = indices_this_component.size();
+
+        Eigen::VectorXd local_rhs =
+            Eigen::VectorXd::Zero(num_dof_this_component);
+        Eigen::MatrixXd local_Jac;
+        std::vector<GlobalIndexType> indices_all_components_for_Jac;
+
+        if (Jac)
+        {
+            indices_all_components_for_Jac =
+                NumLib::getIndices(boundary_element_id, dof_table_boundary);
+            local_Jac = Eigen::MatrixXd::Zero(
+                num_dof_this_component, indices_all_components_for_Jac.size());
+        }
+
+        std::vector<double> dFlux(dFluxes.cols());
+        unsigned const num_integration_points =
+            integration_method.getNumberOfPoints();
+
+        for (unsigned ip = 0; ip < num_integration_points; ip++)
+        {
+            auto const& ns_and_weight = nss_and_weights[ip];
+
+            assembleLocalRhs(fluxes[ip], ns_and_weight, local_rhs);
+
+            if (Jac)
+            {
+                MathLib::toVector(dFlux) = dFluxes.row(ip).transpose();
+                assembleLocalJacobian(dFlux, ns_and_weight, local_Jac);
+            }
+        }
+
+        b.add(indices_this_component, local_rhs);
+
+        if (Jac)
+        {
+            MathLib::RowColumnIndices<GlobalIndexType> rci{
+                indices_this_component, indices_all_components_for_Jac};
+            Jac->add(rci, local_Jac);
+        }
+    }
+
 private:
     //! Determines the coordinates that the point associated with the passed
     //! shape matrix by interpolating the element's node coordinates
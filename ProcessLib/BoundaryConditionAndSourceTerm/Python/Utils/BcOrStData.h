@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "BatchedTypes.h"
 #include "MeshLib/Mesh.h"
 #include "ProcessLib/ProcessVariable.h"
 
@@ -30,6 +31,15 @@ struct FlagAndFluxAndDFlux
     std::vector<double> dFlux;
 };
 
+//! Batched counterpart of FlagAndFluxAndDFlux holding the values at many
+//! integration points, one row per integration point.
+struct FlagsAndFluxesAndDFluxes
+{
+    BoolVector flags;
+    Eigen::VectorXd fluxes;
+    RowMajorMatrix dFluxes;
+};
+
 //! Contains data commonly used by Python BCs and STs, in particular by their
 //! local assemblers.
 template <typename BcOrStPythonSideInterface>
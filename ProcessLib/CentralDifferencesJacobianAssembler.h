@@ -59,6 +59,12 @@ public:
                               std::vector<double>& local_b_data,
                               std::vector<double>& local_Jac_data) override;
 
+    std::unique_ptr<AbstractJacobianAssembler> copy() const override
+    {
+        return std::make_unique<CentralDifferencesJacobianAssembler>(
+            std::vector<double>(_absolute_epsilons));
+    }
+
 private:
     std::vector<double> const _absolute_epsilons;
 
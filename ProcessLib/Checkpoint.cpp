@@ -0,0 +1,196 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "Checkpoint.h"
+
+#include <sstream>
+
+#include "BaseLib/Error.h"
+#include "Output/IntegrationPointWriter.h"
+#include "Process.h"
+
+namespace
+{
+template <typename... Args>
+void checkHdfStatus(const hid_t status, std::string const& formatting,
+                    Args&&... args)
+{
+    if (status < 0)
+    {
+        OGS_FATAL(formatting, std::forward<Args>(args)...);
+    }
+}
+
+std::string integrationPointGroup(ProcessLib::Process const& process)
+{
+    return "processes/" + process.name + "/integration_point_data/";
+}
+}  // namespace
+
+namespace ProcessLib
+{
+CheckpointFile::CheckpointFile(std::filesystem::path const& file,
+                               Mode const mode)
+    : _path(file),
+      _file(mode == Mode::Write
+                ? H5Fcreate(file.string().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT,
+                            H5P_DEFAULT)
+                : H5Fopen(file.string().c_str(), H5F_ACC_RDONLY, H5P_DEFAULT))
+{
+    checkHdfStatus(_file, "Could not open the checkpoint file '{:s}'.",
+                   _path.string());
+}
+
+CheckpointFile::~CheckpointFile()
+{
+    H5Fclose(_file);
+}
+
+void CheckpointFile::write(std::string const& name,
+                           std::span<double const> const values)
+{
+    write(name, H5T_NATIVE_DOUBLE, values.data(), values.size());
+}
+
+void CheckpointFile::write(std::string const& name,
+                           std::span<std::uint64_t const> const values)
+{
+    write(name, H5T_NATIVE_UINT64, values.data(), values.size());
+}
+
+void CheckpointFile::write(std::string const& name,
+                           std::string_view const value)
+{
+    write(name, H5T_NATIVE_CHAR, value.data(), value.size());
+}
+
+void CheckpointFile::write(std::string const& name, hid_t const type,
+                           void const* const data, std::size_t const size)
+{
+    hsize_t const dims[1] = {size};
+    hid_t const space = H5Screate_simple(1, dims, nullptr);
+
+    hid_t const link_properties = H5Pcreate(H5P_LINK_CREATE);
+    H5Pset_create_intermediate_group(link_properties, 1);
+
+    hid_t const dataset =
+        H5Dcreate2(_file, name.c_str(), type, space, link_properties,
+                   H5P_DEFAULT, H5P_DEFAULT);
+    checkHdfStatus(dataset, "Creating the dataset '{:s}' in '{:s}' failed.",
+                   name, _path.string());
+
+    if (size > 0)
+    {
+        checkHdfStatus(
+            H5Dwrite(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, data),
+            "Writing the dataset '{:s}' to '{:s}' failed.", name,
+            _path.string());
+    }
+
+    H5Dclose(dataset);
+    H5Pclose(link_properties);
+    H5Sclose(space);
+}
+
+template <typename T>
+std::vector<T> CheckpointFile::read(std::string const& name,
+                                    hid_t const type) const
+{
+    hid_t const dataset = H5Dopen2(_file, name.c_str(), H5P_DEFAULT);
+    checkHdfStatus(dataset, "The dataset '{:s}' is missing in '{:s}'.", name,
+                   _path.string());
+
+    hid_t const space = H5Dget_space(dataset);
+    std::vector<T> values(H5Sget_simple_extent_npoints(space));
+    if (!values.empty())
+    {
+        checkHdfStatus(H5Dread(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+                               values.data()),
+                       "Reading the dataset '{:s}' from '{:s}' failed.", name,
+                       _path.string());
+    }
+
+    H5Sclose(space);
+    H5Dclose(dataset);
+    return values;
+}
+
+std::vector<double> CheckpointFile::readDoubles(std::string const& name) const
+{
+    return read<double>(name, H5T_NATIVE_DOUBLE);
+}
+
+std::vector<std::uint64_t> CheckpointFile::readIntegers(
+    std::string const& name) const
+{
+    return read<std::uint64_t>(name, H5T_NATIVE_UINT64);
+}
+
+std::string CheckpointFile::readString(std::string const& name) const
+{
+    auto const chars = read<char>(name, H5T_NATIVE_CHAR);
+    return {chars.begin(), chars.end()};
+}
+
+void writeIntegrationPointData(CheckpointFile& checkpoint,
+                               Process const& process)
+{
+    auto const group = integrationPointGroup(process);
+
+    std::string names;
+    for (auto const& writer : process.getIntegrationPointWriters())
+    {
+        auto const name = writer->name();
+        names += name + '\n';
+
+        std::vector<double> values;
+        for (auto const& element_values : writer->values())
+        {
+            values.insert(values.end(), element_values.begin(),
+                          element_values.end());
+        }
+        checkpoint.write(group + name + "/values", values);
+
+        std::uint64_t const meta_data[] = {
+            static_cast<std::uint64_t>(writer->numberOfComponents()),
+            static_cast<std::uint64_t>(writer->integrationOrder())};
+        checkpoint.write(group + name + "/meta_data", meta_data);
+    }
+    checkpoint.write(group + "names", names);
+}
+
+void addIntegrationPointDataToMesh(CheckpointFile const& checkpoint,
+                                   Process& process)
+{
+    auto const group = integrationPointGroup(process);
+
+    std::vector<IntegrationPointMetaData> meta_data;
+    std::vector<std::vector<double>> values;
+    std::istringstream names(checkpoint.readString(group + "names"));
+    for (std::string name; std::getline(names, name);)
+    {
+        auto const n_components_and_order =
+            checkpoint.readIntegers(group + name + "/meta_data");
+        if (n_components_and_order.size() != 2)
+        {
+            OGS_FATAL(
+                "Invalid meta data of the integration point data '{:s}' in "
+                "'{:s}'.",
+                name, checkpoint.path().string());
+        }
+        meta_data.push_back(
+            {name, static_cast<int>(n_components_and_order[0]),
+             static_cast<int>(n_components_and_order[1])});
+        values.push_back(checkpoint.readDoubles(group + name + "/values"));
+    }
+
+    addIntegrationPointDataToMesh(process.getMesh(), meta_data, values);
+}
+}  // namespace ProcessLib
@@ -0,0 +1,98 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <hdf5.h>
+
+namespace MeshLib
+{
+class Mesh;
+}
+
+namespace ProcessLib
+{
+class Process;
+
+/// Settings of the checkpoints periodically written by the time loop.
+struct CheckpointSettings
+{
+    /// A checkpoint is written after every \c each_steps accepted time steps
+    /// and after the last time step.
+    std::size_t each_steps;
+    /// The checkpoint file, which is overwritten by each new checkpoint.
+    std::filesystem::path file;
+};
+
+/*! HDF5 file holding the state of a simulation for restarting it.
+ *
+ * The data are stored as one-dimensional datasets of doubles, unsigned
+ * integers, or characters. Dataset names may contain slashes, the necessary
+ * groups are created on writing.
+ */
+class CheckpointFile final
+{
+public:
+    enum class Mode
+    {
+        Read,
+        Write
+    };
+
+    /// Opens the file for reading or creates, respectively truncates, the
+    /// file for writing.
+    CheckpointFile(std::filesystem::path const& file, Mode const mode);
+
+    CheckpointFile(CheckpointFile const&) = delete;
+    CheckpointFile& operator=(CheckpointFile const&) = delete;
+
+    ~CheckpointFile();
+
+    std::filesystem::path const& path() const { return _path; }
+
+    void write(std::string const& name, std::span<double const> values);
+    void write(std::string const& name, std::span<std::uint64_t const> values);
+    void write(std::string const& name, std::string_view value);
+
+    std::vector<double> readDoubles(std::string const& name) const;
+    std::vector<std::uint64_t> readIntegers(std::string const& name) const;
+    std::string readString(std::string const& name) const;
+
+private:
+    void write(std::string const& name, hid_t const type, void const* data,
+               std::size_t const size);
+
+    template <typename T>
+    std::vector<T> read(std::string const& name, hid_t const type) const;
+
+    std::filesystem::path const _path;
+    hid_t _file;
+};
+
+/// Writes the integration point data of all integration point writers of the
+/// process to the checkpoint.
+void writeIntegrationPointData(CheckpointFile& checkpoint,
+                               Process const& process);
+
+/// Adds the integration point data of the process stored in the checkpoint to
+/// the process' mesh, from where they are read like initial conditions given
+/// as integration point data in the input mesh.
+///
+/// Must be called before the process is initialized.
+void addIntegrationPointDataToMesh(CheckpointFile const& checkpoint,
+                                   Process& process);
+}  // namespace ProcessLib
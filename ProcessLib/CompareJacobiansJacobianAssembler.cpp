@@ -395,6 +395,15 @@ void CompareJacobiansJacobianAssembler::assembleWithJacobian(
     }
 }
 
+std::unique_ptr<AbstractJacobianAssembler>
+CompareJacobiansJacobianAssembler::copy() const
+{
+    OGS_FATAL(
+        "The CompareJacobiansJacobianAssembler cannot be copied. It writes all "
+        "compared Jacobians into one log file and is therefore not usable "
+        "with a parallel global assembly.");
+}
+
 std::unique_ptr<CompareJacobiansJacobianAssembler>
 createCompareJacobiansJacobianAssembler(BaseLib::ConfigTree const& config)
 {
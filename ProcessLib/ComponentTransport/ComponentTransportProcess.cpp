@@ -12,7 +12,7 @@
 
 #include <cassert>
 
-#include "BaseLib/RunTime.h"
+#include "BaseLib/Profiler.h"
 #include "ChemistryLib/ChemicalSolverInterface.h"
 #include "MathLib/LinAlg/Eigen/EigenTools.h"
 #include "MathLib/LinAlg/FinalizeMatrixAssembly.h"
@@ -166,10 +166,9 @@ void ComponentTransportProcess::assembleConcreteProcess(
             [&]() { return std::ref(*_local_to_global_index_map); });
     }
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot, process_id, M, K,
-        b);
+    _global_assembler.assemble(
+        _local_assemblers, pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot,
+        process_id, M, K, b);
 }
 
 void ComponentTransportProcess::assembleWithJacobianConcreteProcess(
@@ -189,8 +188,7 @@ void ComponentTransportProcess::assembleWithJacobianConcreteProcess(
                     [&]() { return std::ref(*_local_to_global_index_map); });
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
+    _global_assembler.assembleWithJacobian(
         _local_assemblers, pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot,
         process_id, M, K, b, Jac);
 
@@ -258,14 +256,15 @@ void ComponentTransportProcess::solveReactionEquation(
             _local_assemblers, _chemical_solver_interface->getElementIDs(),
             dof_tables, x, t, dt);
 
-        BaseLib::RunTime time_phreeqc;
-        time_phreeqc.start();
+        {
+            BaseLib::ProfilerRegion time_phreeqc("chemistry");
 
-        _chemical_solver_interface->setAqueousSolutionsPrevFromDumpFile();
+            _chemical_solver_interface->setAqueousSolutionsPrevFromDumpFile();
 
-        _chemical_solver_interface->executeSpeciationCalculation(dt);
+            _chemical_solver_interface->executeSpeciationCalculation(dt);
 
-        INFO("[time] Phreeqc took {:g} s.", time_phreeqc.elapsed());
+            INFO("[time] Phreeqc took {:g} s.", time_phreeqc.elapsed());
+        }
 
         GlobalExecutor::executeSelectedMemberOnDereferenced(
             &ComponentTransportLocalAssemblerInterface::
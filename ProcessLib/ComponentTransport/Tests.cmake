@@ -780,6 +780,11 @@ if (NOT OGS_USE_MPI)
     OgsTest(PROJECTFILE Parabolic/ComponentTransport/ReactiveTransport/EquilibriumPhase/calciteDissolvePrecipitateOnly.prj RUNTIME 25)
     OgsTest(PROJECTFILE Parabolic/ComponentTransport/ReactiveTransport/CationExchange/exchange.prj RUNTIME 60)
     OgsTest(PROJECTFILE Parabolic/ComponentTransport/ReactiveTransport/CationExchange/exchangeAndSurface.prj RUNTIME 33)
+    OgsTest(PROJECTFILE Parabolic/ComponentTransport/ReactiveTransport/CationExchange/exchangeAndSurface_in_memory.xml RUNTIME 33)
+    if(TEST ogs-Parabolic/ComponentTransport/ReactiveTransport/CationExchange/exchangeAndSurface_in_memory)
+        set_tests_properties(ogs-Parabolic/ComponentTransport/ReactiveTransport/CationExchange/exchangeAndSurface_in_memory PROPERTIES
+            DEPENDS ogs-Parabolic/ComponentTransport/ReactiveTransport/CationExchange/exchangeAndSurface) # Prevent race condition
+    endif()
     OgsTest(PROJECTFILE Parabolic/ComponentTransport/ThermalDiffusion/TemperatureField_transport.prj RUNTIME 27)
 endif()
 
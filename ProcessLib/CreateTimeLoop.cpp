@@ -10,6 +10,8 @@
 
 #include "CreateTimeLoop.h"
 
+#include <filesystem>
+
 #include "BaseLib/ConfigTree.h"
 #include "ProcessLib/CreateProcessData.h"
 #include "ProcessLib/Output/CreateOutput.h"
@@ -60,6 +62,29 @@ std::unique_ptr<TimeLoop> createTimeLoop(
         createOutput(config.getConfigSubtree("output"), output_directory,
                      meshes);
 
+    std::optional<CheckpointSettings> checkpoint_settings;
+    //! \ogs_file_param{prj__time_loop__checkpoint}
+    if (auto const checkpoint_config =
+            config.getConfigSubtreeOptional("checkpoint"))
+    {
+#ifdef USE_PETSC
+        OGS_FATAL("Checkpoints are not supported with PETSc.");
+#endif
+        auto const each_steps =
+            //! \ogs_file_param{prj__time_loop__checkpoint__each_steps}
+            checkpoint_config->getConfigParameter<std::size_t>("each_steps");
+        if (each_steps == 0)
+        {
+            OGS_FATAL("The checkpoint interval 'each_steps' must be positive.");
+        }
+        auto const file =
+            //! \ogs_file_param{prj__time_loop__checkpoint__file}
+            checkpoint_config->getConfigParameter<std::string>(
+                "file", "checkpoint.h5");
+        checkpoint_settings = CheckpointSettings{
+            each_steps, std::filesystem::path(output_directory) / file};
+    }
+
     auto per_process_data = createPerProcessData(
         //! \ogs_file_param{prj__time_loop__processes}
         config.getConfigSubtree("processes"), processes, nonlinear_solvers,
@@ -94,6 +119,7 @@ std::unique_ptr<TimeLoop> createTimeLoop(
 
     return std::make_unique<TimeLoop>(
         std::move(output), std::move(per_process_data), max_coupling_iterations,
-        std::move(global_coupling_conv_criteria), start_time, end_time);
+        std::move(global_coupling_conv_criteria), start_time, end_time,
+        std::move(checkpoint_settings));
 }
 }  // namespace ProcessLib
@@ -37,10 +37,13 @@ template <int DisplacementDim, typename ShapeFunction,
           typename ShapeMatricesType, typename NodalForceVectorType,
           typename NodalDisplacementVectorType, typename GradientVectorType,
           typename GradientMatrixType, typename IPData,
-          typename IntegrationMethod>
+          typename IntegrationMethod, typename ReferenceShapeMatrices,
+          typename GeometricShapeMatricesAt>
 std::vector<double> const& getMaterialForces(
     std::vector<double> const& local_x, std::vector<double>& nodal_values,
     IntegrationMethod const& _integration_method, IPData const& _ip_data,
+    ReferenceShapeMatrices const& reference_shape_matrices,
+    GeometricShapeMatricesAt const& geometric_shape_matrices_at,
     MeshLib::Element const& element, bool const is_axially_symmetric)
 {
     unsigned const n_integration_points =
@@ -53,14 +56,15 @@ std::vector<double> const& getMaterialForces(
     for (unsigned ip = 0; ip < n_integration_points; ip++)
     {
         auto const& sigma = _ip_data[ip].sigma;
-        auto const& N = _ip_data[ip].N;
-        auto const& dNdx = _ip_data[ip].dNdx;
+        auto const& N = reference_shape_matrices.N[ip];
+        auto const& geometric = geometric_shape_matrices_at(ip);
+        auto const& dNdx = geometric.dNdx;
 
         auto const& psi = _ip_data[ip].free_energy_density;
 
         auto const x_coord =
             NumLib::interpolateXCoordinate<ShapeFunction, ShapeMatricesType>(
-                element, _ip_data[ip].N);
+                element, N);
 
         // For the 2D case the 33-component is needed (and the four entries
         // of the non-symmetric matrix); In 3d there are nine entries.
@@ -147,7 +151,7 @@ std::vector<double> const& getMaterialForces(
                 "other than 2 and 3.");
         }
 
-        auto const& w = _ip_data[ip].integration_weight;
+        auto const& w = geometric.integration_weight;
         local_b += G.transpose() * eshelby_stress * w;
     }
 
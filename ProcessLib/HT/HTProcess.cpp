@@ -103,10 +103,9 @@ void HTProcess::assembleConcreteProcess(const double t, double const dt,
 
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot, process_id, M, K,
-        b);
+    _global_assembler.assemble(
+        _local_assemblers, pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot,
+        process_id, M, K, b);
 }
 
 void HTProcess::assembleWithJacobianConcreteProcess(
@@ -130,8 +129,7 @@ void HTProcess::assembleWithJacobianConcreteProcess(
 
     // Call global assembler for each local assembly item.
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
+    _global_assembler.assembleWithJacobian(
         _local_assemblers, pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot,
         process_id, M, K, b, Jac);
 }
@@ -365,6 +365,11 @@ endif()
 
 if (NOT (OGS_USE_MPI))
     OgsTest(PROJECTFILE Parabolic/HT/SimpleSynthetics/deactivated_subdomain/HT_DeactivatedSubdomain.prj)
+    OgsTest(PROJECTFILE Parabolic/HT/SimpleSynthetics/deactivated_subdomain/HT_DeactivatedSubdomain_reduced.xml)
+    if(TEST ogs-Parabolic/HT/SimpleSynthetics/deactivated_subdomain/HT_DeactivatedSubdomain_reduced)
+        set_tests_properties(ogs-Parabolic/HT/SimpleSynthetics/deactivated_subdomain/HT_DeactivatedSubdomain_reduced PROPERTIES
+            DEPENDS ogs-Parabolic/HT/SimpleSynthetics/deactivated_subdomain/HT_DeactivatedSubdomain) # Prevent race condition
+    endif()
 endif()
 
 AddTest(
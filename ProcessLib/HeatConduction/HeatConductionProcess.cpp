@@ -71,10 +71,9 @@ void HeatConductionProcess::assembleConcreteProcess(
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        pv.getActiveElementIDs(), dof_table, t, dt, x, xdot, process_id, M, K,
-        b);
+    _global_assembler.assemble(
+        _local_assemblers, pv.getActiveElementIDs(), dof_table, t, dt, x, xdot,
+        process_id, M, K, b);
 
     MathLib::finalizeMatrixAssembly(M);
     MathLib::finalizeMatrixAssembly(K);
@@ -98,8 +97,7 @@ void HeatConductionProcess::assembleWithJacobianConcreteProcess(
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
+    _global_assembler.assembleWithJacobian(
         _local_assemblers, pv.getActiveElementIDs(), dof_table, t, dt, x, xdot,
         process_id, M, K, b, Jac);
 
@@ -260,6 +260,28 @@ if (NOT OGS_USE_MPI)
     OgsTest(PROJECTFILE Parabolic/T/1D_line_source_term_tests/moving_source_term.prj)
 endif()
 
+# The first half of moving_source_term writes a checkpoint, from which the
+# second half is restarted. The result equals the one of the uninterrupted run.
+AddTest(
+    NAME HeatConduction_moving_source_term_checkpoint
+    PATH Parabolic/T/1D_line_source_term_tests
+    EXECUTABLE ogs
+    EXECUTABLE_ARGS moving_source_term_checkpoint.xml
+    REQUIREMENTS NOT OGS_USE_MPI
+)
+
+AddTest(
+    NAME HeatConduction_moving_source_term_restart
+    PATH Parabolic/T/1D_line_source_term_tests
+    EXECUTABLE ogs
+    EXECUTABLE_ARGS --restart ${Data_BINARY_DIR}/Parabolic/T/1D_line_source_term_tests/moving_source_term_checkpoint.h5 moving_source_term_restart.xml
+    TESTER vtkdiff
+    REQUIREMENTS NOT OGS_USE_MPI
+    DEPENDS ogs-HeatConduction_moving_source_term_checkpoint
+    DIFF_DATA
+    moving_source_term_t_60.000000.vtu moving_source_term_restart_t_60.000000.vtu temperature temperature 1e-14 0
+)
+
 # tests for line source term implementation
 AddTest(
         NAME HeatConduction_2D_LineSourceTermLeft
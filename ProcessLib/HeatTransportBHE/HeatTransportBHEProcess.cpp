@@ -169,10 +169,9 @@ void HeatTransportBHEProcess::assembleConcreteProcess(
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        pv.getActiveElementIDs(), dof_table, t, dt, x, xdot, process_id, M, K,
-        b);
+    _global_assembler.assemble(
+        _local_assemblers, pv.getActiveElementIDs(), dof_table, t, dt, x, xdot,
+        process_id, M, K, b);
 }
 
 void HeatTransportBHEProcess::assembleWithJacobianConcreteProcess(
@@ -187,8 +186,7 @@ void HeatTransportBHEProcess::assembleWithJacobianConcreteProcess(
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
+    _global_assembler.assembleWithJacobian(
         _local_assemblers, pv.getActiveElementIDs(), dof_table, t, dt, x, xdot,
         process_id, M, K, b, Jac);
 }
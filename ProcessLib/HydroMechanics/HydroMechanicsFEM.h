@@ -117,7 +117,7 @@ struct IntegrationPointData final
         }
 
         MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C =
-            std::move(std::get<2>(*solution));
+            std::move(std::get<1>(*solution));
 
         return C;
     }
@@ -154,7 +154,7 @@ struct IntegrationPointData final
         }
 
         MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma_eff, material_state_variables, C) = std::move(*solution);
+        std::tie(sigma_eff, C) = std::move(*solution);
 
         return C;
     }
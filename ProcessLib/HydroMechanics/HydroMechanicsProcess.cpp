@@ -335,10 +335,9 @@ void HydroMechanicsProcess<DisplacementDim>::assembleConcreteProcess(
 
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        pv.getActiveElementIDs(), dof_table, t, dt, x, xdot, process_id, M, K,
-        b);
+    _global_assembler.assemble(
+        _local_assemblers, pv.getActiveElementIDs(), dof_table, t, dt, x, xdot,
+        process_id, M, K, b);
 }
 
 template <int DisplacementDim>
@@ -381,8 +380,7 @@ void HydroMechanicsProcess<DisplacementDim>::
 
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
+    _global_assembler.assembleWithJacobian(
         _local_assemblers, pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot,
         process_id, M, K, b, Jac);
 
@@ -254,7 +254,7 @@ void HydroMechanicsLocalAssemblerMatrix<ShapeFunctionDisplacement,
         }
 
         MathLib::KelvinVector::KelvinMatrixType<GlobalDim> C;
-        std::tie(sigma_eff, state, C) = std::move(*solution);
+        std::tie(sigma_eff, C) = std::move(*solution);
 
         J_uu.noalias() += B.transpose() * C * B * ip_w;
 
@@ -390,7 +390,7 @@ void HydroMechanicsLocalAssemblerMatrix<ShapeFunctionDisplacement,
         }
 
         MathLib::KelvinVector::KelvinMatrixType<GlobalDim> C;
-        std::tie(sigma_eff, state, C) = std::move(*solution);
+        std::tie(sigma_eff, C) = std::move(*solution);
 
         if (!_process_data.deactivate_matrix_in_flow)  // Only for hydraulically
                                                        // active matrix
@@ -171,7 +171,7 @@ void SmallDeformationLocalAssemblerMatrix<ShapeFunction, IntegrationMethod,
         }
 
         MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma, state, C) = std::move(*solution);
+        std::tie(sigma, C) = std::move(*solution);
 
         local_b.noalias() -= B.transpose() * sigma * w;
         local_Jac.noalias() += B.transpose() * C * B * w;
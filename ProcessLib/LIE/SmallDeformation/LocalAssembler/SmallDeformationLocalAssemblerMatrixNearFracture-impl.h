@@ -268,7 +268,7 @@ void SmallDeformationLocalAssemblerMatrixNearFracture<
         }
 
         MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma, state, C) = std::move(*solution);
+        std::tie(sigma, C) = std::move(*solution);
 
         // r_u = B^T * Sigma = B^T * C * B * (u+phi*[u])
         // r_[u] = (phi*B)^T * Sigma = (phi*B)^T * C * B * (u+phi*[u])
@@ -135,13 +135,11 @@ void LiquidFlowLocalAssembler<ShapeFunction, IntegrationMethod, GlobalDim>::
     ParameterLib::SpatialPosition pos;
     pos.setElementID(_element.getID());
 
-    auto const& medium = *_process_data.media_map->getMedium(_element.getID());
-    auto const& liquid_phase = medium.phase("AqueousLiquid");
+    auto const& mp = _medium_properties;
 
     MaterialPropertyLib::VariableArray vars;
     vars[static_cast<int>(MaterialPropertyLib::Variable::temperature)] =
-        medium[MaterialPropertyLib::PropertyType::reference_temperature]
-            .template value<double>(vars, pos, t, dt);
+        mp.reference_temperature.value(vars, pos, t, dt);
 
     GlobalDimVectorType const projected_body_force_vector =
         _process_data.element_rotation_matrices[_element.getID()] *
@@ -158,21 +156,13 @@ void LiquidFlowLocalAssembler<ShapeFunction, IntegrationMethod, GlobalDim>::
             p;
 
         // Compute density:
-        auto const fluid_density =
-            liquid_phase[MaterialPropertyLib::PropertyType::density]
-                .template value<double>(vars, pos, t, dt);
+        auto const fluid_density = mp.fluid_density.value(vars, pos, t, dt);
         assert(fluid_density > 0.);
-        auto const ddensity_dpressure =
-            liquid_phase[MaterialPropertyLib::PropertyType::density]
-                .template dValue<double>(
-                    vars, MaterialPropertyLib::Variable::phase_pressure, pos, t,
-                    dt);
+        auto const ddensity_dpressure = mp.fluid_density.dValue(
+            vars, MaterialPropertyLib::Variable::phase_pressure, pos, t, dt);
 
-        auto const porosity =
-            medium[MaterialPropertyLib::PropertyType::porosity]
-                .template value<double>(vars, pos, t, dt);
-        auto const storage = medium[MaterialPropertyLib::PropertyType::storage]
-                                 .template value<double>(vars, pos, t, dt);
+        auto const porosity = mp.porosity.value(vars, pos, t, dt);
+        auto const storage = mp.storage.value(vars, pos, t, dt);
 
         // Assemble mass matrix, M
         local_M.noalias() +=
@@ -180,15 +170,12 @@ void LiquidFlowLocalAssembler<ShapeFunction, IntegrationMethod, GlobalDim>::
             ip_data.N.transpose() * ip_data.N * ip_data.integration_weight;
 
         // Compute viscosity:
-        auto const viscosity =
-            liquid_phase[MaterialPropertyLib::PropertyType::viscosity]
-                .template value<double>(vars, pos, t, dt);
+        auto const viscosity = mp.fluid_viscosity.value(vars, pos, t, dt);
 
         pos.setIntegrationPoint(ip);
         GlobalDimMatrixType const permeability =
             MaterialPropertyLib::formEigenTensor<GlobalDim>(
-                medium[MaterialPropertyLib::PropertyType::permeability].value(
-                    vars, pos, t, dt));
+                mp.permeability.value(vars, pos, t, dt));
 
         // Assemble Laplacian, K, and RHS by the gravitational term
         LaplacianGravityVelocityCalculator::calculateLaplacianAndGravityTerm(
@@ -16,7 +16,9 @@
 #include <vector>
 
 #include "LiquidFlowData.h"
+#include "MaterialLib/MPL/MaterialSpatialDistributionMap.h"
 #include "MaterialLib/MPL/Medium.h"
+#include "MaterialLib/MPL/PropertyHandle.h"
 #include "MaterialLib/MPL/Utils/FormEffectiveThermalConductivity.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "NumLib/DOF/DOFTableUtil.h"
@@ -88,7 +90,9 @@ public:
                              LiquidFlowData const& process_data)
         : _element(element),
           _integration_method(integration_order),
-          _process_data(process_data)
+          _process_data(process_data),
+          _medium_properties(
+              *process_data.media_map->getMedium(element.getID()))
     {
         unsigned const n_integration_points =
             _integration_method.getNumberOfPoints();
@@ -217,6 +221,36 @@ private:
                               VelocityCacheType& darcy_velocity_at_ips) const;
 
     const LiquidFlowData& _process_data;
+
+    /// The properties of the element's medium used in the assembly, which
+    /// are looked up once instead of in every assembly.
+    struct MediumProperties
+    {
+        explicit MediumProperties(MaterialPropertyLib::Medium const& medium)
+            : reference_temperature(
+                  medium[MaterialPropertyLib::PropertyType::
+                             reference_temperature]),
+              porosity(medium[MaterialPropertyLib::PropertyType::porosity]),
+              storage(medium[MaterialPropertyLib::PropertyType::storage]),
+              permeability(
+                  medium[MaterialPropertyLib::PropertyType::permeability]),
+              fluid_density(medium.phase("AqueousLiquid")
+                                [MaterialPropertyLib::PropertyType::density]),
+              fluid_viscosity(
+                  medium.phase("AqueousLiquid")
+                      [MaterialPropertyLib::PropertyType::viscosity])
+        {
+        }
+
+        MaterialPropertyLib::PropertyHandle<double> reference_temperature;
+        MaterialPropertyLib::PropertyHandle<double> porosity;
+        MaterialPropertyLib::PropertyHandle<double> storage;
+        MaterialPropertyLib::Property const& permeability;
+        MaterialPropertyLib::PropertyHandle<double> fluid_density;
+        MaterialPropertyLib::PropertyHandle<double> fluid_viscosity;
+    };
+
+    MediumProperties const _medium_properties;
 };
 
 }  // namespace LiquidFlow
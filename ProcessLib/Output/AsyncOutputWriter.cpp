@@ -0,0 +1,135 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "AsyncOutputWriter.h"
+
+#include <utility>
+
+#include "BaseLib/Error.h"
+#include "BaseLib/Logging.h"
+#include "BaseLib/Profiler.h"
+#include "MeshLib/Mesh.h"
+
+namespace ProcessLib
+{
+AsyncOutputWriter::AsyncOutputWriter(std::size_t const max_queued_outputs)
+    : _max_queued_outputs(max_queued_outputs)
+{
+    if (_max_queued_outputs == 0)
+    {
+        OGS_FATAL("The asynchronous output needs a queue of non-zero size.");
+    }
+    _thread = std::thread([this] { run(); });
+}
+
+AsyncOutputWriter::~AsyncOutputWriter()
+{
+    {
+        std::lock_guard lock(_mutex);
+        _stop = true;
+    }
+    _queue_changed.notify_all();
+    _thread.join();
+
+    if (_error)
+    {
+        try
+        {
+            std::rethrow_exception(_error);
+        }
+        catch (std::exception const& e)
+        {
+            ERR("Asynchronous output failed: {:s}", e.what());
+        }
+        catch (...)
+        {
+            ERR("Asynchronous output failed.");
+        }
+    }
+}
+
+void AsyncOutputWriter::write(MeshLib::Mesh const& mesh,
+                              WriteFunction write_mesh)
+{
+    auto& mesh_copy = _meshes[&mesh];
+    if (!mesh_copy)
+    {
+        mesh_copy = std::make_unique<MeshLib::Mesh>(mesh);
+    }
+
+    // The snapshot is taken before waiting, the properties of the queued
+    // meshes are replaced on the background thread only.
+    Task task{mesh_copy.get(), mesh.getProperties(), std::move(write_mesh)};
+
+    std::unique_lock lock(_mutex);
+    _queue_changed.wait(
+        lock, [this] { return _error || _queue.size() < _max_queued_outputs; });
+    rethrowError();
+
+    _queue.push_back(std::move(task));
+    lock.unlock();
+    _queue_changed.notify_all();
+}
+
+void AsyncOutputWriter::flush()
+{
+    std::unique_lock lock(_mutex);
+    _queue_changed.wait(lock, [this] { return _queue.empty(); });
+    rethrowError();
+}
+
+void AsyncOutputWriter::rethrowError()
+{
+    if (_error)
+    {
+        std::rethrow_exception(std::exchange(_error, nullptr));
+    }
+}
+
+void AsyncOutputWriter::run()
+{
+    std::unique_lock lock(_mutex);
+    while (true)
+    {
+        _queue_changed.wait(lock,
+                            [this] { return _stop || !_queue.empty(); });
+        if (_queue.empty())
+        {
+            return;
+        }
+
+        // References to deque elements stay valid on push_back.
+        auto& task = _queue.front();
+        lock.unlock();
+
+        try
+        {
+            BaseLib::ProfilerRegion time_output("async_output");
+            task.mesh->getProperties() = std::move(task.properties);
+            task.write_mesh(*task.mesh);
+            DBUG("[time] Asynchronous output of mesh '{:s}' took {:g} s.",
+                 task.mesh->getName(), time_output.elapsed());
+        }
+        catch (...)
+        {
+            std::lock_guard error_lock(_mutex);
+            if (!_error)
+            {
+                _error = std::current_exception();
+            }
+        }
+
+        lock.lock();
+        _queue.pop_front();
+        _queue_changed.notify_all();
+    }
+}
+
+}  // namespace ProcessLib
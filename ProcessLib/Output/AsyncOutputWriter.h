@@ -0,0 +1,97 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "MeshLib/Properties.h"
+
+namespace MeshLib
+{
+class Mesh;
+}
+
+namespace ProcessLib
+{
+/*! Writes meshes on a background thread.
+ *
+ * For each output a snapshot of the mesh properties is taken, such that the
+ * simulation can continue to modify the mesh while the output is written. The
+ * meshes are written from copies, which are created on the first output of
+ * each mesh and only receive the property snapshots afterwards; the mesh
+ * geometry and topology must therefore not change during the simulation.
+ *
+ * At most \c max_queued_outputs outputs are pending at the same time; further
+ * calls of write() block until an output has been finished.
+ */
+class AsyncOutputWriter final
+{
+public:
+    using WriteFunction = std::function<void(MeshLib::Mesh const&)>;
+
+    explicit AsyncOutputWriter(std::size_t const max_queued_outputs);
+
+    AsyncOutputWriter(AsyncOutputWriter const&) = delete;
+    AsyncOutputWriter& operator=(AsyncOutputWriter const&) = delete;
+
+    //! Writes the remaining queued outputs. Errors are only logged.
+    ~AsyncOutputWriter();
+
+    //! Queues calling \c write_mesh for a copy of the given \c mesh with
+    //! the current mesh properties.
+    //!
+    //! Rethrows the exception of a failed previous output, if any.
+    void write(MeshLib::Mesh const& mesh, WriteFunction write_mesh);
+
+    //! Blocks until all queued outputs are written.
+    //!
+    //! Rethrows the exception of a failed output, if any.
+    void flush();
+
+private:
+    struct Task
+    {
+        MeshLib::Mesh* mesh;
+        MeshLib::Properties properties;
+        WriteFunction write_mesh;
+    };
+
+    //! Main loop of the background thread.
+    void run();
+
+    //! Rethrows and resets _error. Must be called with _mutex held.
+    void rethrowError();
+
+    std::size_t const _max_queued_outputs;
+
+    //! The copies of the meshes the outputs are written from. Only accessed
+    //! by the caller's thread; the copied meshes themselves are only modified
+    //! by the background thread.
+    std::map<MeshLib::Mesh const*, std::unique_ptr<MeshLib::Mesh>> _meshes;
+
+    std::mutex _mutex;
+    std::condition_variable _queue_changed;
+    //! Queued outputs. The front task stays in the queue while being written.
+    std::deque<Task> _queue;
+    bool _stop = false;
+    std::exception_ptr _error;
+
+    std::thread _thread;
+};
+
+}  // namespace ProcessLib
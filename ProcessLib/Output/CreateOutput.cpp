@@ -186,12 +186,16 @@ std::unique_ptr<Output> createOutput(
         //! \ogs_file_param{prj__time_loop__output__output_iteration_results}
         config.getConfigParameter<bool>("output_iteration_results", false);
 
+    auto const async_queue_size =
+        //! \ogs_file_param{prj__time_loop__output__async_queue_size}
+        config.getConfigParameter<std::size_t>("async_queue_size", 0);
+
     return std::make_unique<Output>(
         output_directory, output_type, prefix, suffix, compress_output,
         number_of_files, chunk_size_bytes, data_mode, output_iteration_results,
         std::move(repeats_each_steps), std::move(fixed_output_times),
         std::move(output_data_specification), std::move(mesh_names_for_output),
-        meshes);
+        meshes, async_queue_size);
 }
 
 }  // namespace ProcessLib
@@ -105,6 +105,24 @@ void addIntegrationPointDataToMesh(
     }
 }
 
+void addIntegrationPointDataToMesh(
+    MeshLib::Mesh& mesh, std::vector<IntegrationPointMetaData> const& meta_data,
+    std::vector<std::vector<double>> const& values)
+{
+    assert(meta_data.size() == values.size());
+    for (std::size_t i = 0; i < meta_data.size(); i++)
+    {
+        auto& field_data = *MeshLib::getOrCreateMeshProperty<double>(
+            mesh, meta_data[i].name, MeshLib::MeshItemType::IntegrationPoint,
+            meta_data[i].n_components);
+        field_data.assign(values[i].begin(), values[i].end());
+    }
+    if (!meta_data.empty())
+    {
+        addIntegrationPointMetaData(mesh, meta_data);
+    }
+}
+
 IntegrationPointMetaData getIntegrationPointMetaData(
     MeshLib::Properties const& properties, std::string const& name)
 {
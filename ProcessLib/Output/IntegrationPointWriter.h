@@ -90,6 +90,15 @@ struct IntegrationPointMetaData
     int const integration_order;
 };
 
+/// Add integration point data the the mesh's properties.
+///
+/// Like the overload above but for data which are not provided by integration
+/// point writers, e.g., read from a checkpoint. The \c values contain the
+/// integration point data of all elements for each of the \c meta_data.
+void addIntegrationPointDataToMesh(
+    MeshLib::Mesh& mesh, std::vector<IntegrationPointMetaData> const& meta_data,
+    std::vector<std::vector<double>> const& values);
+
 /// Returns integration point meta data for the given field name.
 ///
 /// The data is read from a JSON encoded string stored in field data array.
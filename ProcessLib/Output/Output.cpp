@@ -12,7 +12,9 @@
 
 #include <cassert>
 #include <exception>
+#include <filesystem>
 #include <fstream>
+#include <sstream>
 #include <vector>
 
 #ifndef _WIN32
@@ -22,11 +24,13 @@
 #endif  // _WIN32
 
 #include "AddProcessDataToMesh.h"
+#include "AsyncOutputWriter.h"
 #include "Applications/InSituLib/Adaptor.h"
 #include "BaseLib/FileTools.h"
 #include "BaseLib/Logging.h"
-#include "BaseLib/RunTime.h"
+#include "BaseLib/Profiler.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "ProcessLib/Checkpoint.h"
 #include "ProcessLib/Process.h"
 
 namespace ProcessLib
@@ -207,6 +211,19 @@ void outputMeshVtk(ProcessLib::OutputFile const& output_file,
     outputMeshVtk(output_file.path, mesh, output_file.compression,
                   output_file.data_mode);
 }
+
+/// Returns the checkpoint group of a PVD file. The PVD files are identified by
+/// their file name and, because several process ids of a staggered scheme
+/// share the same file name, by the number of preceding PVD files with the
+/// same name.
+std::string pvdFileCheckpointGroup(
+    std::string const& pvd_filename,
+    std::map<std::string, int>& number_of_pvd_files_by_name)
+{
+    return "output/" +
+           std::filesystem::path(pvd_filename).filename().string() + "/" +
+           std::to_string(number_of_pvd_files_by_name[pvd_filename]++) + "/";
+}
 }  // namespace
 
 namespace ProcessLib
@@ -269,7 +286,8 @@ Output::Output(std::string directory, OutputType file_type,
                std::vector<double>&& fixed_output_times,
                OutputDataSpecification&& output_data_specification,
                std::vector<std::string>&& mesh_names_for_output,
-               std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes)
+               std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes,
+               std::size_t const async_queue_size)
     : _output_directory(std::move(directory)),
       _output_file_type(file_type),
       _output_file_prefix(std::move(file_prefix)),
@@ -291,6 +309,90 @@ Output::Output(std::string directory, OutputType file_type,
             "Vector of fixed output time steps passed to the Output "
             "constructor must be sorted");
     }
+
+    if (async_queue_size == 0)
+    {
+        return;
+    }
+#ifdef USE_PETSC
+    WARN(
+        "Asynchronous output is not supported with PETSc. The output will be "
+        "written synchronously.");
+#else
+    if (_output_file_type != OutputType::vtk)
+    {
+        WARN(
+            "Asynchronous output is only supported for VTK output. The output "
+            "will be written synchronously.");
+        return;
+    }
+    _async_writer = std::make_unique<AsyncOutputWriter>(async_queue_size);
+#endif
+}
+
+Output::~Output() = default;
+
+void Output::flush()
+{
+    if (_async_writer)
+    {
+        _async_writer->flush();
+    }
+}
+
+void Output::writeCheckpoint(CheckpointFile& checkpoint) const
+{
+    std::map<std::string, int> number_of_pvd_files_by_name;
+    for (auto const& [process, pvd_file] : _process_to_pvd_file)
+    {
+        auto const group = pvdFileCheckpointGroup(pvd_file.pvd_filename,
+                                                  number_of_pvd_files_by_name);
+
+        std::vector<double> times;
+        std::string vtu_files;
+        for (auto const& [time, vtu_file] : pvd_file.getDatasets())
+        {
+            times.push_back(time);
+            vtu_files += vtu_file + '\n';
+        }
+        checkpoint.write(group + "times", times);
+        checkpoint.write(group + "files", vtu_files);
+    }
+}
+
+void Output::readCheckpoint(CheckpointFile const& checkpoint)
+{
+    if (_output_file_type == OutputType::xdmf)
+    {
+        WARN(
+            "The XDMF output of a restarted simulation does not contain the "
+            "time steps before the restart.");
+    }
+
+    std::map<std::string, int> number_of_pvd_files_by_name;
+    for (auto& [process, pvd_file] : _process_to_pvd_file)
+    {
+        auto const group = pvdFileCheckpointGroup(pvd_file.pvd_filename,
+                                                  number_of_pvd_files_by_name);
+
+        auto const times = checkpoint.readDoubles(group + "times");
+        std::istringstream vtu_files(checkpoint.readString(group + "files"));
+
+        std::vector<std::pair<double, std::string>> datasets;
+        for (auto const time : times)
+        {
+            std::string vtu_file;
+            if (!std::getline(vtu_files, vtu_file))
+            {
+                OGS_FATAL(
+                    "The numbers of times and files of the PVD file '{:s}' "
+                    "differ in the checkpoint '{:s}'.",
+                    pvd_file.pvd_filename, checkpoint.path().string());
+            }
+            datasets.emplace_back(time, vtu_file);
+        }
+        pvd_file.setDatasets(std::move(datasets));
+    }
 }
 
 void Output::addProcess(ProcessLib::Process const& process)
@@ -383,7 +485,18 @@ void Output::outputMeshes(
 
             auto& pvd_file =
                 findPVDFile(process, process_id, mesh.get().getName());
-            ::outputMeshVtk(file, pvd_file, mesh, t);
+            if (!_async_writer)
+            {
+                ::outputMeshVtk(file, pvd_file, mesh, t);
+                continue;
+            }
+
+            pvd_file.addVTUFile(file.name, t);
+            _async_writer->write(
+                mesh,
+                [path = file.path, compression = file.compression,
+                 data_mode = file.data_mode](MeshLib::Mesh const& mesh_copy)
+                { ::outputMeshVtk(path, mesh_copy, compression, data_mode); });
         }
     }
     else if (_output_file_type == ProcessLib::OutputType::xdmf)
@@ -444,8 +557,7 @@ void Output::doOutputAlways(Process const& process,
                             int const iteration,
                             std::vector<GlobalVector*> const& xs)
 {
-    BaseLib::RunTime time_output;
-    time_output.start();
+    BaseLib::ProfilerRegion time_output("output");
 
     bool const output_secondary_variables = true;
     auto const process_output_data =
@@ -532,8 +644,7 @@ void Output::doOutputNonlinearIteration(Process const& process,
         return;
     }
 
-    BaseLib::RunTime time_output;
-    time_output.start();
+    BaseLib::ProfilerRegion time_output("output_nonlinear_iteration");
 
     bool const output_secondary_variable = true;
     auto const process_output_data =
@@ -21,6 +21,8 @@
 
 namespace ProcessLib
 {
+class AsyncOutputWriter;
+class CheckpointFile;
 class Process;
 
 /// Private struct that contains certain properties of output files.
@@ -64,7 +66,10 @@ public:
            std::vector<double>&& fixed_output_times,
            OutputDataSpecification&& output_data_specification,
            std::vector<std::string>&& mesh_names_for_output,
-           std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes);
+           std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes,
+           std::size_t const async_queue_size = 0);
+
+    ~Output();
 
     //! TODO doc. Opens a PVD file for each process.
     void addProcess(ProcessLib::Process const& process);
@@ -97,6 +102,17 @@ public:
                                     const double t, const int iteration,
                                     std::vector<GlobalVector*> const& xs);
 
+    //! Waits until all outputs queued for asynchronous writing have been
+    //! written.
+    void flush();
+
+    //! Writes the time steps recorded in the PVD files to the checkpoint.
+    void writeCheckpoint(CheckpointFile& checkpoint) const;
+
+    //! Restores the time steps recorded in the PVD files from the checkpoint,
+    //! such that the PVD files continue the series of the restarted run.
+    void readCheckpoint(CheckpointFile const& checkpoint);
+
     std::vector<double> const& getFixedOutputTimes() const
     {
         return _fixed_output_times;
@@ -175,6 +191,10 @@ private:
     OutputDataSpecification const _output_data_specification;
     std::vector<std::string> _mesh_names_for_output;
     std::vector<std::unique_ptr<MeshLib::Mesh>> const& _meshes;
+
+    //! Writes the VTK output files on a background thread if asynchronous
+    //! output has been requested, otherwise a nullptr.
+    std::unique_ptr<AsyncOutputWriter> _async_writer;
 };
 
 }  // namespace ProcessLib
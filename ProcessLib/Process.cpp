@@ -60,7 +60,8 @@ Process::Process(
                   pcs_sts.emplace_back(SourceTermCollection(parameters));
               }
               return pcs_sts;
-          }(_process_variables.size()))
+          }(_process_variables.size())),
+      _parameters(parameters)
 {
 }
 
@@ -386,6 +387,12 @@ void Process::preTimestep(std::vector<GlobalVector*> const& x, const double t,
 {
     for (auto* const solution : x)
         MathLib::LinAlg::setLocalAccessibleVector(*solution);
+
+    for (auto const& parameter : _parameters)
+    {
+        parameter->preTimestep(t);
+    }
+
     preTimestepConcreteProcess(x, t, delta_t, process_id);
 
     _boundary_conditions[process_id].preTimestep(t, x, process_id);
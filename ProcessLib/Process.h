@@ -100,6 +100,13 @@ public:
 
     void updateDeactivatedSubdomains(double const time, const int process_id);
 
+    /// Sets the threading of the global assembly loops, see
+    /// VectorMatrixAssembler::setOptions().
+    void setGlobalAssemblyOptions(GlobalAssemblyOptions const& options)
+    {
+        _global_assembler.setOptions(options);
+    }
+
     bool isMonolithicSchemeUsed() const { return _use_monolithic_scheme; }
     virtual void setCoupledTermForTheStaggeredSchemeToLocalAssemblers(
         int const /*process_id*/)
@@ -373,6 +380,11 @@ private:
     std::vector<SourceTermCollection> _source_term_collections;
 
     ExtrapolatorData _extrapolator_data;
+
+    /// All parameters of the project. Their time-only parts are evaluated
+    /// once per time step in preTimestep().
+    std::vector<std::unique_ptr<ParameterLib::ParameterBase>> const&
+        _parameters;
 };
 
 }  // namespace ProcessLib
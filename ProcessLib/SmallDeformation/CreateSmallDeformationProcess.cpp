@@ -117,10 +117,44 @@ std::unique_ptr<Process> createSmallDeformationProcess(
         MathLib::KelvinVector::kelvin_vector_dimensions(DisplacementDim),
         &mesh);
 
+    auto const recompute_shape_function_derivatives =
+        //! \ogs_file_param{prj__processes__process__SMALL_DEFORMATION__recompute_shape_function_derivatives}
+        config.getConfigParameter<bool>("recompute_shape_function_derivatives",
+                                        false);
+
+    std::optional<int> batched_mfront_integration_threads;
+    auto const batched_mfront_integration_config =
+        //! \ogs_file_param{prj__processes__process__SMALL_DEFORMATION__batched_mfront_integration}
+        config.getConfigSubtreeOptional("batched_mfront_integration");
+    if (batched_mfront_integration_config)
+    {
+#ifndef OGS_USE_MFRONT
+        OGS_FATAL(
+            "The batched MFront integration requires OGS to be built with "
+            "MFront.");
+#endif
+        batched_mfront_integration_threads =
+            //! \ogs_file_param{prj__processes__process__SMALL_DEFORMATION__batched_mfront_integration__number_of_threads}
+            batched_mfront_integration_config->getConfigParameter<int>(
+                "number_of_threads", 1);
+        if (*batched_mfront_integration_threads < 1)
+        {
+            OGS_FATAL(
+                "The number of threads of the batched MFront integration must "
+                "be at least 1, but is {:d}.",
+                *batched_mfront_integration_threads);
+        }
+    }
+
     SmallDeformationProcessData<DisplacementDim> process_data{
-        materialIDs(mesh),   std::move(solid_constitutive_relations),
-        initial_stress,      solid_density,
-        specific_body_force, reference_temperature};
+        materialIDs(mesh),
+        std::move(solid_constitutive_relations),
+        initial_stress,
+        solid_density,
+        specific_body_force,
+        reference_temperature,
+        recompute_shape_function_derivatives,
+        batched_mfront_integration_threads};
 
     SecondaryVariableCollection secondary_variables;
 
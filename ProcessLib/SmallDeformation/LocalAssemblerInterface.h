@@ -56,6 +56,16 @@ struct SmallDeformationLocalAssemblerInterface
     virtual typename MaterialLib::Solids::MechanicsBase<
         DisplacementDim>::MaterialStateVariables const&
     getMaterialStateVariablesAt(unsigned /*integration_point*/) const = 0;
+
+#ifdef OGS_USE_MFRONT
+    /// Computes the strains of the integration points of an element, which
+    /// belongs to a batch of the MFront integration, and writes them into the
+    /// batch. Does nothing for other elements.
+    virtual void computeMFrontBatchStrains(
+        std::size_t const mesh_item_id,
+        NumLib::LocalToGlobalIndexMap const& dof_table, GlobalVector const& x,
+        double const t) = 0;
+#endif
 };
 
 }  // namespace SmallDeformation
@@ -0,0 +1,92 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cassert>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "MaterialLib/SolidModels/MFront/MFront.h"
+#include "ParameterLib/SpatialPosition.h"
+
+namespace ProcessLib
+{
+namespace SmallDeformation
+{
+/// State and buffers of the batched integration of all integration points with
+/// the same MFront constitutive relation, see
+/// SmallDeformationProcessData::batched_mfront_integration_threads.
+///
+/// Each local assembler owns a contiguous range of the integration points,
+/// starting at the index returned by addIntegrationPoints(). It writes the
+/// strains and temperatures of its integration points before integrate() and
+/// reads their stresses and tangents afterwards.
+template <int DisplacementDim>
+struct MFrontBatch
+{
+    using MFront = MaterialLib::Solids::MFront::MFront<DisplacementDim>;
+    using KelvinVector = typename MFront::KelvinVector;
+    using KelvinMatrix = typename MFront::KelvinMatrix;
+
+    MFrontBatch(MFront const& mfront_, std::size_t const n,
+                int const number_of_threads)
+        : mfront(mfront_),
+          state(mfront_.createBatchStateVariables(n, number_of_threads)),
+          x(n),
+          eps_m(n),
+          T(n, std::numeric_limits<double>::quiet_NaN()),
+          sigma(n),
+          C(n)
+    {
+        for (auto& eps : eps_m)
+        {
+            eps.setZero();
+        }
+    }
+
+    MFrontBatch(MFrontBatch const&) = delete;
+    MFrontBatch(MFrontBatch&&) = delete;
+
+    /// Assigns the next \c n integration points of the batch to an element and
+    /// returns the index of the first one.
+    std::size_t addIntegrationPoints(std::size_t const n)
+    {
+        assert(_number_of_assigned_points + n <= x.size());
+        return std::exchange(_number_of_assigned_points,
+                             _number_of_assigned_points + n);
+    }
+
+    /// Integrates the stresses of all integration points at once. The strains
+    /// of integration points in deactivated elements are kept from their last
+    /// assembly.
+    void integrate(double const t, double const dt)
+    {
+        assert(_number_of_assigned_points == x.size());
+        mfront.integrateStressBatch(x, t, dt, eps_m, T, T, *state, sigma, C);
+    }
+
+    MFront const& mfront;
+    std::unique_ptr<typename MFront::BatchStateVariables> state;
+    std::vector<ParameterLib::SpatialPosition> x;
+    std::vector<KelvinVector, Eigen::aligned_allocator<KelvinVector>> eps_m;
+    std::vector<double> T;
+    std::vector<KelvinVector, Eigen::aligned_allocator<KelvinVector>> sigma;
+    std::vector<KelvinMatrix, Eigen::aligned_allocator<KelvinMatrix>> C;
+
+private:
+    std::size_t _number_of_assigned_points = 0;
+};
+
+}  // namespace SmallDeformation
+}  // namespace ProcessLib
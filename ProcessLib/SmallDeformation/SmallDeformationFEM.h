@@ -12,15 +12,18 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "LocalAssemblerInterface.h"
 #include "MaterialLib/PhysicalConstant.h"
 #include "MaterialLib/SolidModels/SelectSolidConstitutiveRelation.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/Extrapolation/ExtrapolatableElement.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
 #include "NumLib/Fem/InitShapeMatrices.h"
+#include "NumLib/Fem/ReferenceElementShapeMatrices.h"
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
 #include "ParameterLib/Parameter.h"
 #include "ProcessLib/Deformation/BMatrixPolicy.h"
@@ -31,6 +34,10 @@
 #include "ProcessLib/Utils/SetOrGetIntegrationPointData.h"
 #include "SmallDeformationProcessData.h"
 
+#ifdef OGS_USE_MFRONT
+#include "MaterialLib/SolidModels/MFront/MFront.h"
+#endif
+
 namespace ProcessLib
 {
 namespace SmallDeformation
@@ -44,9 +51,19 @@ struct IntegrationPointData final
     explicit IntegrationPointData(
         MaterialLib::Solids::MechanicsBase<DisplacementDim> const&
             solid_material)
+        : IntegrationPointData(solid_material,
+                               solid_material.createMaterialStateVariables())
+    {
+    }
+
+    IntegrationPointData(
+        MaterialLib::Solids::MechanicsBase<DisplacementDim> const&
+            solid_material,
+        std::unique_ptr<typename MaterialLib::Solids::MechanicsBase<
+            DisplacementDim>::MaterialStateVariables>&&
+            material_state_variables)
         : solid_material(solid_material),
-          material_state_variables(
-              solid_material.createMaterialStateVariables())
+          material_state_variables(std::move(material_state_variables))
     {
     }
 
@@ -59,10 +76,6 @@ struct IntegrationPointData final
         DisplacementDim>::MaterialStateVariables>
         material_state_variables;
 
-    double integration_weight;
-    typename ShapeMatricesType::NodalRowVectorType N;
-    typename ShapeMatricesType::GlobalDimNodalMatrixType dNdx;
-
     void pushBackState()
     {
         eps_prev = eps;
@@ -73,14 +86,6 @@ struct IntegrationPointData final
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
-/// Used for the extrapolation of the integration point values. It is ordered
-/// (and stored) by integration points.
-template <typename ShapeMatrixType>
-struct SecondaryData
-{
-    std::vector<ShapeMatrixType, Eigen::aligned_allocator<ShapeMatrixType>> N;
-};
-
 template <typename ShapeFunction, typename IntegrationMethod,
           int DisplacementDim>
 class SmallDeformationLocalAssembler
@@ -105,6 +110,8 @@ public:
     using GradientMatrixType = typename GMatricesType::GradientMatrixType;
     using IpData =
         IntegrationPointData<BMatricesType, ShapeMatricesType, DisplacementDim>;
+    using GeometricShapeMatrices =
+        NumLib::GeometricShapeMatrices<ShapeMatricesType>;
 
     SmallDeformationLocalAssembler(SmallDeformationLocalAssembler const&) =
         delete;
@@ -118,6 +125,10 @@ public:
         SmallDeformationProcessData<DisplacementDim>& process_data)
         : _process_data(process_data),
           _integration_method(integration_order),
+          _reference_shape_matrices(
+              NumLib::getReferenceElementShapeMatrices<ShapeFunction,
+                                                       ShapeMatricesType>(
+                  _integration_method)),
           _element(e),
           _is_axially_symmetric(is_axially_symmetric)
     {
@@ -125,12 +136,14 @@ public:
             _integration_method.getNumberOfPoints();
 
         _ip_data.reserve(n_integration_points);
-        _secondary_data.N.resize(n_integration_points);
 
-        auto const shape_matrices =
-            NumLib::initShapeMatrices<ShapeFunction, ShapeMatricesType,
-                                      DisplacementDim>(e, is_axially_symmetric,
-                                                       _integration_method);
+        if (!_process_data.recompute_shape_function_derivatives)
+        {
+            _geometric_shape_matrices =
+                NumLib::initGeometricShapeMatrices<
+                    ShapeFunction, ShapeMatricesType, DisplacementDim>(
+                    e, is_axially_symmetric, _reference_shape_matrices);
+        }
 
         auto& solid_material =
             MaterialLib::Solids::selectSolidConstitutiveRelation(
@@ -138,17 +151,44 @@ public:
                 _process_data.material_ids,
                 e.getID());
 
+#ifdef OGS_USE_MFRONT
+        if (auto const batch = _process_data.mfront_batches.find(
+                dynamic_cast<MFront const*>(&solid_material));
+            batch != _process_data.mfront_batches.end())
+        {
+            _mfront_batch = batch->second.get();
+            _mfront_batch_offset =
+                _mfront_batch->addIntegrationPoints(n_integration_points);
+            for (unsigned ip = 0; ip < n_integration_points; ip++)
+            {
+                _mfront_batch->x[_mfront_batch_offset + ip] =
+                    ParameterLib::SpatialPosition{
+                        std::nullopt, e.getID(), ip,
+                        MathLib::Point3d(
+                            NumLib::interpolateCoordinates<ShapeFunction,
+                                                           ShapeMatricesType>(
+                                e, _reference_shape_matrices.N[ip]))};
+            }
+        }
+#endif
+
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
-            _ip_data.emplace_back(solid_material);
+#ifdef OGS_USE_MFRONT
+            if (_mfront_batch)
+            {
+                // The state is kept in the batch only.
+                _ip_data.emplace_back(
+                    solid_material,
+                    _mfront_batch->mfront.createBatchMaterialStateVariables(
+                        *_mfront_batch->state, _mfront_batch_offset + ip));
+            }
+            else
+#endif
+            {
+                _ip_data.emplace_back(solid_material);
+            }
             auto& ip_data = _ip_data[ip];
-            auto const& sm = shape_matrices[ip];
-            _ip_data[ip].integration_weight =
-                _integration_method.getWeightedPoint(ip).getWeight() *
-                sm.integralMeasure * sm.detJ;
-
-            ip_data.N = sm.N;
-            ip_data.dNdx = sm.dNdx;
 
             static const int kelvin_vector_size =
                 MathLib::KelvinVector::kelvin_vector_dimensions(
@@ -160,8 +200,6 @@ public:
             // Previous time step values are not initialized and are set later.
             ip_data.sigma_prev.resize(kelvin_vector_size);
             ip_data.eps_prev.resize(kelvin_vector_size);
-
-            _secondary_data.N[ip] = shape_matrices[ip].N;
         }
     }
 
@@ -212,7 +250,7 @@ public:
                     MathLib::Point3d(
                         NumLib::interpolateCoordinates<ShapeFunction,
                                                        ShapeMatricesType>(
-                            _element, ip_data.N))};
+                            _element, _reference_shape_matrices.N[ip]))};
 
                 ip_data.sigma =
                     MathLib::KelvinVector::symmetricTensorToKelvinVector<
@@ -223,8 +261,65 @@ public:
             }
 
             ip_data.pushBackState();
+
+#ifdef OGS_USE_MFRONT
+            if (_mfront_batch)
+            {
+                auto const i = _mfront_batch_offset + ip;
+                _mfront_batch->mfront.setBatchInitialState(
+                    *_mfront_batch->state, i, _mfront_batch->x[i],
+                    ip_data.eps_prev, ip_data.sigma_prev);
+            }
+#endif
+        }
+    }
+
+#ifdef OGS_USE_MFRONT
+    void computeMFrontBatchStrains(
+        std::size_t const mesh_item_id,
+        NumLib::LocalToGlobalIndexMap const& dof_table, GlobalVector const& x,
+        double const t) override
+    {
+        if (!_mfront_batch)
+        {
+            return;
+        }
+
+        auto const local_x = x.get(NumLib::getIndices(mesh_item_id, dof_table));
+        auto const ele_local_coord = elementCoordinatesMapping();
+        GeometricShapeMatrices geometric_buffer;
+        unsigned const n_integration_points =
+            _integration_method.getNumberOfPoints();
+
+        for (unsigned ip = 0; ip < n_integration_points; ip++)
+        {
+            auto const& geometric =
+                geometricShapeMatrices(ip, ele_local_coord, geometric_buffer);
+            auto const& N = _reference_shape_matrices.N[ip];
+
+            auto const x_coord =
+                NumLib::interpolateXCoordinate<ShapeFunction,
+                                               ShapeMatricesType>(_element, N);
+            auto const B = LinearBMatrix::computeBMatrix<
+                DisplacementDim, ShapeFunction::NPOINTS,
+                typename BMatricesType::BMatrixType>(
+                geometric.dNdx, N, x_coord, _is_axially_symmetric);
+
+            auto const i = _mfront_batch_offset + ip;
+            _mfront_batch->eps_m[i].noalias() =
+                B *
+                Eigen::Map<typename BMatricesType::NodalForceVectorType const>(
+                    local_x.data(), ShapeFunction::NPOINTS * DisplacementDim);
+
+            _mfront_batch->T[i] =
+                _process_data.reference_temperature
+                    ? _process_data.reference_temperature
+                          ->template evaluateFixedSize<1>(
+                              t, _mfront_batch->x[i])[0]
+                    : std::numeric_limits<double>::quiet_NaN();
         }
     }
+#endif
 
     void assemble(double const /*t*/, double const /*dt*/,
                   std::vector<double> const& /*local_x*/,
@@ -264,12 +359,32 @@ public:
 
         auto const& b = _process_data.specific_body_force;
 
+        // The density is evaluated for all integration points at once, which
+        // is a single lookup for parameters constant in an element.
+        std::vector<MathLib::Point3d> ip_coordinates;
+        ip_coordinates.reserve(n_integration_points);
+        for (unsigned ip = 0; ip < n_integration_points; ip++)
+        {
+            ip_coordinates.emplace_back(
+                NumLib::interpolateCoordinates<ShapeFunction,
+                                               ShapeMatricesType>(
+                    _element, _reference_shape_matrices.N[ip]));
+        }
+        std::vector<double> rho(n_integration_points);
+        _process_data.solid_density.evaluateAtIntegrationPoints(
+            _element, t, ip_coordinates, rho);
+
+        auto const ele_local_coord = elementCoordinatesMapping();
+        GeometricShapeMatrices geometric_buffer;
+
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
             x_position.setIntegrationPoint(ip);
-            auto const& w = _ip_data[ip].integration_weight;
-            auto const& N = _ip_data[ip].N;
-            auto const& dNdx = _ip_data[ip].dNdx;
+            auto const& geometric =
+                geometricShapeMatrices(ip, ele_local_coord, geometric_buffer);
+            auto const& w = geometric.integration_weight;
+            auto const& N = _reference_shape_matrices.N[ip];
+            auto const& dNdx = geometric.dNdx;
 
             typename ShapeMatricesType::template MatrixType<DisplacementDim,
                                                             displacement_size>
@@ -305,43 +420,55 @@ public:
                 Eigen::Map<typename BMatricesType::NodalForceVectorType const>(
                     local_x.data(), ShapeFunction::NPOINTS * DisplacementDim);
 
-            variables_prev[static_cast<int>(MPL::Variable::stress)]
-                .emplace<
-                    MathLib::KelvinVector::KelvinVectorType<DisplacementDim>>(
-                    sigma_prev);
-            variables_prev[static_cast<int>(MPL::Variable::mechanical_strain)]
-                .emplace<
-                    MathLib::KelvinVector::KelvinVectorType<DisplacementDim>>(
-                    eps_prev);
-
-            double const T_ref =
-                _process_data.reference_temperature
-                    ? (*_process_data.reference_temperature)(t, x_position)[0]
-                    : std::numeric_limits<double>::quiet_NaN();
-
-            variables_prev[static_cast<int>(MPL::Variable::temperature)]
-                .emplace<double>(T_ref);
-            variables[static_cast<int>(MPL::Variable::mechanical_strain)]
-                .emplace<
-                    MathLib::KelvinVector::KelvinVectorType<DisplacementDim>>(
-                    eps);
-            variables[static_cast<int>(MPL::Variable::temperature)]
-                .emplace<double>(T_ref);
-
-            auto&& solution = _ip_data[ip].solid_material.integrateStress(
-                variables_prev, variables, t, x_position, dt, *state);
-
-            if (!solution)
+            MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
+#ifdef OGS_USE_MFRONT
+            if (_mfront_batch)
             {
-                OGS_FATAL("Computation of local constitutive relation failed.");
+                // The stresses of all integration points of the batch have
+                // been integrated before the assembly, see
+                // computeMFrontBatchStrains().
+                sigma = _mfront_batch->sigma[_mfront_batch_offset + ip];
+                C = _mfront_batch->C[_mfront_batch_offset + ip];
+            }
+            else
+#endif
+            {
+                variables_prev[static_cast<int>(MPL::Variable::stress)]
+                    .emplace<MathLib::KelvinVector::KelvinVectorType<
+                        DisplacementDim>>(sigma_prev);
+                variables_prev[static_cast<int>(
+                                   MPL::Variable::mechanical_strain)]
+                    .emplace<MathLib::KelvinVector::KelvinVectorType<
+                        DisplacementDim>>(eps_prev);
+
+                double const T_ref =
+                    _process_data.reference_temperature
+                        ? _process_data.reference_temperature
+                              ->template evaluateFixedSize<1>(t, x_position)[0]
+                        : std::numeric_limits<double>::quiet_NaN();
+
+                variables_prev[static_cast<int>(MPL::Variable::temperature)]
+                    .emplace<double>(T_ref);
+                variables[static_cast<int>(MPL::Variable::mechanical_strain)]
+                    .emplace<MathLib::KelvinVector::KelvinVectorType<
+                        DisplacementDim>>(eps);
+                variables[static_cast<int>(MPL::Variable::temperature)]
+                    .emplace<double>(T_ref);
+
+                auto&& solution = _ip_data[ip].solid_material.integrateStress(
+                    variables_prev, variables, t, x_position, dt, *state);
+
+                if (!solution)
+                {
+                    OGS_FATAL(
+                        "Computation of local constitutive relation failed.");
+                }
+
+                std::tie(sigma, C) = std::move(*solution);
             }
 
-            MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-            std::tie(sigma, state, C) = std::move(*solution);
-
-            auto const rho = _process_data.solid_density(t, x_position)[0];
             local_b.noalias() -=
-                (B.transpose() * sigma - N_u_op.transpose() * rho * b) * w;
+                (B.transpose() * sigma - N_u_op.transpose() * rho[ip] * b) * w;
             local_Jac.noalias() += B.transpose() * C * B * w;
         }
     }
@@ -378,18 +505,27 @@ public:
         std::vector<double> const& local_x,
         std::vector<double>& nodal_values) override
     {
+        auto const ele_local_coord = elementCoordinatesMapping();
+        GeometricShapeMatrices geometric_buffer;
+
         return ProcessLib::SmallDeformation::getMaterialForces<
             DisplacementDim, ShapeFunction, ShapeMatricesType,
             typename BMatricesType::NodalForceVectorType,
             NodalDisplacementVectorType, GradientVectorType,
-            GradientMatrixType>(local_x, nodal_values, _integration_method,
-                                _ip_data, _element, _is_axially_symmetric);
+            GradientMatrixType>(
+            local_x, nodal_values, _integration_method, _ip_data,
+            _reference_shape_matrices,
+            [&](unsigned const ip) -> GeometricShapeMatrices const& {
+                return geometricShapeMatrices(ip, ele_local_coord,
+                                              geometric_buffer);
+            },
+            _element, _is_axially_symmetric);
     }
 
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
         const unsigned integration_point) const override
     {
-        auto const& N = _secondary_data.N[integration_point];
+        auto const& N = _reference_shape_matrices.N[integration_point];
 
         // assumes N is stored contiguously in memory
         return Eigen::Map<const Eigen::RowVectorXd>(N.data(), N.size());
@@ -500,15 +636,67 @@ public:
     }
 
 private:
+    /// The element's node coordinates in its local coordinate system if the
+    /// geometric shape matrices are recomputed, otherwise nothing. Created once
+    /// per element and reused for all its integration points.
+    std::optional<MeshLib::ElementCoordinatesMappingLocal>
+    elementCoordinatesMapping() const
+    {
+        if (!_geometric_shape_matrices.empty())
+        {
+            return std::nullopt;
+        }
+        return std::optional<MeshLib::ElementCoordinatesMappingLocal>{
+            std::in_place, _element, DisplacementDim};
+    }
+
+    /// Returns the stored geometric shape matrices of the integration point,
+    /// or recomputes them into the given buffer.
+    GeometricShapeMatrices const& geometricShapeMatrices(
+        unsigned const ip,
+        std::optional<MeshLib::ElementCoordinatesMappingLocal> const&
+            ele_local_coord,
+        GeometricShapeMatrices& buffer) const
+    {
+        if (!ele_local_coord)
+        {
+            return _geometric_shape_matrices[ip];
+        }
+        NumLib::computeGeometricShapeMatrices<ShapeFunction>(
+            _element, *ele_local_coord, _is_axially_symmetric,
+            _reference_shape_matrices, ip, buffer);
+        return buffer;
+    }
+
     SmallDeformationProcessData<DisplacementDim>& _process_data;
 
     std::vector<IpData, Eigen::aligned_allocator<IpData>> _ip_data;
 
     IntegrationMethod _integration_method;
+    /// N and dNdr of the reference element, shared with all elements of the
+    /// same type.
+    NumLib::ReferenceElementShapeMatrices<ShapeMatricesType> const&
+        _reference_shape_matrices;
+    /// dNdx and integration weights of the integration points. Empty if they
+    /// are recomputed in each assembly, see
+    /// SmallDeformationProcessData::recompute_shape_function_derivatives.
+    std::vector<GeometricShapeMatrices,
+                Eigen::aligned_allocator<GeometricShapeMatrices>>
+        _geometric_shape_matrices;
     MeshLib::Element const& _element;
-    SecondaryData<typename ShapeMatrices::ShapeType> _secondary_data;
     bool const _is_axially_symmetric;
 
+#ifdef OGS_USE_MFRONT
+    using MFront = MaterialLib::Solids::MFront::MFront<DisplacementDim>;
+
+    /// The batch of the element's MFront constitutive relation and the index
+    /// of the element's first integration point in it. Only set if the
+    /// batched integration is enabled, see
+    /// SmallDeformationProcessData::batched_mfront_integration_threads.
+    MFrontBatch<DisplacementDim>* _mfront_batch = nullptr;
+    std::size_t _mfront_batch_offset = 0;
+#endif
+
     static const int displacement_size =
         ShapeFunction::NPOINTS * DisplacementDim;
 };
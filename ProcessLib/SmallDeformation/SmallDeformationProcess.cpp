@@ -13,6 +13,8 @@
 #include <cassert>
 #include <nlohmann/json.hpp>
 
+#include "MaterialLib/SolidModels/SelectSolidConstitutiveRelation.h"
+#include "NumLib/Fem/Integration/IntegrationMethodRegistry.h"
 #include "ProcessLib/Deformation/SolidMaterialInternalToSecondaryVariables.h"
 #include "ProcessLib/Output/IntegrationPointWriter.h"
 #include "ProcessLib/Process.h"
@@ -90,6 +92,13 @@ void SmallDeformationProcess<DisplacementDim>::initializeConcreteProcess(
 {
     using nlohmann::json;
 
+#ifdef OGS_USE_MFRONT
+    if (_process_data.batched_mfront_integration_threads)
+    {
+        createMFrontBatches(mesh.getElements(), integration_order);
+    }
+#endif
+
     ProcessLib::SmallDeformation::createLocalAssemblers<
         DisplacementDim, SmallDeformationLocalAssembler>(
         mesh.getElements(), dof_table, _local_assemblers,
@@ -198,10 +207,9 @@ void SmallDeformationProcess<DisplacementDim>::assembleConcreteProcess(
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        pv.getActiveElementIDs(), dof_table, t, dt, x, xdot, process_id, M, K,
-        b);
+    _global_assembler.assemble(
+        _local_assemblers, pv.getActiveElementIDs(), dof_table, t, dt, x, xdot,
+        process_id, M, K, b);
 }
 
 template <int DisplacementDim>
@@ -217,11 +225,26 @@ void SmallDeformationProcess<DisplacementDim>::
 
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
+#ifdef OGS_USE_MFRONT
+    if (!_process_data.mfront_batches.empty())
+    {
+        // The local assemblers of the batched elements only read the stresses
+        // and tangents integrated here.
+        GlobalExecutor::executeSelectedMemberOnDereferenced(
+            &LocalAssemblerInterface::computeMFrontBatchStrains,
+            _local_assemblers, pv.getActiveElementIDs(),
+            *_local_to_global_index_map, *x[process_id], t);
+        for (auto const& mfront_batch : _process_data.mfront_batches)
+        {
+            mfront_batch.second->integrate(t, dt);
+        }
+    }
+#endif
+
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
+    _global_assembler.assembleWithJacobian(
         _local_assemblers, pv.getActiveElementIDs(), dof_table, t, dt, x, xdot,
         process_id, M, K, b, Jac);
 
@@ -245,6 +268,13 @@ void SmallDeformationProcess<DisplacementDim>::postTimestepConcreteProcess(
         &LocalAssemblerInterface::postTimestep, _local_assemblers,
         pv.getActiveElementIDs(), dof_tables, x, t, dt);
 
+#ifdef OGS_USE_MFRONT
+    for (auto const& mfront_batch : _process_data.mfront_batches)
+    {
+        mfront_batch.second->state->pushBackState();
+    }
+#endif
+
     std::unique_ptr<GlobalVector> material_forces;
     ProcessLib::SmallDeformation::writeMaterialForces(
         material_forces, _local_assemblers, *_local_to_global_index_map,
@@ -269,6 +299,44 @@ void SmallDeformationProcess<DisplacementDim>::computeSecondaryVariableConcrete(
         &LocalAssemblerInterface::computeSecondaryVariable, _local_assemblers,
         pv.getActiveElementIDs(), dof_tables, t, dt, x, x_dot, process_id);
 }
+#ifdef OGS_USE_MFRONT
+template <int DisplacementDim>
+void SmallDeformationProcess<DisplacementDim>::createMFrontBatches(
+    std::vector<MeshLib::Element*> const& elements,
+    unsigned const integration_order)
+{
+    using MFront = MaterialLib::Solids::MFront::MFront<DisplacementDim>;
+
+    // The batches must be sized before the local assemblers take their
+    // integration points from them.
+    std::map<MFront const*, std::size_t> number_of_integration_points;
+    for (auto const* const element : elements)
+    {
+        auto const* const mfront = dynamic_cast<MFront const*>(
+            &MaterialLib::Solids::selectSolidConstitutiveRelation(
+                _process_data.solid_materials, _process_data.material_ids,
+                element->getID()));
+        if (mfront == nullptr)
+        {
+            continue;
+        }
+        number_of_integration_points[mfront] +=
+            NumLib::IntegrationMethodRegistry::getIntegrationMethod(
+                typeid(*element), integration_order)
+                .getNumberOfPoints();
+    }
+
+    for (auto const& [mfront, n] : number_of_integration_points)
+    {
+        DBUG("Create a batch of {:d} integration points for MFront.", n);
+        _process_data.mfront_batches.emplace(
+            mfront, std::make_unique<MFrontBatch<DisplacementDim>>(
+                        *mfront, n,
+                        *_process_data.batched_mfront_integration_threads));
+    }
+}
+#endif
+
 template class SmallDeformationProcess<2>;
 template class SmallDeformationProcess<3>;
 
@@ -70,6 +70,13 @@ private:
                                           GlobalVector const& x_dot,
                                           const int process_id) override;
 
+#ifdef OGS_USE_MFRONT
+    /// Creates one batch for each MFront constitutive relation holding the
+    /// integration points of all elements using it.
+    void createMFrontBatches(std::vector<MeshLib::Element*> const& elements,
+                             unsigned const integration_order);
+#endif
+
 private:
     SmallDeformationProcessData<DisplacementDim> _process_data;
 
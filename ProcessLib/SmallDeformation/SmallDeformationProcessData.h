@@ -10,13 +10,19 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include <Eigen/Eigen>
 
 #include "ParameterLib/Parameter.h"
 
+#ifdef OGS_USE_MFRONT
+#include "MFrontBatch.h"
+#endif
+
 namespace MaterialLib
 {
 namespace Solids
@@ -53,6 +59,25 @@ struct SmallDeformationProcessData
 
     ParameterLib::Parameter<double> const* const reference_temperature;
 
+    /// If set, the shape function derivatives and integration weights are
+    /// recomputed in each assembly instead of being stored for all integration
+    /// points, trading memory for computation time.
+    bool const recompute_shape_function_derivatives;
+
+    /// If set, the stresses of all integration points with the same MFront
+    /// constitutive relation are integrated at once using MFront's batched
+    /// interface with the given number of threads.
+    std::optional<int> const batched_mfront_integration_threads;
+
+#ifdef OGS_USE_MFRONT
+    /// One batch for each MFront constitutive relation if the batched
+    /// integration is enabled. Created by the process before the local
+    /// assemblers.
+    std::map<MaterialLib::Solids::MFront::MFront<DisplacementDim> const*,
+             std::unique_ptr<MFrontBatch<DisplacementDim>>>
+        mfront_batches = {};
+#endif
+
     std::array<MeshLib::PropertyVector<double>*, 3> principal_stress_vector = {
         nullptr, nullptr, nullptr};
     MeshLib::PropertyVector<double>* principal_stress_values = nullptr;
@@ -19,6 +19,11 @@ if (NOT OGS_USE_MPI)
         endif()
     endif()
     OgsTest(PROJECTFILE Mechanics/Linear/disc_with_hole.prj)
+    OgsTest(PROJECTFILE Mechanics/Linear/disc_with_hole_recompute_shape_function_derivatives.xml)
+    if(TEST ogs-Mechanics/Linear/disc_with_hole_recompute_shape_function_derivatives)
+        set_tests_properties(ogs-Mechanics/Linear/disc_with_hole_recompute_shape_function_derivatives PROPERTIES
+            DEPENDS ogs-Mechanics/Linear/disc_with_hole) # Prevent race condition
+    endif()
     OgsTest(PROJECTFILE Mechanics/Linear/ElementDeactivation3D/element_deactivation_M_3D.prj)
     OgsTest(PROJECTFILE Mechanics/Linear/square_1e5.prj RUNTIME 200)
     OgsTest(PROJECTFILE Mechanics/Linear/square_1e2_quad8_traction_top.prj)
@@ -90,6 +95,11 @@ if (OGS_USE_MFRONT)
     #TODO (naumov) enable when output file format can be specified
     #OgsTest(PROJECTFILE Mechanics/MohrCoulombAbboSloan/oedometer.prj RUNTIME 80)
     OgsTest(PROJECTFILE Mechanics/Linear/MFront/cube_1e0_orthotropic_xyz.prj)
+    OgsTest(PROJECTFILE Mechanics/Linear/MFront/cube_1e0_orthotropic_xyz_batched.xml)
+    if(TEST ogs-Mechanics/Linear/MFront/cube_1e0_orthotropic_xyz_batched)
+        set_tests_properties(ogs-Mechanics/Linear/MFront/cube_1e0_orthotropic_xyz_batched PROPERTIES
+            DEPENDS ogs-Mechanics/Linear/MFront/cube_1e0_orthotropic_xyz) # Prevent race condition
+    endif()
     OgsTest(PROJECTFILE Mechanics/Linear/MFront/cube_1e0_orthotropic_yzx.prj)
     OgsTest(PROJECTFILE Mechanics/Linear/MFront/cube_1e0_orthotropic_zxy.prj)
     OgsTest(PROJECTFILE Mechanics/Linear/MFront/square_1e0_orthotropic_xyz.prj)
@@ -131,6 +141,21 @@ AddTest(
     cube_1e0_dp_ref_created_with_OGS_Ehlers.vtu cube_1e0_dp_ts_203_t_5.100000.vtu epsilon epsilon 1e-14 0
 )
 
+# Tests the batched integration of a behaviour with internal state variables.
+AddTest(
+    NAME Mechanics_DruckerPrager_mfront_batched
+    PATH Mechanics/Ehlers/MFront
+    WORKING_DIRECTORY ${Data_SOURCE_DIR}/Mechanics/Ehlers/MFront
+    EXECUTABLE ogs
+    EXECUTABLE_ARGS cube_1e0_dp_batched.xml
+    TESTER vtkdiff
+    REQUIREMENTS NOT OGS_USE_MPI
+    DIFF_DATA
+    cube_1e0_dp_ref_created_with_OGS_Ehlers.vtu cube_1e0_dp_batched_ts_203_t_5.100000.vtu displacement displacement 1e-14 0
+    cube_1e0_dp_ref_created_with_OGS_Ehlers.vtu cube_1e0_dp_batched_ts_203_t_5.100000.vtu sigma sigma 2e-13 0
+    cube_1e0_dp_ref_created_with_OGS_Ehlers.vtu cube_1e0_dp_batched_ts_203_t_5.100000.vtu epsilon epsilon 1e-14 0
+)
+
 # Tests that axial symmetry works correctly.
 # NB: Currently (2018-11-06) the plane strain hypothesis is used within MFront!
 AddTest(
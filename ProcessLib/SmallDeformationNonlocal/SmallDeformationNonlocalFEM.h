@@ -401,7 +401,7 @@ public:
                 OGS_FATAL("Computation of local constitutive relation failed.");
             }
 
-            std::tie(sigma, state, C) = std::move(*solution);
+            std::tie(sigma, C) = std::move(*solution);
 
             /// Compute only the local kappa_d.
             {
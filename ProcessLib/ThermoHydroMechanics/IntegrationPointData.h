@@ -112,7 +112,7 @@ struct IntegrationPointData final
         }
 
         MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C =
-            std::move(std::get<2>(*solution));
+            std::move(std::get<1>(*solution));
 
         return C;
     }
@@ -145,7 +145,7 @@ struct IntegrationPointData final
             OGS_FATAL("Computation of local constitutive relation failed.");
 
         MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma_eff, material_state_variables, C) = std::move(*solution);
+        std::tie(sigma_eff, C) = std::move(*solution);
 
         return C;
     }
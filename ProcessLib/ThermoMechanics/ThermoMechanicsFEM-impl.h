@@ -249,7 +249,7 @@ void ThermoMechanicsLocalAssembler<ShapeFunction, IntegrationMethod,
         }
 
         MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma, state, C) = std::move(*solution);
+        std::tie(sigma, C) = std::move(*solution);
 
         local_Jac
             .template block<displacement_size, displacement_size>(
@@ -475,7 +475,7 @@ void ThermoMechanicsLocalAssembler<ShapeFunction, IntegrationMethod,
         }
 
         MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma, state, C) = std::move(*solution);
+        std::tie(sigma, C) = std::move(*solution);
 
         local_Jac.noalias() += B.transpose() * C * B * w;
 
@@ -10,8 +10,10 @@
 
 #include "TimeLoop.h"
 
+#include <filesystem>
+
 #include "BaseLib/Error.h"
-#include "BaseLib/RunTime.h"
+#include "BaseLib/Profiler.h"
 #include "CoupledSolutionsForStaggeredScheme.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
@@ -38,6 +40,60 @@ void updateDeactivatedSubdomains(
     }
 }
 
+void writeTimeStep(ProcessLib::CheckpointFile& checkpoint,
+                   std::string const& name, NumLib::TimeStep const& timestep)
+{
+    double const times[] = {timestep.previous(), timestep.current(),
+                            timestep.dt()};
+    checkpoint.write(name + "/times", times);
+    std::uint64_t const number_and_accepted[] = {timestep.timeStepNumber(),
+                                                 timestep.isAccepted()};
+    checkpoint.write(name + "/number_and_accepted", number_and_accepted);
+}
+
+NumLib::TimeStep readTimeStep(ProcessLib::CheckpointFile const& checkpoint,
+                              std::string const& name)
+{
+    auto const times = checkpoint.readDoubles(name + "/times");
+    auto const number_and_accepted =
+        checkpoint.readIntegers(name + "/number_and_accepted");
+    if (times.size() != 3 || number_and_accepted.size() != 2)
+    {
+        OGS_FATAL("Invalid time step '{:s}' in the checkpoint '{:s}'.", name,
+                  checkpoint.path().string());
+    }
+    NumLib::TimeStep timestep(times[0], times[1], times[2],
+                              number_and_accepted[0]);
+    timestep.setAccepted(number_and_accepted[1] != 0);
+    return timestep;
+}
+
+void writeVector(ProcessLib::CheckpointFile& checkpoint,
+                 std::string const& name, GlobalVector const& x)
+{
+    std::vector<double> values;
+    x.copyValues(values);
+    checkpoint.write(name, values);
+}
+
+void readVector(ProcessLib::CheckpointFile const& checkpoint,
+                std::string const& name, GlobalVector& x)
+{
+    auto const values = checkpoint.readDoubles(name);
+    if (values.size() != static_cast<std::size_t>(x.size()))
+    {
+        OGS_FATAL(
+            "The vector '{:s}' in the checkpoint '{:s}' has {:d} entries, but "
+            "{:d} are expected.",
+            name, checkpoint.path().string(), values.size(), x.size());
+    }
+    for (GlobalIndexType i = 0; i < x.size(); i++)
+    {
+        x.set(i, values[i]);
+    }
+    MathLib::LinAlg::finalizeAssembly(x);
+}
+
 }  // namespace
 
 namespace ProcessLib
@@ -278,11 +334,13 @@ TimeLoop::TimeLoop(std::unique_ptr<Output>&& output,
                    const int global_coupling_max_iterations,
                    std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>&&
                        global_coupling_conv_crit,
-                   const double start_time, const double end_time)
+                   const double start_time, const double end_time,
+                   std::optional<CheckpointSettings> checkpoint_settings)
     : _output(std::move(output)),
       _per_process_data(std::move(per_process_data)),
       _start_time(start_time),
       _end_time(end_time),
+      _checkpoint_settings(std::move(checkpoint_settings)),
       _global_coupling_max_iterations(global_coupling_max_iterations),
       _global_coupling_conv_crit(std::move(global_coupling_conv_crit))
 {
@@ -482,7 +540,7 @@ std::pair<double, bool> TimeLoop::computeTimeStepping(
 }
 
 /// initialize output, convergence criterion, etc.
-void TimeLoop::initialize()
+void TimeLoop::initialize(CheckpointFile const* const checkpoint)
 {
     for (auto& process_data : _per_process_data)
     {
@@ -504,6 +562,11 @@ void TimeLoop::initialize()
     std::tie(_process_solutions, _process_solutions_prev) =
         setInitialConditions(_start_time, _per_process_data);
 
+    if (checkpoint)
+    {
+        readCheckpoint(*checkpoint);
+    }
+
     // All _per_process_data share the first process.
     bool const is_staggered_coupling =
         !isMonolithicProcess(*_per_process_data[0]);
@@ -513,26 +576,31 @@ void TimeLoop::initialize()
         setCoupledSolutions();
     }
 
-    // Output initial conditions
+    if (!checkpoint)
     {
+        // Output initial conditions
         const bool output_initial_condition = true;
         outputSolutions(output_initial_condition, 0, _start_time, *_output,
                         &Output::doOutput);
-    }
 
-    std::tie(_dt, _last_step_rejected) = computeTimeStepping(
-        0.0, _current_time, _accepted_steps, _rejected_steps);
+        std::tie(_dt, _last_step_rejected) = computeTimeStepping(
+            0.0, _current_time, _accepted_steps, _rejected_steps);
+    }
 
-    updateDeactivatedSubdomains(_per_process_data, _start_time);
+    updateDeactivatedSubdomains(_per_process_data, _current_time);
 
-    calculateNonEquilibriumInitialResiduum(
-        _per_process_data, _process_solutions, _process_solutions_prev);
+    // On a restart the non-equilibrium initial residuum has been read from the
+    // checkpoint, because the restored state is not the initial one.
+    if (!checkpoint)
+    {
+        calculateNonEquilibriumInitialResiduum(
+            _per_process_data, _process_solutions, _process_solutions_prev);
+    }
 }
 
 bool TimeLoop::executeTimeStep()
 {
-    BaseLib::RunTime time_timestep;
-    time_timestep.start();
+    BaseLib::ProfilerRegion time_timestep("time_step");
 
     _current_time += _dt;
     const double prev_dt = _dt;
@@ -553,16 +621,28 @@ bool TimeLoop::executeTimeStep()
     std::tie(_dt, _last_step_rejected) = computeTimeStepping(
         prev_dt, _current_time, _accepted_steps, _rejected_steps);
 
+    bool const end_time_reached =
+        std::abs(_current_time - _end_time) <
+            std::numeric_limits<double>::epsilon() ||
+        _current_time + _dt > _end_time;
+
     if (!_last_step_rejected)
     {
         const bool output_initial_condition = false;
         outputSolutions(output_initial_condition, timesteps, current_time,
                         *_output, &Output::doOutput);
+
+        // The final state is always written, such that the simulation can be
+        // continued with a later end time.
+        if (_checkpoint_settings &&
+            (_accepted_steps % _checkpoint_settings->each_steps == 0 ||
+             end_time_reached))
+        {
+            writeCheckpoint();
+        }
     }
 
-    if (std::abs(_current_time - _end_time) <
-            std::numeric_limits<double>::epsilon() ||
-        _current_time + _dt > _end_time)
+    if (end_time_reached)
     {
         return false;
     }
@@ -594,6 +674,115 @@ void TimeLoop::outputLastTimeStep() const
                         _accepted_steps + _rejected_steps, _current_time,
                         *_output, &Output::doOutputLastTimestep);
     }
+
+    // Wait for the outputs still being written in the background.
+    _output->flush();
+}
+
+void TimeLoop::writeCheckpoint() const
+{
+    BaseLib::ProfilerRegion time_checkpoint("checkpoint");
+
+    // The checkpoint refers to the output files written so far.
+    _output->flush();
+
+    // Write to a temporary file first, such that a valid checkpoint remains
+    // if the simulation is aborted while writing.
+    auto const& file = _checkpoint_settings->file;
+    auto temporary_file = file;
+    temporary_file += ".tmp";
+    {
+        CheckpointFile checkpoint(temporary_file, CheckpointFile::Mode::Write);
+
+        double const times[] = {_current_time, _dt};
+        checkpoint.write("time_loop/times", times);
+        std::uint64_t const counters[] = {
+            _accepted_steps, _rejected_steps,
+            static_cast<std::uint64_t>(_repeating_times_of_rejected_step),
+            _last_step_rejected};
+        checkpoint.write("time_loop/counters", counters);
+
+        for (std::size_t i = 0; i < _per_process_data.size(); i++)
+        {
+            auto const& ppd = *_per_process_data[i];
+            auto const group = "process_data/" + std::to_string(i) + "/";
+
+            writeVector(checkpoint, group + "x", *_process_solutions[i]);
+            writeVector(checkpoint, group + "x_prev",
+                        *_process_solutions_prev[i]);
+            writeTimeStep(checkpoint, group + "timestep_previous",
+                          ppd.timestep_previous);
+            writeTimeStep(checkpoint, group + "timestep_current",
+                          ppd.timestep_current);
+            checkpoint.write(group + "timestep_algorithm",
+                             ppd.timestep_algorithm->getInternalState());
+            if (auto const* const r_neq =
+                    ppd.nonlinear_solver.getNonEquilibriumInitialResiduum())
+            {
+                writeVector(checkpoint, group + "r_neq", *r_neq);
+            }
+
+            // Processes of a staggered scheme share the integration point
+            // data, which are stored with the first process id.
+            if (ppd.process_id == 0)
+            {
+                writeIntegrationPointData(checkpoint, ppd.process);
+            }
+        }
+
+        _output->writeCheckpoint(checkpoint);
+    }
+    std::filesystem::rename(temporary_file, file);
+
+    INFO("[time] Writing the checkpoint '{:s}' at time {:g} took {:g} s.",
+         file.string(), _current_time, time_checkpoint.elapsed());
+}
+
+void TimeLoop::readCheckpoint(CheckpointFile const& checkpoint)
+{
+    auto const times = checkpoint.readDoubles("time_loop/times");
+    auto const counters = checkpoint.readIntegers("time_loop/counters");
+    if (times.size() != 2 || counters.size() != 4)
+    {
+        OGS_FATAL("Invalid time loop state in the checkpoint '{:s}'.",
+                  checkpoint.path().string());
+    }
+    _current_time = times[0];
+    _dt = times[1];
+    _accepted_steps = counters[0];
+    _rejected_steps = counters[1];
+    _repeating_times_of_rejected_step = static_cast<int>(counters[2]);
+    _last_step_rejected = counters[3] != 0;
+
+    for (std::size_t i = 0; i < _per_process_data.size(); i++)
+    {
+        auto& ppd = *_per_process_data[i];
+        auto const group = "process_data/" + std::to_string(i) + "/";
+
+        readVector(checkpoint, group + "x", *_process_solutions[i]);
+        readVector(checkpoint, group + "x_prev", *_process_solutions_prev[i]);
+        ppd.timestep_previous =
+            readTimeStep(checkpoint, group + "timestep_previous");
+        ppd.timestep_current =
+            readTimeStep(checkpoint, group + "timestep_current");
+        ppd.timestep_algorithm->setInternalState(
+            checkpoint.readDoubles(group + "timestep_algorithm"));
+        ppd.time_disc->setInitialState(_current_time);
+
+        if (ppd.nonlinear_solver.isNonEquilibriumInitialResiduumCompensated())
+        {
+            auto& r_neq = NumLib::GlobalVectorProvider::provider.getVector(
+                *_process_solutions[i]);
+            readVector(checkpoint, group + "r_neq", r_neq);
+            ppd.nonlinear_solver.setNonEquilibriumInitialResiduum(r_neq);
+            NumLib::GlobalVectorProvider::provider.releaseVector(r_neq);
+        }
+    }
+
+    _output->readCheckpoint(checkpoint);
+
+    INFO("Restarted from the checkpoint '{:s}' at time {:g}.",
+         checkpoint.path().string(), _current_time);
 }
 
 bool TimeLoop::doNonlinearIteration(double const t, double const dt,
@@ -635,8 +824,7 @@ static NumLib::NonlinearSolverStatus solveMonolithicProcess(
     std::vector<GlobalVector*> const& x_prev, Output& output,
     std::size_t& xdot_id)
 {
-    BaseLib::RunTime time_timestep_process;
-    time_timestep_process.start();
+    BaseLib::ProfilerRegion time_timestep_process("solve_process");
 
     auto const nonlinear_solver_status = solveOneTimeStepOneProcess(
         x, x_prev, timestep_id, t, dt, process_data, output, xdot_id);
@@ -726,8 +914,7 @@ TimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
         for (auto& process_data : _per_process_data)
         {
             auto const process_id = process_data->process_id;
-            BaseLib::RunTime time_timestep_process;
-            time_timestep_process.start();
+            BaseLib::ProfilerRegion time_timestep_process("solve_process");
 
             // The following setting of coupled_solutions can be removed only if
             // the CoupledSolutionsForStaggeredScheme and related functions are
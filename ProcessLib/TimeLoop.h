@@ -12,8 +12,10 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include "NumLib/ODESolver/NonlinearSolver.h"
+#include "Checkpoint.h"
 #include "NumLib/TimeStepping/Algorithms/TimeStepAlgorithm.h"
 #include "Process.h"
 #include "ProcessLib/Output/Output.h"
@@ -41,9 +43,13 @@ public:
              const int global_coupling_max_iterations,
              std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>&&
                  global_coupling_conv_crit,
-             const double start_time, const double end_time);
+             const double start_time, const double end_time,
+             std::optional<CheckpointSettings> checkpoint_settings);
 
-    void initialize();
+    /// Sets up the time discretization and the initial conditions. If a
+    /// checkpoint is given, the time loop continues from the state stored
+    /// therein instead of the initial conditions.
+    void initialize(CheckpointFile const* const checkpoint = nullptr);
     void outputLastTimeStep() const;
 
     ~TimeLoop();
@@ -108,6 +114,15 @@ private:
                                                 std::size_t& accepted_steps,
                                                 std::size_t& rejected_steps);
 
+    /// Writes the state of the time loop, the solutions, and the integration
+    /// point data of the processes to the checkpoint file.
+    void writeCheckpoint() const;
+
+    /// Restores the state written by writeCheckpoint(). The integration point
+    /// data have been restored already before the processes were
+    /// initialized, cf. addIntegrationPointDataToMesh().
+    void readCheckpoint(CheckpointFile const& checkpoint);
+
     template <typename OutputClass, typename OutputClassMember>
     void outputSolutions(bool const output_initial_condition, unsigned timestep,
                          const double t, OutputClass& output_object,
@@ -128,6 +143,8 @@ private:
     int _repeating_times_of_rejected_step = 0;
     bool _last_step_rejected = false;
 
+    std::optional<CheckpointSettings> const _checkpoint_settings;
+
     /// Maximum iterations of the global coupling.
     const int _global_coupling_max_iterations;
     /// Convergence criteria of processes for the global coupling iterations.
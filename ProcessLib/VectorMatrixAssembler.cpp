@@ -10,15 +10,62 @@
 
 #include "VectorMatrixAssembler.h"
 
+#include <algorithm>
 #include <cassert>
+#include <exception>
 #include <functional>  // for std::reference_wrapper.
+#include <numeric>
+#include <span>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
+#include "BaseLib/Profiler.h"
 #include "CoupledSolutionsForStaggeredScheme.h"
 #include "LocalAssemblerInterface.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
-#include "NumLib/DOF/DOFTableUtil.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "Process.h"
 
+namespace
+{
+//! Number of mesh items per thread assembled before the local results are
+//! added to the global matrices and vectors.
+constexpr std::size_t items_per_thread_and_block = 256;
+
+//! Gathers the local solutions of all processes of the staggered scheme for
+//! the given mesh item. \c local_x is only reallocated if the number of local
+//! unknowns changes.
+void gatherCoupledLocalSolutions(
+    std::vector<GlobalVector*> const& global_solutions,
+    std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>> const&
+        dof_tables,
+    std::size_t const mesh_item_id, Eigen::VectorXd& local_x)
+{
+    std::size_t const number_of_processes = global_solutions.size();
+
+    Eigen::Index size = 0;
+    for (std::size_t process_id = 0; process_id < number_of_processes;
+         ++process_id)
+    {
+        size +=
+            dof_tables[process_id].get().getElementIndices(mesh_item_id).size();
+    }
+    local_x.resize(size);
+
+    Eigen::Index offset = 0;
+    for (std::size_t process_id = 0; process_id < number_of_processes;
+         ++process_id)
+    {
+        auto const indices =
+            dof_tables[process_id].get().getElementIndices(mesh_item_id);
+        global_solutions[process_id]->get(
+            indices, std::span<double>(local_x.data() + offset, indices.size()));
+        offset += indices.size();
+    }
+}
+}  // namespace
+
 namespace ProcessLib
 {
 VectorMatrixAssembler::VectorMatrixAssembler(
@@ -32,10 +79,52 @@ void VectorMatrixAssembler::preAssemble(
     const NumLib::LocalToGlobalIndexMap& dof_table, const double t,
     double const dt, const GlobalVector& x)
 {
-    auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
-    auto const local_x = x.get(indices);
+    auto const indices = dof_table.getElementIndices(mesh_item_id);
+    _local_x.resize(indices.size());
+    x.get(indices, _local_x);
 
-    local_assembler.preAssemble(t, dt, local_x);
+    local_assembler.preAssemble(t, dt, _local_x);
+}
+
+void VectorMatrixAssembler::setOptions(GlobalAssemblyOptions const& options)
+{
+    auto const number_of_threads = options.number_of_threads;
+    if (number_of_threads < 0)
+    {
+        OGS_FATAL(
+            "The number of assembly threads must not be negative, got {:d}.",
+            number_of_threads);
+    }
+#ifdef _OPENMP
+    _number_of_threads =
+        number_of_threads == 0 ? omp_get_max_threads() : number_of_threads;
+#else
+    if (number_of_threads != 1)
+    {
+        WARN(
+            "OGS has been built without OpenMP support. The global assembly "
+            "will run serially.");
+    }
+    _number_of_threads = 1;
+#endif
+    _thread_assemblers.clear();
+    if (_number_of_threads > 1)
+    {
+        INFO("Global assembly uses {:d} threads.", _number_of_threads);
+    }
+
+#ifdef USE_PETSC
+    if (options.use_element_coloring)
+    {
+        WARN(
+            "Element coloring is not supported with PETSc. The local "
+            "contributions will be added to the global matrices in the order "
+            "of the mesh items.");
+    }
+    _use_element_coloring = false;
+#else
+    _use_element_coloring = options.use_element_coloring;
+#endif
 }
 
 void VectorMatrixAssembler::assemble(
@@ -46,141 +135,437 @@ void VectorMatrixAssembler::assemble(
     std::vector<GlobalVector*> const& xdot, int const process_id,
     GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b)
 {
-    std::vector<std::vector<GlobalIndexType>> indices_of_processes;
-    indices_of_processes.reserve(dof_tables.size());
-    transform(cbegin(dof_tables), cend(dof_tables),
-              back_inserter(indices_of_processes),
-              [&](auto const& dof_table)
-              { return NumLib::getIndices(mesh_item_id, dof_table); });
+    assembleLocal(mesh_item_id, local_assembler, dof_tables, t, dt, x, xdot,
+                  process_id, false, _local_data);
+    addToGlobal(_local_data, scatterMap(process_id, mesh_item_id), M, K, b,
+                nullptr);
+}
 
-    auto const& indices = indices_of_processes[process_id];
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
+void VectorMatrixAssembler::assembleWithJacobian(
+    std::size_t const mesh_item_id, LocalAssemblerInterface& local_assembler,
+    std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>> const&
+        dof_tables,
+    const double t, double const dt, std::vector<GlobalVector*> const& x,
+    std::vector<GlobalVector*> const& xdot, int const process_id,
+    GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac)
+{
+    assembleLocal(mesh_item_id, local_assembler, dof_tables, t, dt, x, xdot,
+                  process_id, true, _local_data);
+    addToGlobal(_local_data, scatterMap(process_id, mesh_item_id), M, K, b,
+                &Jac);
+}
+
+void VectorMatrixAssembler::assembleLocal(
+    std::size_t const mesh_item_id, LocalAssemblerInterface& local_assembler,
+    std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>> const&
+        dof_tables,
+    double const t, double const dt, std::vector<GlobalVector*> const& x,
+    std::vector<GlobalVector*> const& xdot, int const process_id,
+    bool const with_jacobian, LocalAssemblyData& data)
+{
+    auto const indices =
+        dof_tables[process_id].get().getElementIndices(mesh_item_id);
+
+    data.M.clear();
+    data.K.clear();
+    data.b.clear();
+    data.Jac.clear();
 
     std::size_t const number_of_processes = x.size();
     // Monolithic scheme
     if (number_of_processes == 1)
     {
-        auto const local_x = x[process_id]->get(indices);
-        auto const local_xdot = xdot[process_id]->get(indices);
-        local_assembler.assemble(t, dt, local_x, local_xdot, _local_M_data,
-                                 _local_K_data, _local_b_data);
+        _local_x.resize(indices.size());
+        _local_xdot.resize(indices.size());
+        x[process_id]->get(indices, _local_x);
+        xdot[process_id]->get(indices, _local_xdot);
+        if (with_jacobian)
+        {
+            _jacobian_assembler->assembleWithJacobian(
+                local_assembler, t, dt, _local_x, _local_xdot, data.M, data.K,
+                data.b, data.Jac);
+        }
+        else
+        {
+            local_assembler.assemble(t, dt, _local_x, _local_xdot, data.M,
+                                     data.K, data.b);
+        }
     }
     else  // Staggered scheme
     {
-        auto local_coupled_xs =
-            getCoupledLocalSolutions(x, indices_of_processes);
-        auto const local_x = MathLib::toVector(local_coupled_xs);
+        gatherCoupledLocalSolutions(x, dof_tables, mesh_item_id,
+                                    _local_coupled_x);
+        gatherCoupledLocalSolutions(xdot, dof_tables, mesh_item_id,
+                                    _local_coupled_xdot);
 
-        auto local_coupled_xdots =
-            getCoupledLocalSolutions(xdot, indices_of_processes);
-        auto const local_xdot = MathLib::toVector(local_coupled_xdots);
+        if (with_jacobian)
+        {
+            _jacobian_assembler->assembleWithJacobianForStaggeredScheme(
+                local_assembler, t, dt, _local_coupled_x, _local_coupled_xdot,
+                process_id, data.M, data.K, data.b, data.Jac);
+        }
+        else
+        {
+            local_assembler.assembleForStaggeredScheme(
+                t, dt, _local_coupled_x, _local_coupled_xdot, process_id,
+                data.M, data.K, data.b);
+        }
+    }
+
+    data.indices.assign(indices.begin(), indices.end());
 
-        local_assembler.assembleForStaggeredScheme(
-            t, dt, local_x, local_xdot, process_id, _local_M_data,
-            _local_K_data, _local_b_data);
+    if (with_jacobian && data.Jac.empty())
+    {
+        OGS_FATAL(
+            "No Jacobian has been assembled! This might be due to programming "
+            "errors in the local assembler of the current process.");
     }
+}
 
+void VectorMatrixAssembler::addToGlobal(
+    LocalAssemblyData const& data, [[maybe_unused]] ScatterMap& scatter_map,
+    GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b, GlobalMatrix* Jac)
+{
+    auto const& indices = data.indices;
     auto const num_r_c = indices.size();
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty())
+    if (!data.M.empty())
     {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
+        auto const local_M = MathLib::toMatrix(data.M, num_r_c, num_r_c);
+#ifndef USE_PETSC
+        M.add(r_c_indices, local_M, scatter_map);
+#else
         M.add(r_c_indices, local_M);
+#endif
     }
-    if (!_local_K_data.empty())
+    if (!data.K.empty())
     {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
+        auto const local_K = MathLib::toMatrix(data.K, num_r_c, num_r_c);
+#ifndef USE_PETSC
+        K.add(r_c_indices, local_K, scatter_map);
+#else
         K.add(r_c_indices, local_K);
+#endif
+    }
+    if (!data.b.empty())
+    {
+        assert(data.b.size() == num_r_c);
+        b.add(indices, data.b);
     }
-    if (!_local_b_data.empty())
+    if (Jac != nullptr)
     {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
+        auto const local_Jac = MathLib::toMatrix(data.Jac, num_r_c, num_r_c);
+#ifndef USE_PETSC
+        Jac->add(r_c_indices, local_Jac, scatter_map);
+#else
+        Jac->add(r_c_indices, local_Jac);
+#endif
     }
 }
 
-void VectorMatrixAssembler::assembleWithJacobian(
-    std::size_t const mesh_item_id, LocalAssemblerInterface& local_assembler,
+VectorMatrixAssembler::ScatterMap& VectorMatrixAssembler::scatterMap(
+    int const process_id, std::size_t const mesh_item_id)
+{
+    auto& scatter_maps = scatterMaps(process_id, mesh_item_id + 1);
+    return scatter_maps[mesh_item_id];
+}
+
+std::vector<VectorMatrixAssembler::ScatterMap>&
+VectorMatrixAssembler::scatterMaps(int const process_id,
+                                   std::size_t const number_of_mesh_items)
+{
+    if (_scatter_maps.size() <= static_cast<std::size_t>(process_id))
+    {
+        _scatter_maps.resize(process_id + 1);
+    }
+    auto& scatter_maps = _scatter_maps[process_id];
+    if (scatter_maps.size() < number_of_mesh_items)
+    {
+        scatter_maps.resize(number_of_mesh_items);
+    }
+    return scatter_maps;
+}
+
+void VectorMatrixAssembler::createThreadAssemblers()
+{
+    if (!_thread_assemblers.empty())
+    {
+        return;
+    }
+
+    _thread_assemblers.reserve(_number_of_threads);
+    for (int i = 0; i < _number_of_threads; i++)
+    {
+        _thread_assemblers.push_back(std::make_unique<VectorMatrixAssembler>(
+            _jacobian_assembler->copy()));
+    }
+}
+
+void VectorMatrixAssembler::assembleSelected(
+    LocalAssemblerAccessor const& local_assembler,
+    std::size_t const number_of_local_assemblers,
+    std::vector<std::size_t> const& active_element_ids,
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>> const&
         dof_tables,
-    const double t, double const dt, std::vector<GlobalVector*> const& x,
+    double const t, double const dt, std::vector<GlobalVector*> const& x,
     std::vector<GlobalVector*> const& xdot, int const process_id,
-    GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac)
+    GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b, GlobalMatrix* Jac)
 {
-    std::vector<std::vector<GlobalIndexType>> indices_of_processes;
-    indices_of_processes.reserve(dof_tables.size());
-    transform(cbegin(dof_tables), cend(dof_tables),
-              back_inserter(indices_of_processes),
-              [&](auto const& dof_table)
-              { return NumLib::getIndices(mesh_item_id, dof_table); });
+    bool const all_elements_active = active_element_ids.empty();
+    std::size_t const number_of_items = all_elements_active
+                                            ? number_of_local_assemblers
+                                            : active_element_ids.size();
+    auto const item_id = [&](std::size_t const i)
+    { return all_elements_active ? i : active_element_ids[i]; };
+    // Sized in advance, such that the scatter maps of different mesh items
+    // can be accessed concurrently.
+    auto& scatter_maps = scatterMaps(process_id, number_of_local_assemblers);
+
+    if (_number_of_threads <= 1)
+    {
+        for (std::size_t i = 0; i < number_of_items; i++)
+        {
+            auto const id = item_id(i);
+            assembleLocal(id, local_assembler(id), dof_tables, t, dt, x, xdot,
+                          process_id, Jac != nullptr, _local_data);
+            addToGlobal(_local_data, scatter_maps[id], M, K, b, Jac);
+        }
+        return;
+    }
+
+#ifndef USE_PETSC
+    if (_use_element_coloring)
+    {
+        assembleSelectedColored(local_assembler, active_element_ids,
+                                scatter_maps, dof_tables, t, dt, x, xdot,
+                                process_id, M, K, b, Jac);
+        return;
+    }
+#endif
 
-    auto const& indices = indices_of_processes[process_id];
+    createThreadAssemblers();
 
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
-    _local_Jac_data.clear();
+    // The local assemblies of a block of mesh items run concurrently, the
+    // results are added to the global matrices and vectors afterwards in
+    // the order of the mesh items. The block size bounds the memory needed
+    // for the intermediate local results.
+    std::size_t const block_size =
+        items_per_thread_and_block * _thread_assemblers.size();
+    _block_data.resize(std::min(block_size, number_of_items));
 
-    std::size_t const number_of_processes = x.size();
-    // Monolithic scheme
-    if (number_of_processes == 1)
+    for (std::size_t block_begin = 0; block_begin < number_of_items;
+         block_begin += block_size)
     {
-        auto const local_x = x[process_id]->get(indices);
-        auto const local_xdot = xdot[process_id]->get(indices);
-        _jacobian_assembler->assembleWithJacobian(
-            local_assembler, t, dt, local_x, local_xdot, _local_M_data,
-            _local_K_data, _local_b_data, _local_Jac_data);
+        auto const block_end =
+            std::min(block_begin + block_size, number_of_items);
+        std::exception_ptr exception;
+        {
+            BaseLib::ProfilerRegion region("local_assembly");
+            auto const profiler_path = BaseLib::Profiler::currentPath();
+
+#pragma omp parallel num_threads(_number_of_threads)
+            {
+                BaseLib::ProfilerParentRegions const parents(profiler_path);
+
+                // The loop variable is signed as required by OpenMP 2.0
+                // (MSVC).
+#pragma omp for schedule(dynamic)
+                for (std::ptrdiff_t i =
+                         static_cast<std::ptrdiff_t>(block_begin);
+                     i < static_cast<std::ptrdiff_t>(block_end);
+                     i++)
+                {
+#ifdef _OPENMP
+                    auto& thread_assembler =
+                        *_thread_assemblers[omp_get_thread_num()];
+#else
+                    auto& thread_assembler = *_thread_assemblers.front();
+#endif
+                    auto const id = item_id(i);
+                    try
+                    {
+                        thread_assembler.assembleLocal(
+                            id, local_assembler(id), dof_tables, t, dt, x,
+                            xdot, process_id, Jac != nullptr,
+                            _block_data[i - block_begin]);
+                    }
+                    catch (...)
+                    {
+#pragma omp critical
+                        if (!exception)
+                        {
+                            exception = std::current_exception();
+                        }
+                    }
+                }
+            }
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+
+        BaseLib::ProfilerRegion region("global_scatter");
+        for (std::size_t i = block_begin; i < block_end; i++)
+        {
+            addToGlobal(_block_data[i - block_begin],
+                        scatter_maps[item_id(i)], M, K, b, Jac);
+        }
     }
-    else  // Staggered scheme
+}
+
+#ifndef USE_PETSC
+void VectorMatrixAssembler::assembleSelectedColored(
+    LocalAssemblerAccessor const& local_assembler,
+    std::vector<std::size_t> const& active_element_ids,
+    std::vector<ScatterMap>& scatter_maps,
+    std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>> const&
+        dof_tables,
+    double const t, double const dt, std::vector<GlobalVector*> const& x,
+    std::vector<GlobalVector*> const& xdot, int const process_id,
+    GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b, GlobalMatrix* Jac)
+{
+    createThreadAssemblers();
+
+    auto const& colors = dof_tables[process_id].get().getElementColors();
+
+    std::vector<bool> is_active;
+    if (!active_element_ids.empty())
+    {
+        std::size_t const number_of_items = std::accumulate(
+            colors.begin(), colors.end(), std::size_t{0},
+            [](std::size_t const n, auto const& color)
+            { return n + color.size(); });
+        is_active.resize(number_of_items, false);
+        for (auto const id : active_element_ids)
+        {
+            is_active[id] = true;
+        }
+    }
+
+    for (auto const& color : colors)
     {
-        auto local_coupled_xs =
-            getCoupledLocalSolutions(x, indices_of_processes);
-        auto const local_x = MathLib::toVector(local_coupled_xs);
+        auto const* items = &color;
+        if (!is_active.empty())
+        {
+            _color_items.clear();
+            std::copy_if(color.begin(), color.end(),
+                         back_inserter(_color_items),
+                         [&is_active](std::size_t const id)
+                         { return is_active[id]; });
+            items = &_color_items;
+        }
+        std::exception_ptr exception;
+        auto const profiler_path = BaseLib::Profiler::currentPath();
 
-        auto local_coupled_xdots =
-            getCoupledLocalSolutions(xdot, indices_of_processes);
-        auto const local_xdot = MathLib::toVector(local_coupled_xdots);
+#pragma omp parallel num_threads(_number_of_threads)
+        {
+            BaseLib::ProfilerParentRegions const parents(profiler_path);
 
-        _jacobian_assembler->assembleWithJacobianForStaggeredScheme(
-            local_assembler, t, dt, local_x, local_xdot, process_id,
-            _local_M_data, _local_K_data, _local_b_data, _local_Jac_data);
+            // The loop variable is signed as required by OpenMP 2.0 (MSVC).
+#pragma omp for schedule(dynamic)
+            for (std::ptrdiff_t i = 0;
+                 i < static_cast<std::ptrdiff_t>(items->size());
+                 i++)
+            {
+#ifdef _OPENMP
+                auto& thread_assembler =
+                    *_thread_assemblers[omp_get_thread_num()];
+#else
+                auto& thread_assembler = *_thread_assemblers.front();
+#endif
+                auto const id = (*items)[i];
+                try
+                {
+                    thread_assembler.assembleLocal(
+                        id, local_assembler(id), dof_tables, t, dt, x, xdot,
+                        process_id, Jac != nullptr,
+                        thread_assembler._local_data);
+                    thread_assembler.addToGlobalConcurrently(
+                        thread_assembler._local_data, scatter_maps[id], M, K,
+                        b, Jac);
+                }
+                catch (...)
+                {
+#pragma omp critical
+                    if (!exception)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+
+        // Entries missing in the sparsity patterns can only be inserted
+        // serially, because the insertion might reallocate the whole matrix.
+        for (auto& thread_assembler : _thread_assemblers)
+        {
+            thread_assembler->addMissingEntries(M, K, Jac);
+        }
     }
+}
 
+void VectorMatrixAssembler::addToGlobalConcurrently(
+    LocalAssemblyData const& data, ScatterMap& scatter_map, GlobalMatrix& M,
+    GlobalMatrix& K, GlobalVector& b, GlobalMatrix* Jac)
+{
+    auto const& indices = data.indices;
     auto const num_r_c = indices.size();
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty())
+    if (!data.M.empty())
     {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-        M.add(r_c_indices, local_M);
+        auto const local_M = MathLib::toMatrix(data.M, num_r_c, num_r_c);
+        M.addToExistingEntries(r_c_indices, local_M, scatter_map,
+                               _missing_entries.M);
     }
-    if (!_local_K_data.empty())
+    if (!data.K.empty())
     {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-        K.add(r_c_indices, local_K);
+        auto const local_K = MathLib::toMatrix(data.K, num_r_c, num_r_c);
+        K.addToExistingEntries(r_c_indices, local_K, scatter_map,
+                               _missing_entries.K);
     }
-    if (!_local_b_data.empty())
+    if (!data.b.empty())
     {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
+        assert(data.b.size() == num_r_c);
+        b.add(indices, data.b);
     }
-    if (!_local_Jac_data.empty())
+    if (Jac != nullptr)
     {
-        auto const local_Jac =
-            MathLib::toMatrix(_local_Jac_data, num_r_c, num_r_c);
-        Jac.add(r_c_indices, local_Jac);
+        auto const local_Jac = MathLib::toMatrix(data.Jac, num_r_c, num_r_c);
+        Jac->addToExistingEntries(r_c_indices, local_Jac, scatter_map,
+                                  _missing_entries.Jac);
     }
-    else
+}
+
+void VectorMatrixAssembler::addMissingEntries(GlobalMatrix& M, GlobalMatrix& K,
+                                              GlobalMatrix* Jac)
+{
+    auto const add_entries = [](MatrixEntries& entries, GlobalMatrix& matrix)
     {
-        OGS_FATAL(
-            "No Jacobian has been assembled! This might be due to programming "
-            "errors in the local assembler of the current process.");
+        for (auto const& entry : entries)
+        {
+            matrix.add(entry.row(), entry.col(), entry.value());
+        }
+        entries.clear();
+    };
+
+    add_entries(_missing_entries.M, M);
+    add_entries(_missing_entries.K, K);
+    if (Jac != nullptr)
+    {
+        add_entries(_missing_entries.Jac, *Jac);
     }
 }
+#endif
 
 }  // namespace ProcessLib
@@ -10,10 +10,13 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <vector>
-#include "NumLib/NumericsConfig.h"
+
 #include "AbstractJacobianAssembler.h"
 #include "CoupledSolutionsForStaggeredScheme.h"
+#include "NumLib/NumericsConfig.h"
 
 namespace NumLib
 {
@@ -26,16 +29,66 @@ struct CoupledSolutionsForStaggeredScheme;
 
 class LocalAssemblerInterface;
 
+//! Local matrices and vectors of a single mesh item together with the global
+//! indices they will be added to.
+struct LocalAssemblyData
+{
+    std::vector<GlobalIndexType> indices;
+    std::vector<double> M;
+    std::vector<double> K;
+    std::vector<double> b;
+    std::vector<double> Jac;
+};
+
+//! Settings of the global assembly loops of the VectorMatrixAssembler.
+struct GlobalAssemblyOptions
+{
+    //! Number of threads. One selects the serial assembly, zero the default
+    //! number of threads of the OpenMP runtime.
+    int number_of_threads = 1;
+
+    //! If set, the local matrices and vectors of all mesh items of one color,
+    //! see NumLib::LocalToGlobalIndexMap::getElementColors(), are added to the
+    //! global ones concurrently.
+    bool use_element_coloring = false;
+};
+
 //! Utility class used to assemble global matrices and vectors.
 //!
 //! The methods of this class get the global matrices and vectors as input and
 //! pass only local data on to the local assemblers.
+//!
+//! The global assembly loops, i.e., the assemble() and assembleWithJacobian()
+//! overloads taking the whole collection of local assemblers, run the local
+//! assemblies on several threads if more than one thread has been requested
+//! via setOptions(). The local matrices and vectors are then added to the
+//! global ones in the order of the mesh items, so the results are bitwise
+//! identical to the serial assembly independent of the number of threads.
+//!
+//! With element coloring the mesh items are processed color by color instead
+//! and the local contributions are added to the global matrices and vectors
+//! right away on each thread. Since mesh items of the same color do not share
+//! any global index, no two threads write to the same matrix row. The results
+//! do not depend on the number of threads, but differ from the serial
+//! assembly by round-off because of the different summation order.
 class VectorMatrixAssembler final
 {
+#ifndef USE_PETSC
+    using ScatterMap = GlobalMatrix::ScatterMap;
+#else
+    //! Unused; PETSc matrices take care of the entry locations themselves.
+    struct ScatterMap
+    {
+    };
+#endif
+
 public:
     explicit VectorMatrixAssembler(
         std::unique_ptr<AbstractJacobianAssembler>&& jacobian_assembler);
 
+    //! Sets the threading of the global assembly loops.
+    void setOptions(GlobalAssemblyOptions const& options);
+
     void preAssemble(const std::size_t mesh_item_id,
                      LocalAssemblerInterface& local_assembler,
                      const NumLib::LocalToGlobalIndexMap& dof_table,
@@ -52,6 +105,26 @@ public:
                   std::vector<GlobalVector*> const& xdot, int const process_id,
                   GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b);
 
+    //! Assembles \c M, \c K, and \c b for all \c local_assemblers whose ids
+    //! are given in \c active_element_ids, or for all of them if
+    //! \c active_element_ids is empty.
+    template <typename LocalAssemblers>
+    void assemble(LocalAssemblers const& local_assemblers,
+                  std::vector<std::size_t> const& active_element_ids,
+                  std::vector<std::reference_wrapper<
+                      NumLib::LocalToGlobalIndexMap>> const& dof_tables,
+                  double const t, double const dt,
+                  std::vector<GlobalVector*> const& x,
+                  std::vector<GlobalVector*> const& xdot, int const process_id,
+                  GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b)
+    {
+        assembleSelected(
+            [&local_assemblers](std::size_t const id)
+                -> LocalAssemblerInterface& { return *local_assemblers[id]; },
+            local_assemblers.size(), active_element_ids, dof_tables, t, dt, x,
+            xdot, process_id, M, K, b, nullptr);
+    }
+
     //! Assembles \c M, \c K, \c b, and the Jacobian \c Jac of the residual.
     //! \note The Jacobian must be assembled.
     void assembleWithJacobian(
@@ -64,16 +137,152 @@ public:
         std::vector<GlobalVector*> const& xdot, int const process_id,
         GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac);
 
+    //! Assembles \c M, \c K, \c b, and the Jacobian \c Jac for all
+    //! \c local_assemblers whose ids are given in \c active_element_ids, or
+    //! for all of them if \c active_element_ids is empty.
+    template <typename LocalAssemblers>
+    void assembleWithJacobian(
+        LocalAssemblers const& local_assemblers,
+        std::vector<std::size_t> const& active_element_ids,
+        std::vector<
+            std::reference_wrapper<NumLib::LocalToGlobalIndexMap>> const&
+            dof_tables,
+        const double t, double const dt, std::vector<GlobalVector*> const& x,
+        std::vector<GlobalVector*> const& xdot, int const process_id,
+        GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac)
+    {
+        assembleSelected(
+            [&local_assemblers](std::size_t const id)
+                -> LocalAssemblerInterface& { return *local_assemblers[id]; },
+            local_assemblers.size(), active_element_ids, dof_tables, t, dt, x,
+            xdot, process_id, M, K, b, &Jac);
+    }
+
 private:
+    using LocalAssemblerAccessor =
+        std::function<LocalAssemblerInterface&(std::size_t const)>;
+
+    //! Common implementation of the global assembly loops. The Jacobian is
+    //! assembled iff \c Jac is not a nullptr.
+    void assembleSelected(
+        LocalAssemblerAccessor const& local_assembler,
+        std::size_t const number_of_local_assemblers,
+        std::vector<std::size_t> const& active_element_ids,
+        std::vector<
+            std::reference_wrapper<NumLib::LocalToGlobalIndexMap>> const&
+            dof_tables,
+        double const t, double const dt, std::vector<GlobalVector*> const& x,
+        std::vector<GlobalVector*> const& xdot, int const process_id,
+        GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b, GlobalMatrix* Jac);
+
+    //! Runs the local assembly of a single mesh item and stores the results
+    //! in \c data. Global matrices and vectors are not touched, thus this
+    //! method can be called concurrently on different instances.
+    void assembleLocal(
+        std::size_t const mesh_item_id,
+        LocalAssemblerInterface& local_assembler,
+        std::vector<
+            std::reference_wrapper<NumLib::LocalToGlobalIndexMap>> const&
+            dof_tables,
+        double const t, double const dt, std::vector<GlobalVector*> const& x,
+        std::vector<GlobalVector*> const& xdot, int const process_id,
+        bool const with_jacobian, LocalAssemblyData& data);
+
+    //! Creates the per-thread assemblers if not done yet.
+    void createThreadAssemblers();
+
+#ifndef USE_PETSC
+    //! Parallel assembly adding the local matrices and vectors of the mesh
+    //! items of each color concurrently to the global ones.
+    void assembleSelectedColored(
+        LocalAssemblerAccessor const& local_assembler,
+        std::vector<std::size_t> const& active_element_ids,
+        std::vector<ScatterMap>& scatter_maps,
+        std::vector<
+            std::reference_wrapper<NumLib::LocalToGlobalIndexMap>> const&
+            dof_tables,
+        double const t, double const dt, std::vector<GlobalVector*> const& x,
+        std::vector<GlobalVector*> const& xdot, int const process_id,
+        GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b, GlobalMatrix* Jac);
+
+    //! Adds the local matrices and vectors to the global ones without
+    //! changing the sparsity patterns of the global matrices. Matrix entries
+    //! not yet contained in the patterns are collected in
+    //! \c _missing_entries. Can be called concurrently for mesh items not
+    //! sharing global indices.
+    void addToGlobalConcurrently(LocalAssemblyData const& data,
+                                 ScatterMap& scatter_map, GlobalMatrix& M,
+                                 GlobalMatrix& K, GlobalVector& b,
+                                 GlobalMatrix* Jac);
+
+    //! Inserts the entries collected by addToGlobalConcurrently() into the
+    //! global matrices.
+    void addMissingEntries(GlobalMatrix& M, GlobalMatrix& K, GlobalMatrix* Jac);
+#endif
+
+    //! Adds the local matrices and vectors to the global ones. The locations
+    //! of the matrix entries are cached in the \c scatter_map of the mesh
+    //! item; the scatter map is shared by all global matrices, since they
+    //! usually have the same sparsity pattern.
+    static void addToGlobal(LocalAssemblyData const& data,
+                            ScatterMap& scatter_map, GlobalMatrix& M,
+                            GlobalMatrix& K, GlobalVector& b,
+                            GlobalMatrix* Jac);
+
+    //! Returns the scatter map of a single mesh item of the given process.
+    ScatterMap& scatterMap(int const process_id,
+                           std::size_t const mesh_item_id);
+
+    //! Returns the scatter maps of the given process, with at least
+    //! \c number_of_mesh_items entries.
+    std::vector<ScatterMap>& scatterMaps(
+        int const process_id, std::size_t const number_of_mesh_items);
+
     // temporary data only stored here in order to avoid frequent memory
     // reallocations.
-    std::vector<double> _local_M_data;
-    std::vector<double> _local_K_data;
-    std::vector<double> _local_b_data;
-    std::vector<double> _local_Jac_data;
+    LocalAssemblyData _local_data;
+    std::vector<double> _local_x;
+    std::vector<double> _local_xdot;
+    Eigen::VectorXd _local_coupled_x;
+    Eigen::VectorXd _local_coupled_xdot;
 
     //! Used to assemble the Jacobian.
     std::unique_ptr<AbstractJacobianAssembler> _jacobian_assembler;
+
+    //! Number of threads of the global assembly loops.
+    int _number_of_threads = 1;
+
+    //! \see GlobalAssemblyOptions::use_element_coloring
+    bool _use_element_coloring = false;
+
+    //! One assembler per thread, each with its own scratch buffers and
+    //! Jacobian assembler. Created on first use of the parallel assembly.
+    std::vector<std::unique_ptr<VectorMatrixAssembler>> _thread_assemblers;
+
+    //! Local results of one block of mesh items in the parallel assembly. The
+    //! buffers are kept between calls to avoid reallocations.
+    std::vector<LocalAssemblyData> _block_data;
+
+    //! Cached locations of the local matrix entries in the global matrices
+    //! for each process and mesh item.
+    std::vector<std::vector<ScatterMap>> _scatter_maps;
+
+#ifndef USE_PETSC
+    using MatrixEntries =
+        std::vector<Eigen::Triplet<double, GlobalMatrix::IndexType>>;
+
+    //! Matrix entries which are not yet contained in the sparsity patterns of
+    //! the global matrices, found by addToGlobalConcurrently().
+    struct
+    {
+        MatrixEntries M;
+        MatrixEntries K;
+        MatrixEntries Jac;
+    } _missing_entries;
+
+    //! Active mesh items of the current color in the colored assembly.
+    std::vector<std::size_t> _color_items;
+#endif
 };
 
 }  // namespace ProcessLib
@@ -0,0 +1,57 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "Applications/Utils/ModelPreparation/PartitionMesh/Metis.h"
+#include "MeshLib/Elements/Hex.h"
+#include "MeshLib/Elements/Tet.h"
+#include "MeshLib/Node.h"
+
+// A hex20 and a tet4 element sharing three base nodes, with 4 DOFs per base
+// node and 3 DOFs per higher order node, like a Taylor-Hood discretization
+// with the pressure on the base nodes only.
+TEST(ApplicationUtils, ComputeNodeWeightsMixedHex20Tet4)
+{
+    std::vector<std::unique_ptr<MeshLib::Node>> nodes;
+    for (std::size_t i = 0; i < 21; ++i)
+    {
+        nodes.push_back(std::make_unique<MeshLib::Node>(
+            static_cast<double>(i), 0.0, 0.0, i));
+    }
+
+    std::array<MeshLib::Node*, 20> hex_nodes{};
+    for (std::size_t i = 0; i < hex_nodes.size(); ++i)
+    {
+        hex_nodes[i] = nodes[i].get();
+    }
+    MeshLib::Hex20 hex(hex_nodes);
+    MeshLib::Tet tet(std::array<MeshLib::Node*, 4>{
+        nodes[0].get(), nodes[1].get(), nodes[2].get(), nodes[20].get()});
+
+    auto const weights =
+        ApplicationUtils::computeNodeWeights({&hex, &tet}, nodes.size(), 4, 3);
+    ASSERT_EQ(nodes.size(), weights.size());
+
+    // The hex20 has 8 * 4 + 12 * 3 = 68 DOFs, i.e. ceil(68^2 / 20) = 232 per
+    // node; the tet4 has 4 * 4 = 16 DOFs, i.e. 16^2 / 4 = 64 per node.
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(232 + 64, weights[i]) << "node " << i;
+    }
+    for (std::size_t i = 3; i < 20; ++i)
+    {
+        EXPECT_EQ(232, weights[i]) << "node " << i;
+    }
+    EXPECT_EQ(64, weights[20]);
+}
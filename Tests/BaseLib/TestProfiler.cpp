@@ -0,0 +1,147 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#include "BaseLib/Profiler.h"
+
+namespace
+{
+void nestedRegions(int const repetitions)
+{
+    BaseLib::ProfilerRegion outer("outer");
+    for (int i = 0; i < repetitions; ++i)
+    {
+        BaseLib::ProfilerRegion inner("inner");
+        BaseLib::Profiler::count("inner_calls");
+    }
+}
+
+std::string readFile(std::filesystem::path const& path)
+{
+    std::ifstream in(path);
+    return {std::istreambuf_iterator<char>(in),
+            std::istreambuf_iterator<char>()};
+}
+}  // namespace
+
+TEST(BaseLibProfiler, DisabledProfilerRecordsNothing)
+{
+    BaseLib::Profiler::reset();
+    nestedRegions(3);
+    EXPECT_TRUE(BaseLib::Profiler::statistics().empty());
+}
+
+TEST(BaseLibProfiler, NestedRegionsAreAggregatedPerPath)
+{
+    BaseLib::Profiler::reset();
+    BaseLib::Profiler::enable(false);
+
+    nestedRegions(3);
+    nestedRegions(2);
+    {
+        // Same name on a different path.
+        BaseLib::ProfilerRegion inner("inner");
+    }
+
+    auto const statistics = BaseLib::Profiler::statistics();
+    ASSERT_EQ(3u, statistics.size());
+    EXPECT_EQ("inner", statistics[0].path);
+    EXPECT_EQ(1u, statistics[0].count);
+    EXPECT_EQ("outer", statistics[1].path);
+    EXPECT_EQ(2u, statistics[1].count);
+    EXPECT_EQ("outer/inner", statistics[2].path);
+    EXPECT_EQ(5u, statistics[2].count);
+
+    EXPECT_LE(statistics[2].total, statistics[1].total);
+    EXPECT_LE(statistics[2].min, statistics[2].max);
+
+    BaseLib::Profiler::reset();
+}
+
+TEST(BaseLibProfiler, ThreadsAreMerged)
+{
+    BaseLib::Profiler::reset();
+    BaseLib::Profiler::enable(false);
+
+    std::thread t0([] { nestedRegions(1); });
+    std::thread t1([] { nestedRegions(2); });
+    t0.join();
+    t1.join();
+
+    auto const statistics = BaseLib::Profiler::statistics();
+    ASSERT_EQ(2u, statistics.size());
+    EXPECT_EQ(2u, statistics[0].count);
+    EXPECT_EQ(3u, statistics[1].count);
+
+    BaseLib::Profiler::reset();
+}
+
+TEST(BaseLibProfiler, WorkerThreadsContinueParentPath)
+{
+    BaseLib::Profiler::reset();
+    BaseLib::Profiler::enable(false);
+
+    {
+        BaseLib::ProfilerRegion outer("outer");
+        auto const path = BaseLib::Profiler::currentPath();
+        std::thread worker(
+            [&path]
+            {
+                BaseLib::ProfilerParentRegions const parents(path);
+                BaseLib::ProfilerRegion inner("inner");
+            });
+        worker.join();
+    }
+
+    // The path is not measured again by the worker thread.
+    auto const statistics = BaseLib::Profiler::statistics();
+    ASSERT_EQ(2u, statistics.size());
+    EXPECT_EQ("outer", statistics[0].path);
+    EXPECT_EQ(1u, statistics[0].count);
+    EXPECT_EQ("outer/inner", statistics[1].path);
+    EXPECT_EQ(1u, statistics[1].count);
+
+    BaseLib::Profiler::reset();
+}
+
+TEST(BaseLibProfiler, WritesSummaryAndTimeline)
+{
+    BaseLib::Profiler::reset();
+    BaseLib::Profiler::enable(true);
+    nestedRegions(2);
+
+    auto const prefix =
+        (std::filesystem::temp_directory_path() / "ogs_profiler_test").string();
+    BaseLib::Profiler::write(prefix);
+
+    auto const json = readFile(prefix + ".json");
+    EXPECT_NE(std::string::npos, json.find("\"path\": \"outer/inner\""));
+    EXPECT_NE(std::string::npos, json.find("\"inner_calls\": 2"));
+
+    auto const csv = readFile(prefix + ".csv");
+    EXPECT_NE(std::string::npos, csv.find("\"outer/inner\",2,"));
+
+    auto const trace = readFile(prefix + "_trace.json");
+    EXPECT_NE(std::string::npos, trace.find("\"traceEvents\""));
+    EXPECT_NE(std::string::npos, trace.find("\"cat\": \"outer/inner\""));
+
+    for (auto const* suffix : {".json", ".csv", "_trace.json"})
+    {
+        std::filesystem::remove(prefix + suffix);
+    }
+    BaseLib::Profiler::reset();
+}
@@ -0,0 +1,149 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "MaterialLib/MPL/Medium.h"
+#include "MaterialLib/MPL/Phase.h"
+#include "MaterialLib/MPL/Properties/Constant.h"
+#include "MaterialLib/MPL/Properties/Linear.h"
+#include "MaterialLib/MPL/PropertyHandle.h"
+
+namespace MPL = MaterialPropertyLib;
+
+namespace
+{
+// A medium like in the liquid flow process with a pressure dependent density
+// and constant other properties.
+std::unique_ptr<MPL::Medium> createMedium()
+{
+    auto liquid_properties = std::make_unique<MPL::PropertyArray>();
+    (*liquid_properties)[MPL::PropertyType::density] =
+        std::make_unique<MPL::Linear>(
+            "density", 1000.,
+            std::vector{MPL::IndependentVariable{
+                MPL::Variable::phase_pressure, 1e5, 4.5e-7}});
+    (*liquid_properties)[MPL::PropertyType::viscosity] =
+        std::make_unique<MPL::Constant>("viscosity", 1e-3);
+
+    std::vector<std::unique_ptr<MPL::Phase>> phases;
+    phases.push_back(std::make_unique<MPL::Phase>(
+        "AqueousLiquid", std::vector<std::unique_ptr<MPL::Component>>{},
+        std::move(liquid_properties)));
+
+    auto medium_properties = std::make_unique<MPL::PropertyArray>();
+    (*medium_properties)[MPL::PropertyType::reference_temperature] =
+        std::make_unique<MPL::Constant>("reference_temperature", 293.15);
+    (*medium_properties)[MPL::PropertyType::porosity] =
+        std::make_unique<MPL::Constant>("porosity", 0.2);
+    (*medium_properties)[MPL::PropertyType::storage] =
+        std::make_unique<MPL::Constant>("storage", 1e-10);
+
+    return std::make_unique<MPL::Medium>(0, std::move(phases),
+                                         std::move(medium_properties));
+}
+
+// Number of integration points of a hexahedral mesh with 16^3 elements and
+// eight integration points per element.
+constexpr int number_of_integration_points = 16 * 16 * 16 * 8;
+
+// Evaluates the properties like the liquid flow assembly, looking the
+// properties up in the medium for each element.
+void PropertyLookupPerElement(benchmark::State& state)
+{
+    auto const medium = createMedium();
+    ParameterLib::SpatialPosition const pos;
+    double const t = 0;
+    double const dt = 1;
+
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (int e = 0; e < number_of_integration_points / 8; e++)
+        {
+            auto const& liquid_phase = medium->phase("AqueousLiquid");
+            MPL::VariableArray vars;
+            vars[static_cast<int>(MPL::Variable::temperature)] =
+                (*medium)[MPL::PropertyType::reference_temperature]
+                    .template value<double>(vars, pos, t, dt);
+            for (int ip = 0; ip < 8; ip++)
+            {
+                vars[static_cast<int>(MPL::Variable::phase_pressure)] =
+                    1e5 + ip;
+                sum += liquid_phase[MPL::PropertyType::density]
+                           .template value<double>(vars, pos, t, dt);
+                sum += liquid_phase[MPL::PropertyType::density]
+                           .template dValue<double>(
+                               vars, MPL::Variable::phase_pressure, pos, t, dt);
+                sum += (*medium)[MPL::PropertyType::porosity]
+                           .template value<double>(vars, pos, t, dt);
+                sum += (*medium)[MPL::PropertyType::storage]
+                           .template value<double>(vars, pos, t, dt);
+                sum += liquid_phase[MPL::PropertyType::viscosity]
+                           .template value<double>(vars, pos, t, dt);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * number_of_integration_points);
+}
+
+// Evaluates the same properties through property handles, which are created
+// once like in the constructor of the liquid flow local assembler.
+void PropertyHandles(benchmark::State& state)
+{
+    auto const medium = createMedium();
+    auto const& liquid_phase = medium->phase("AqueousLiquid");
+    MPL::PropertyHandle<double> const reference_temperature(
+        (*medium)[MPL::PropertyType::reference_temperature]);
+    MPL::PropertyHandle<double> const density(
+        liquid_phase[MPL::PropertyType::density]);
+    MPL::PropertyHandle<double> const porosity(
+        (*medium)[MPL::PropertyType::porosity]);
+    MPL::PropertyHandle<double> const storage(
+        (*medium)[MPL::PropertyType::storage]);
+    MPL::PropertyHandle<double> const viscosity(
+        liquid_phase[MPL::PropertyType::viscosity]);
+
+    ParameterLib::SpatialPosition const pos;
+    double const t = 0;
+    double const dt = 1;
+
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (int e = 0; e < number_of_integration_points / 8; e++)
+        {
+            MPL::VariableArray vars;
+            vars[static_cast<int>(MPL::Variable::temperature)] =
+                reference_temperature.value(vars, pos, t, dt);
+            for (int ip = 0; ip < 8; ip++)
+            {
+                vars[static_cast<int>(MPL::Variable::phase_pressure)] =
+                    1e5 + ip;
+                sum += density.value(vars, pos, t, dt);
+                sum += density.dValue(vars, MPL::Variable::phase_pressure, pos,
+                                      t, dt);
+                sum += porosity.value(vars, pos, t, dt);
+                sum += storage.value(vars, pos, t, dt);
+                sum += viscosity.value(vars, pos, t, dt);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * number_of_integration_points);
+}
+}  // namespace
+
+BENCHMARK(PropertyLookupPerElement);
+BENCHMARK(PropertyHandles);
@@ -0,0 +1,80 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "MathLib/LinAlg/Eigen/EigenMatrix.h"
+#include "MathLib/LinAlg/Eigen/EigenTools.h"
+#include "MathLib/LinAlg/Eigen/EigenVector.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+using IndexType = MathLib::EigenMatrix::IndexType;
+
+// Dirichlet conditions on the bottom and the left faces of a hexahedral mesh
+// with n^3 elements and one unknown per node.
+void ApplyKnownSolution(benchmark::State& state)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh{
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, state.range(0))};
+    auto const n_nodes = static_cast<IndexType>(mesh->getNumberOfNodes());
+
+    MathLib::EigenMatrix A(n_nodes, 27);
+    Eigen::MatrixXd const local_matrix =
+        Eigen::MatrixXd::Constant(8, 8, -1.0) +
+        9.0 * Eigen::MatrixXd::Identity(8, 8);
+    for (auto const* element : mesh->getElements())
+    {
+        std::vector<IndexType> indices;
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+        {
+            indices.push_back(MeshLib::getNodeIndex(*element, i));
+        }
+        A.add(indices, local_matrix);
+    }
+    A.getRawMatrix().makeCompressed();
+
+    MathLib::EigenVector b(n_nodes);
+    MathLib::EigenVector x(n_nodes);
+    b.setZero();
+    x.setZero();
+
+    std::vector<IndexType> known_ids;
+    std::vector<double> known_values;
+    for (auto const* node : mesh->getNodes())
+    {
+        if ((*node)[0] == 0.0 || (*node)[2] == 0.0)
+        {
+            known_ids.push_back(node->getID());
+            known_values.push_back((*node)[1]);
+        }
+    }
+
+    // The elimination touches the same entries in every iteration, so the
+    // matrix is not restored between the iterations.
+    for (auto _ : state)
+    {
+        MathLib::applyKnownSolution(A, b, x, known_ids, known_values);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * known_ids.size());
+}
+}  // namespace
+
+// Argument: number of elements per direction.
+BENCHMARK(ApplyKnownSolution)->Arg(16)->Arg(48)->Unit(benchmark::kMillisecond);
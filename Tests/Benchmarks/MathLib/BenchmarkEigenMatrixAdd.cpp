@@ -0,0 +1,122 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Core>
+#include <array>
+#include <vector>
+
+#include "MathLib/LinAlg/Eigen/EigenMatrix.h"
+
+namespace
+{
+using IndexType = MathLib::EigenMatrix::IndexType;
+using RowColumnIndices = MathLib::RowColumnIndices<IndexType>;
+
+// Global indices of the local matrices of a structured hexahedral mesh with n^3
+// elements, eight nodes per element, and the given number of components per
+// node ordered by location.
+std::vector<std::vector<IndexType>> hexMeshIndices(
+    int const n, int const components)
+{
+    std::vector<std::vector<IndexType>> indices;
+    auto const node = [n](int const i, int const j, int const k)
+    { return (k * (n + 1) + j) * (n + 1) + i; };
+    for (int k = 0; k < n; ++k)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            for (int i = 0; i < n; ++i)
+            {
+                std::array const nodes{node(i, j, k),
+                                       node(i + 1, j, k),
+                                       node(i + 1, j + 1, k),
+                                       node(i, j + 1, k),
+                                       node(i, j, k + 1),
+                                       node(i + 1, j, k + 1),
+                                       node(i + 1, j + 1, k + 1),
+                                       node(i, j + 1, k + 1)};
+                auto& element_indices = indices.emplace_back();
+                for (int c = 0; c < components; ++c)
+                {
+                    for (auto const node_id : nodes)
+                    {
+                        element_indices.push_back(node_id * components + c);
+                    }
+                }
+            }
+        }
+    }
+    return indices;
+}
+
+struct Fixture
+{
+    Fixture(int const n, int const components)
+        : indices(hexMeshIndices(n, components)),
+          local_matrix(
+              Eigen::MatrixXd::Random(8 * components, 8 * components)),
+          matrix((n + 1) * (n + 1) * (n + 1) * components, 27 * components)
+    {
+        // The first assembly creates the sparsity pattern; afterwards the
+        // matrix is compressed as done by the linear solvers.
+        for (auto const& element_indices : indices)
+        {
+            matrix.add(element_indices, local_matrix);
+        }
+        matrix.getRawMatrix().makeCompressed();
+    }
+
+    std::vector<std::vector<IndexType>> indices;
+    Eigen::MatrixXd local_matrix;
+    MathLib::EigenMatrix matrix;
+};
+
+void EigenMatrixAdd(benchmark::State& state)
+{
+    Fixture f(state.range(0), state.range(1));
+
+    for (auto _ : state)
+    {
+        f.matrix.setZero();
+        for (auto const& element_indices : f.indices)
+        {
+            f.matrix.add(RowColumnIndices(element_indices, element_indices),
+                         f.local_matrix);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * f.indices.size());
+}
+
+void EigenMatrixAddWithScatterMap(benchmark::State& state)
+{
+    Fixture f(state.range(0), state.range(1));
+    std::vector<MathLib::EigenMatrix::ScatterMap> scatter_maps(
+        f.indices.size());
+
+    for (auto _ : state)
+    {
+        f.matrix.setZero();
+        for (std::size_t e = 0; e < f.indices.size(); ++e)
+        {
+            f.matrix.add(RowColumnIndices(f.indices[e], f.indices[e]),
+                         f.local_matrix, scatter_maps[e]);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * f.indices.size());
+}
+}  // namespace
+
+// Arguments: number of elements per direction, number of components per node.
+BENCHMARK(EigenMatrixAdd)->Args({20, 1})->Args({20, 3});
+BENCHMARK(EigenMatrixAddWithScatterMap)->Args({20, 1})->Args({20, 3});
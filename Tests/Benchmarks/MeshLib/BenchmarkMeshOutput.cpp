@@ -0,0 +1,109 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <memory>
+#include <numeric>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "BaseLib/StringTools.h"
+#include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "MeshLib/IO/XDMF/XdmfHdfWriter.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+
+namespace
+{
+// Hexahedral mesh with n^3 elements and a scalar and a vectorial nodal field,
+// like the output of a hydro-mechanical process.
+std::unique_ptr<MeshLib::Mesh> createMeshWithFields(int const n)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh{
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, n)};
+    auto const n_nodes = mesh->getNumberOfNodes();
+
+    auto& pressure = *MeshLib::getOrCreateMeshProperty<double>(
+        *mesh, "pressure", MeshLib::MeshItemType::Node, 1);
+    std::iota(pressure.begin(), pressure.end(), 0.0);
+
+    auto& displacement = *MeshLib::getOrCreateMeshProperty<double>(
+        *mesh, "displacement", MeshLib::MeshItemType::Node, 3);
+    std::iota(displacement.begin(), displacement.end(), -3.0 * n_nodes);
+    return mesh;
+}
+
+struct TemporaryDirectory
+{
+    TemporaryDirectory()
+        : path(std::filesystem::temp_directory_path() /
+               BaseLib::randomString(32))
+    {
+        std::filesystem::create_directories(path);
+    }
+    ~TemporaryDirectory() { std::filesystem::remove_all(path); }
+
+    std::filesystem::path const path;
+};
+
+void VtuInterfaceWriteToFile(benchmark::State& state)
+{
+    auto const mesh = createMeshWithFields(state.range(0));
+    bool const compressed = state.range(1) != 0;
+    TemporaryDirectory const directory;
+    auto const file = directory.path / "mesh.vtu";
+
+    for (auto _ : state)
+    {
+        MeshLib::IO::VtuInterface writer(mesh.get(), vtkXMLWriter::Appended,
+                                         compressed);
+        benchmark::DoNotOptimize(writer.writeToFile(file));
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->getNumberOfNodes());
+    state.SetBytesProcessed(state.iterations() *
+                            std::filesystem::file_size(file));
+}
+
+// Writing of the time dependent fields of one time step; the geometry and
+// topology are written once by the constructor.
+void HdfWriterWriteStep(benchmark::State& state)
+{
+    auto const mesh = createMeshWithFields(state.range(0));
+    bool const compressed = state.range(1) != 0;
+    TemporaryDirectory const directory;
+
+    std::set<std::string> const variable_output_names{"pressure",
+                                                      "displacement"};
+    MeshLib::IO::XdmfHdfWriter writer({*mesh}, directory.path / "mesh.xdmf",
+                                      0, 0.0, variable_output_names,
+                                      compressed, 1, 1048576);
+
+    double time = 0.0;
+    for (auto _ : state)
+    {
+        time += 1.0;
+        writer.writeStep(time);
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->getNumberOfNodes());
+}
+}  // namespace
+
+// Arguments: number of elements per direction, compression on/off.
+BENCHMARK(VtuInterfaceWriteToFile)
+    ->Args({32, 0})
+    ->Args({32, 1})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(HdfWriterWriteStep)
+    ->Args({32, 0})
+    ->Args({32, 1})
+    ->Unit(benchmark::kMillisecond);
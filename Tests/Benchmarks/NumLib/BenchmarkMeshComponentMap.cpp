@@ -0,0 +1,76 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "NumLib/DOF/MeshComponentMap.h"
+
+namespace
+{
+// Setup of the mesh component map of a hexahedral mesh with the given number
+// of subdivisions and four components at all nodes.
+void MeshComponentMapSetup(benchmark::State& state)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh{
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, state.range(0))};
+    MeshLib::MeshSubset const all_nodes{*mesh, mesh->getNodes()};
+    std::vector<MeshLib::MeshSubset> const components(4, all_nodes);
+
+    for (auto _ : state)
+    {
+        NumLib::MeshComponentMap const map(components,
+                                           NumLib::ComponentOrder::BY_LOCATION);
+        benchmark::DoNotOptimize(map.dofSizeWithGhosts());
+    }
+    state.SetItemsProcessed(state.iterations() * components.size() *
+                            mesh->getNumberOfNodes());
+}
+
+// Lookup of the global indices of all nodes and components.
+void MeshComponentMapLookup(benchmark::State& state)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh{
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, state.range(0))};
+    MeshLib::MeshSubset const all_nodes{*mesh, mesh->getNodes()};
+    std::vector<MeshLib::MeshSubset> const components(4, all_nodes);
+    NumLib::MeshComponentMap const map(components,
+                                       NumLib::ComponentOrder::BY_LOCATION);
+
+    for (auto _ : state)
+    {
+        GlobalIndexType sum = 0;
+        for (std::size_t node_id = 0; node_id < mesh->getNumberOfNodes();
+             node_id++)
+        {
+            MeshLib::Location const l{mesh->getID(),
+                                      MeshLib::MeshItemType::Node, node_id};
+            for (int c = 0; c < static_cast<int>(components.size()); c++)
+            {
+                sum += map.getGlobalIndex(l, c);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * components.size() *
+                            mesh->getNumberOfNodes());
+}
+}  // namespace
+
+BENCHMARK(MeshComponentMapSetup)
+    ->Arg(16)
+    ->Arg(64)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(MeshComponentMapLookup)->Arg(16)->Arg(64);
@@ -0,0 +1,254 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Applications/ApplicationsLib/ProjectData.h"
+#include "BaseLib/ConfigTreeUtil.h"
+#include "BaseLib/FileTools.h"
+#include "BaseLib/Logging.h"
+#include "BaseLib/PrjProcessing.h"
+#include "BaseLib/StringTools.h"
+#include "InfoLib/TestInfo.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/IO/writeMeshToFile.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshGenerators/QuadraticMeshGenerator.h"
+#include "ProcessLib/Process.h"
+#include "ProcessLib/TimeLoop.h"
+
+namespace
+{
+// A project of the Tests/Data directory, which is set up on a generated mesh
+// instead of its own mesh. The boundary conditions are removed, because they
+// refer to the original geometry.
+struct ProcessCase
+{
+    char const* project_file;
+    // XML patch operations replacing the meshes of the project by the
+    // generated "domain.vtu".
+    char const* mesh_patch;
+    std::unique_ptr<MeshLib::Mesh> (*create_mesh)(int n);
+    bool use_jacobian;
+};
+
+std::unique_ptr<MeshLib::Mesh> createQuadMesh(int const n)
+{
+    return std::unique_ptr<MeshLib::Mesh>{
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, n)};
+}
+
+std::unique_ptr<MeshLib::Mesh> createQuad8Mesh(int const n)
+{
+    auto const linear_mesh = createQuadMesh(n);
+    return MeshLib::createQuadraticOrderMesh(*linear_mesh, false);
+}
+
+constexpr char replace_single_mesh[] =
+    "<replace sel=\"/*/mesh\"><meshes><mesh>domain.vtu</mesh></meshes>"
+    "</replace>\n"
+    "<remove sel=\"/*/geometry\"/>\n";
+
+[[maybe_unused]] ProcessCase const small_deformation{
+    "Mechanics/Linear/square_1e2.prj", replace_single_mesh, createQuadMesh,
+    true};
+
+[[maybe_unused]] ProcessCase const ht{
+    "Parabolic/HT/SimpleSynthetics/PressureDiffusionTemperatureDiffusion.prj",
+    replace_single_mesh, createQuadMesh, false};
+
+[[maybe_unused]] ProcessCase const th2m{
+    "TH2M/HM/flow_fully_saturated.prj",
+    "<replace sel=\"/*/meshes\"><meshes><mesh>domain.vtu</mesh></meshes>"
+    "</replace>\n"
+    "<remove msel=\"/*/*/process/jacobian_assembler\"/>\n",
+    createQuad8Mesh, true};
+
+class ProcessFixture
+{
+public:
+    ProcessFixture(ProcessCase const& process_case, int const n)
+        : directory_(std::filesystem::temp_directory_path() /
+                     BaseLib::randomString(32)),
+          use_jacobian_(process_case.use_jacobian)
+    {
+        BaseLib::setConsoleLogLevel("warn");
+        std::filesystem::create_directories(directory_);
+
+        auto const mesh = process_case.create_mesh(n);
+        MeshLib::IO::writeMeshToFile(*mesh, directory_ / "domain.vtu");
+
+        auto const patch_file = (directory_ / "patch.xml").string();
+        {
+            std::ofstream patch(patch_file);
+            patch << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>\n"
+                     "<OpenGeoSysProjectDiff>\n"
+                  << process_case.mesh_patch
+                  << "<remove msel=\"/*/process_variables/process_variable/"
+                     "boundary_conditions\"/>\n"
+                     "<remove sel=\"/*/test_definition\"/>\n"
+                     "</OpenGeoSysProjectDiff>\n";
+        }
+
+        std::string const project =
+            TestInfoLib::TestInfo::data_path + "/" + process_case.project_file;
+        std::stringstream prj_stream;
+        BaseLib::prepareProjectFile(prj_stream, project, {patch_file}, false,
+                                    directory_.string());
+        auto project_config = BaseLib::makeConfigTree(
+            project, true, "OpenGeoSysProject", prj_stream);
+        project_data_ = std::make_unique<ProjectData>(
+            project_config, BaseLib::extractPath(project), directory_.string(),
+            directory_.string());
+
+        auto& p = process();
+        p.initialize();
+
+        auto const spec = p.getMatrixSpecifications(process_id);
+        x_ = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+        xs_[0] = x_.get();
+        x_prev_ = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+        xdot_ = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+        xdot_->setZero();
+        std::vector<GlobalVector*> x_prev{x_prev_.get()};
+        p.setInitialConditions(x(), x_prev, 0.0, process_id);
+        p.preTimestep(x(), 0.0, dt, process_id);
+
+        M_ = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(spec);
+        K_ = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(spec);
+        Jac_ = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(spec);
+        b_ = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+    }
+
+    ~ProcessFixture()
+    {
+        project_data_.reset();
+        std::filesystem::remove_all(directory_);
+    }
+
+    ProcessLib::Process& process() const
+    {
+        return *project_data_->getProcesses().front();
+    }
+
+    std::vector<GlobalVector*>& x() { return xs_; }
+
+    std::size_t numberOfElements() const
+    {
+        return process().getMesh().getNumberOfElements();
+    }
+
+    void assemble()
+    {
+        M_->setZero();
+        K_->setZero();
+        b_->setZero();
+        std::vector<GlobalVector*> const xdot{xdot_.get()};
+        if (use_jacobian_)
+        {
+            Jac_->setZero();
+            process().assembleWithJacobian(0.0, dt, x(), xdot, process_id, *M_,
+                                           *K_, *b_, *Jac_);
+        }
+        else
+        {
+            process().assemble(0.0, dt, x(), xdot, process_id, *M_, *K_, *b_);
+        }
+    }
+
+    static constexpr int process_id = 0;
+    static constexpr double dt = 1.0;
+
+private:
+    std::filesystem::path const directory_;
+    bool const use_jacobian_;
+    std::unique_ptr<ProjectData> project_data_;
+    std::unique_ptr<GlobalVector> x_;
+    std::unique_ptr<GlobalVector> x_prev_;
+    std::unique_ptr<GlobalVector> xdot_;
+    std::vector<GlobalVector*> xs_{nullptr};
+    std::unique_ptr<GlobalMatrix> M_;
+    std::unique_ptr<GlobalMatrix> K_;
+    std::unique_ptr<GlobalMatrix> Jac_;
+    std::unique_ptr<GlobalVector> b_;
+};
+
+// Global assembly of a real process through
+// VectorMatrixAssembler::assemble() or assembleWithJacobian().
+void ProcessAssembly(benchmark::State& state, ProcessCase const& process_case)
+{
+    ProcessFixture f(process_case, state.range(0));
+    f.process().setGlobalAssemblyOptions(
+        {static_cast<int>(state.range(1)), false});
+
+    for (auto _ : state)
+    {
+        f.assemble();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * f.numberOfElements());
+}
+
+// Extrapolation of an integration point quantity to the nodes by the
+// LocalLinearLeastSquaresExtrapolator of the process.
+void SecondaryVariableExtrapolation(benchmark::State& state,
+                                    ProcessCase const& process_case,
+                                    char const* const secondary_variable)
+{
+    ProcessFixture f(process_case, state.range(0));
+    f.assemble();
+
+    auto const& variable =
+        f.process().getSecondaryVariables().get(secondary_variable);
+    std::vector<NumLib::LocalToGlobalIndexMap const*> const dof_tables{
+        &f.process().getDOFTable(ProcessFixture::process_id)};
+    std::unique_ptr<GlobalVector> result_cache;
+
+    for (auto _ : state)
+    {
+        auto const& nodal_values =
+            variable.fcts.eval_field(0.0, f.x(), dof_tables, result_cache);
+        benchmark::DoNotOptimize(&nodal_values);
+    }
+    state.SetItemsProcessed(state.iterations() * f.numberOfElements());
+}
+}  // namespace
+
+// Arguments: number of elements per direction, number of assembly threads.
+#ifdef OGS_BUILD_PROCESS_SMALLDEFORMATION
+BENCHMARK_CAPTURE(ProcessAssembly, SmallDeformation, small_deformation)
+    ->Args({64, 1})
+    ->Args({64, 4})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SecondaryVariableExtrapolation, SmallDeformationSigma,
+                  small_deformation, "sigma")
+    ->Arg(64)
+    ->Unit(benchmark::kMillisecond);
+#endif
+#ifdef OGS_BUILD_PROCESS_HT
+BENCHMARK_CAPTURE(ProcessAssembly, HT, ht)
+    ->Args({64, 1})
+    ->Args({64, 4})
+    ->Unit(benchmark::kMillisecond);
+#endif
+#ifdef OGS_BUILD_PROCESS_TH2M
+BENCHMARK_CAPTURE(ProcessAssembly, TH2M, th2m)
+    ->Args({32, 1})
+    ->Args({32, 4})
+    ->Unit(benchmark::kMillisecond);
+#endif
@@ -0,0 +1,54 @@
+import OpenGeoSys
+import numpy as np
+from math import pi
+
+a = 2.0 * pi / 3.0
+
+# analytical solution used to set the Dirichlet BCs
+def solution(x, y):
+    return np.sin(a * x) * np.sinh(a * y)
+
+
+# gradient of the analytical solution used to set the Neumann BCs
+def grad_solution(x, y):
+    return a * np.cos(a * x) * np.sinh(a * y), a * np.sin(a * x) * np.cosh(a * y)
+
+
+# Dirichlet BCs, all nodes of the boundary at once
+class BCTop(OpenGeoSys.BoundaryCondition):
+    def getDirichletBCValues(self, t, coords, node_ids, primary_vars):
+        x, y, z = coords.T
+        assert np.all(y == 1.0) and np.all(z == 0.0)
+        return (np.full(len(x), True), solution(x, y))
+
+
+class BCLeft(OpenGeoSys.BoundaryCondition):
+    def getDirichletBCValues(self, t, coords, node_ids, primary_vars):
+        x, y, z = coords.T
+        assert np.all(x == 0.0) and np.all(z == 0.0)
+        return (np.full(len(x), True), solution(x, y))
+
+
+class BCBottom(OpenGeoSys.BoundaryCondition):
+    def getDirichletBCValues(self, t, coords, node_ids, primary_vars):
+        x, y, z = coords.T
+        assert np.all(y == 0.0) and np.all(z == 0.0)
+        return (np.full(len(x), True), solution(x, y))
+
+
+# Neumann BC, all integration points of the boundary at once
+class BCRight(OpenGeoSys.BoundaryCondition):
+    def getFluxes(self, t, coords, primary_vars):
+        x, y, z = coords.T
+        assert np.all(x == 1.0) and np.all(z == 0.0)
+        values = grad_solution(x, y)[0]
+        # values do not depend on the primary variable
+        Jac = np.zeros(primary_vars.shape)
+        return (np.full(len(x), True), values, Jac)
+
+
+# instantiate BC objects referenced in OpenGeoSys' prj file
+bc_top = BCTop()
+bc_right = BCRight()
+bc_bottom = BCBottom()
+bc_left = BCLeft()
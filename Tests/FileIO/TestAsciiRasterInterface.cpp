@@ -0,0 +1,262 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "Applications/FileIO/AsciiRasterInterface.h"
+#include "BaseLib/StringTools.h"
+#include "GeoLib/Raster.h"
+
+class FileIOAsciiRasterInterface : public ::testing::Test
+{
+public:
+    FileIOAsciiRasterInterface()
+        : _file_name((std::filesystem::temp_directory_path() /=
+                      BaseLib::randomString(32) + ".asc")
+                         .string()),
+          _tiles_file_name(_file_name + ".tiles"),
+          _upper_case_file_name(
+              _file_name.substr(0, _file_name.size() - 4) + ".ASC")
+    {
+    }
+
+    ~FileIOAsciiRasterInterface() override
+    {
+        for (auto const& file_name :
+             {_file_name, _tiles_file_name, _tiles_file_name + ".tmp",
+              _file_name + ".copy.asc", _upper_case_file_name,
+              _upper_case_file_name + ".tiles"})
+        {
+            std::filesystem::remove(file_name);
+        }
+    }
+
+protected:
+    /// Writes an ASC file with the given data after the header.
+    void writeASC(std::string const& data, std::size_t const n_cols = 3,
+                  std::size_t const n_rows = 2) const
+    {
+        std::ofstream out(_file_name, std::ios::binary);
+        out << "ncols " << n_cols << "\nnrows " << n_rows
+            << "\nxllcorner 10\nyllcorner 20\ncellsize 2\n"
+               "NODATA_value -9999\n"
+            << data;
+    }
+
+    /// Writes a Surfer grd file of the same raster as writeASC() with the
+    /// given data after the header.
+    void writeSurfer(std::string const& data) const
+    {
+        std::ofstream out(_file_name, std::ios::binary);
+        out << "DSAA\n3 2\n10 16\n20 24\n0 5\n" << data;
+    }
+
+    std::unique_ptr<GeoLib::Raster> read() const
+    {
+        return std::unique_ptr<GeoLib::Raster>(
+            FileIO::AsciiRasterInterface::getRasterFromASCFile(_file_name));
+    }
+
+    std::unique_ptr<GeoLib::Raster> readTiled() const
+    {
+        return std::unique_ptr<GeoLib::Raster>(
+            FileIO::AsciiRasterInterface::getTiledRasterFromASCFile(
+                _file_name));
+    }
+
+    /// Expects the values 0, 1, ..., 5 of the 2 x 3 raster written by
+    /// writeASC() with the rows given from the top of the raster.
+    static void checkValues(GeoLib::Raster const& raster, double const shift,
+                            double const no_data = -9999)
+    {
+        ASSERT_EQ(3, raster.getHeader().n_cols);
+        ASSERT_EQ(2, raster.getHeader().n_rows);
+        EXPECT_EQ(10, raster.getHeader().origin[0]);
+        EXPECT_EQ(20, raster.getHeader().origin[1]);
+        EXPECT_EQ(2, raster.getHeader().cell_size);
+        EXPECT_EQ(no_data, raster.getHeader().no_data);
+        for (std::size_t r = 0; r < 2; ++r)
+        {
+            for (std::size_t c = 0; c < 3; ++c)
+            {
+                EXPECT_EQ(static_cast<double>(3 * r + c) + shift,
+                          raster(r, c));
+            }
+        }
+    }
+
+    std::string const _file_name;
+    std::string const _tiles_file_name;
+    std::string const _upper_case_file_name;
+};
+
+TEST_F(FileIOAsciiRasterInterface, ReadASC)
+{
+    writeASC("0 1 2\n3 4 5\n");
+    auto const raster = read();
+    ASSERT_TRUE(raster != nullptr);
+    checkValues(*raster, 0);
+}
+
+TEST_F(FileIOAsciiRasterInterface, ReadASCWithCommaDecimalSeparator)
+{
+    writeASC("0,5 1,5 2,5\n3,5\t4,5 +5.5");
+    auto const raster = read();
+    ASSERT_TRUE(raster != nullptr);
+    checkValues(*raster, 0.5);
+}
+
+TEST_F(FileIOAsciiRasterInterface, ReadTruncatedASC)
+{
+    writeASC("0 1 2\n3 4");
+    EXPECT_EQ(nullptr, read());
+    EXPECT_EQ(nullptr, readTiled());
+    EXPECT_FALSE(std::filesystem::exists(_tiles_file_name));
+    EXPECT_FALSE(std::filesystem::exists(_tiles_file_name + ".tmp"));
+}
+
+// The rows of Surfer files are given from the bottom of the raster.
+TEST_F(FileIOAsciiRasterInterface, ReadSurfer)
+{
+    writeSurfer("3 4 5\n0 1 2\n");
+    std::unique_ptr<GeoLib::Raster> const raster(
+        FileIO::AsciiRasterInterface::getRasterFromSurferFile(_file_name));
+    ASSERT_TRUE(raster != nullptr);
+    // No data is marked by the value below the minimum of the y-range.
+    checkValues(*raster, 0, 19);
+}
+
+TEST_F(FileIOAsciiRasterInterface, ReadTruncatedSurfer)
+{
+    writeSurfer("3 4 5\n0 1");
+    std::unique_ptr<GeoLib::Raster> const raster(
+        FileIO::AsciiRasterInterface::getRasterFromSurferFile(_file_name));
+    EXPECT_EQ(nullptr, raster);
+}
+
+// The values are read in chunks of 1 MiB. The data is shifted such that the
+// first chunk ends in the middle of a token.
+TEST_F(FileIOAsciiRasterInterface, ReadASCTokensAcrossChunkBoundaries)
+{
+    std::size_t const chunk_size = 1 << 20;
+    std::size_t const n_cols = 100;
+    std::size_t const n_rows = 2000;
+    auto const token = [](std::size_t const i)
+    { return "123.456789" + std::to_string(i % 10); };
+
+    std::string data;
+    for (std::size_t i = 0; i < n_cols * n_rows; ++i)
+    {
+        data += token(i) + ((i + 1) % n_cols == 0 ? '\n' : ' ');
+    }
+    // The input of the reader starts with the line break after the header,
+    // so the first chunk ends with data[chunk_size - 2].
+    auto const is_space = [&data](std::size_t const i)
+    { return data[i] == ' ' || data[i] == '\n'; };
+    while (is_space(chunk_size - 2) || is_space(chunk_size - 1))
+    {
+        data.insert(data.begin(), ' ');
+    }
+    writeASC(data, n_cols, n_rows);
+
+    for (auto const& raster_ptr : {read(), readTiled()})
+    {
+        ASSERT_TRUE(raster_ptr != nullptr);
+        GeoLib::Raster const& raster = *raster_ptr;
+        for (std::size_t r = 0; r < n_rows; ++r)
+        {
+            for (std::size_t c = 0; c < n_cols; ++c)
+            {
+                ASSERT_EQ(std::stod(token(r * n_cols + c)), raster(r, c));
+            }
+        }
+    }
+}
+
+// A token larger than the chunk size forces the read buffer to grow.
+TEST_F(FileIOAsciiRasterInterface, ReadASCTokenLongerThanChunk)
+{
+    writeASC(std::string(1 << 21, '0') + "0 1 2\n3 4 5\n");
+    auto const raster = read();
+    ASSERT_TRUE(raster != nullptr);
+    checkValues(*raster, 0);
+}
+
+TEST_F(FileIOAsciiRasterInterface, ConvertASCToTiles)
+{
+    writeASC("0 1 2\n3 4 5\n");
+    auto const raster = readTiled();
+    ASSERT_TRUE(raster != nullptr);
+    EXPECT_TRUE(raster->isTiled());
+    EXPECT_TRUE(std::filesystem::exists(_tiles_file_name));
+    EXPECT_FALSE(std::filesystem::exists(_tiles_file_name + ".tmp"));
+    checkValues(*raster, 0);
+}
+
+TEST_F(FileIOAsciiRasterInterface, TilesAreReusedWhileNewerThanASC)
+{
+    writeASC("0 1 2\n3 4 5\n");
+    ASSERT_TRUE(readTiled() != nullptr);
+    auto const tiles_time = std::filesystem::last_write_time(_tiles_file_name);
+
+    // The changed ASC file is older than the tile file, so the tiles are
+    // reused without parsing the ASC file.
+    writeASC("1 2 3\n4 5 6\n");
+    std::filesystem::last_write_time(_file_name,
+                                     tiles_time - std::chrono::hours(1));
+    {
+        auto const raster = readTiled();
+        ASSERT_TRUE(raster != nullptr);
+        checkValues(*raster, 0);
+    }
+
+    // A newer ASC file is converted again.
+    std::filesystem::last_write_time(_file_name,
+                                     tiles_time + std::chrono::hours(1));
+    auto const raster = readTiled();
+    ASSERT_TRUE(raster != nullptr);
+    checkValues(*raster, 1);
+}
+
+TEST_F(FileIOAsciiRasterInterface, TiledRasterRoundTripViaASC)
+{
+    writeASC("0 1 2\n3 4 5\n");
+    auto const tiled_raster = readTiled();
+    ASSERT_TRUE(tiled_raster != nullptr);
+
+    std::string const copy_file_name = _file_name + ".copy.asc";
+    FileIO::AsciiRasterInterface::writeRasterAsASC(*tiled_raster,
+                                                   copy_file_name);
+    std::unique_ptr<GeoLib::Raster> const raster(
+        FileIO::AsciiRasterInterface::getRasterFromASCFile(copy_file_name));
+    ASSERT_TRUE(raster != nullptr);
+    EXPECT_FALSE(raster->isTiled());
+    checkValues(*raster, 0);
+}
+
+// The extension of ASC files read as tiles is not case-sensitive.
+TEST_F(FileIOAsciiRasterInterface, ReadRastersAsTilesWithUpperCaseExtension)
+{
+    writeASC("0 1 2\n3 4 5\n");
+    std::filesystem::rename(_file_name, _upper_case_file_name);
+
+    auto const rasters = FileIO::readRasters({_upper_case_file_name}, true);
+    ASSERT_TRUE(rasters.has_value());
+    ASSERT_EQ(1, rasters->size());
+    std::unique_ptr<GeoLib::Raster const> const raster(rasters->front());
+    ASSERT_TRUE(raster != nullptr);
+    EXPECT_TRUE(raster->isTiled());
+    checkValues(*raster, 0);
+}
@@ -0,0 +1,316 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "Applications/FileIO/Gmsh/GmshReader.h"
+#include "BaseLib/StringTools.h"
+#include "InfoLib/TestInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+/// Writes the values of gmsh node and element sections either as text or
+/// as binary data.
+class GmshDataWriter
+{
+public:
+    GmshDataWriter(std::ostream& out, bool const binary)
+        : _out(out), _binary(binary)
+    {
+    }
+
+    template <typename T>
+    GmshDataWriter& operator<<(T const value)
+    {
+        if (_binary)
+        {
+            _out.write(reinterpret_cast<char const*>(&value), sizeof(T));
+        }
+        else
+        {
+            _out << value << ' ';
+        }
+        return *this;
+    }
+
+    /// Ends a line in ASCII files.
+    void newline()
+    {
+        if (!_binary)
+        {
+            _out << '\n';
+        }
+    }
+
+private:
+    std::ostream& _out;
+    bool const _binary;
+};
+
+struct GmshElement
+{
+    int type;
+    int entity;
+    std::vector<std::size_t> node_tags;
+};
+
+// A quad, a triangle, a line, and a point, which is not converted. The 9-node
+// triangle is not supported and skipped. The node tags are neither contiguous
+// nor ordered.
+std::array<std::size_t, 5> const node_tags = {40, 10, 20, 30, 50};
+std::array<std::array<double, 3>, 5> const node_coordinates = {
+    {{0, 1, 0}, {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {2, 0.5, 0}}};
+std::array<GmshElement, 5> const gmsh_elements = {
+    {{15, 1, {10}},
+     {1, 7, {10, 20}},
+     {20, 3, {10, 20, 30, 40, 50, 10, 20, 30, 40}},
+     {3, 3, {10, 20, 30, 40}},
+     {2, 5, {20, 50, 30}}}};
+
+void writeMeshFormat(std::ofstream& out, std::string const& version,
+                     bool const binary, std::size_t const data_size)
+{
+    out << "$MeshFormat\n"
+        << version << ' ' << binary << ' ' << data_size << '\n';
+    if (binary)
+    {
+        int const one = 1;
+        out.write(reinterpret_cast<char const*>(&one), sizeof(one));
+        out << '\n';
+    }
+    out << "$EndMeshFormat\n";
+}
+
+void writeVersion2(std::string const& file_name, bool const binary)
+{
+    std::ofstream out(file_name, std::ios::binary);
+    writeMeshFormat(out, "2.2", binary, sizeof(double));
+    out << "$PhysicalNames\n1\n2 1 \"domain\"\n$EndPhysicalNames\n";
+
+    GmshDataWriter data(out, binary);
+    out << "$Nodes\n" << node_tags.size() << '\n';
+    for (std::size_t i = 0; i < node_tags.size(); ++i)
+    {
+        data << static_cast<int>(node_tags[i]) << node_coordinates[i][0]
+             << node_coordinates[i][1] << node_coordinates[i][2];
+        data.newline();
+    }
+    out << "\n$EndNodes\n";
+
+    out << "$Elements\n" << gmsh_elements.size() << '\n';
+    int element_tag = 1;
+    for (auto const& element : gmsh_elements)
+    {
+        if (binary)
+        {
+            // Block header with a single element.
+            data << element.type << 1 << 2;
+            data << element_tag++ << 0 << element.entity;
+        }
+        else
+        {
+            data << element_tag++ << element.type << 2 << 0 << element.entity;
+        }
+        for (auto const tag : element.node_tags)
+        {
+            data << static_cast<int>(tag);
+        }
+        data.newline();
+    }
+    out << "\n$EndElements\n";
+}
+
+template <typename Size>
+void writeVersion4(std::string const& file_name, bool const binary)
+{
+    std::ofstream out(file_name, std::ios::binary);
+    writeMeshFormat(out, "4.1", binary, sizeof(Size));
+    out << "$Entities\nskipped\n$EndEntities\n";
+
+    GmshDataWriter data(out, binary);
+    // Two node blocks; the second one has parametric coordinates on a
+    // surface.
+    out << "$Nodes\n";
+    data << static_cast<Size>(2) << static_cast<Size>(node_tags.size())
+         << static_cast<Size>(10) << static_cast<Size>(50);
+    data.newline();
+    auto const write_node_block =
+        [&](std::size_t const begin, std::size_t const end, int const dim)
+    {
+        data << dim << 1 << static_cast<int>(dim > 0)
+             << static_cast<Size>(end - begin);
+        data.newline();
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            data << static_cast<Size>(node_tags[i]);
+            data.newline();
+        }
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            data << node_coordinates[i][0] << node_coordinates[i][1]
+                 << node_coordinates[i][2];
+            for (int d = 0; d < dim; ++d)
+            {
+                data << 0.5;
+            }
+            data.newline();
+        }
+    };
+    write_node_block(0, 3, 0);
+    write_node_block(3, 5, 2);
+    out << "\n$EndNodes\n";
+
+    out << "$Elements\n";
+    data << static_cast<Size>(gmsh_elements.size())
+         << static_cast<Size>(gmsh_elements.size()) << static_cast<Size>(1)
+         << static_cast<Size>(gmsh_elements.size());
+    data.newline();
+    Size element_tag = 1;
+    for (auto const& element : gmsh_elements)
+    {
+        data << 2 << element.entity << element.type << static_cast<Size>(1);
+        data.newline();
+        data << element_tag++;
+        for (auto const tag : element.node_tags)
+        {
+            data << static_cast<Size>(tag);
+        }
+        data.newline();
+    }
+    out << "\n$EndElements\n";
+}
+
+void checkMesh(MeshLib::Mesh const& mesh)
+{
+    ASSERT_EQ(node_tags.size(), mesh.getNumberOfNodes());
+    for (std::size_t i = 0; i < node_tags.size(); ++i)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            EXPECT_EQ(node_coordinates[i][c], (*mesh.getNode(i))[c]);
+        }
+    }
+
+    ASSERT_EQ(3, mesh.getNumberOfElements());
+    auto const& line = *mesh.getElement(0);
+    EXPECT_EQ(MeshLib::MeshElemType::LINE, line.getGeomType());
+    EXPECT_EQ(1, line.getNode(0)->getID());
+    EXPECT_EQ(2, line.getNode(1)->getID());
+
+    auto const& quad = *mesh.getElement(1);
+    EXPECT_EQ(MeshLib::MeshElemType::QUAD, quad.getGeomType());
+    EXPECT_EQ(1, quad.getNode(0)->getID());
+    EXPECT_EQ(0, quad.getNode(3)->getID());
+
+    // The node order of triangles is reversed.
+    auto const& tri = *mesh.getElement(2);
+    EXPECT_EQ(MeshLib::MeshElemType::TRIANGLE, tri.getGeomType());
+    EXPECT_EQ(3, tri.getNode(0)->getID());
+    EXPECT_EQ(4, tri.getNode(1)->getID());
+    EXPECT_EQ(2, tri.getNode(2)->getID());
+
+    // The entities 7, 3, and 5 are condensed to 2, 0, and 1.
+    auto const* const material_ids = materialIDs(mesh);
+    ASSERT_TRUE(material_ids != nullptr);
+    EXPECT_EQ(2, (*material_ids)[0]);
+    EXPECT_EQ(0, (*material_ids)[1]);
+    EXPECT_EQ(1, (*material_ids)[2]);
+}
+}  // namespace
+
+class FileIOGmshReader : public ::testing::Test
+{
+public:
+    FileIOGmshReader()
+        : _file_name((std::filesystem::temp_directory_path() /=
+                      BaseLib::randomString(32) + ".msh")
+                         .string())
+    {
+    }
+
+    ~FileIOGmshReader() override { std::filesystem::remove(_file_name); }
+
+protected:
+    std::unique_ptr<MeshLib::Mesh> read(int const number_of_threads = 1) const
+    {
+        return std::unique_ptr<MeshLib::Mesh>(
+            FileIO::GMSH::readGMSHMesh(_file_name, number_of_threads));
+    }
+
+    std::string const _file_name;
+};
+
+TEST_F(FileIOGmshReader, Version2ASCII)
+{
+    writeVersion2(_file_name, false);
+    auto const mesh = read();
+    ASSERT_TRUE(mesh != nullptr);
+    checkMesh(*mesh);
+}
+
+TEST_F(FileIOGmshReader, Version2Binary)
+{
+    writeVersion2(_file_name, true);
+    auto const mesh = read(2);
+    ASSERT_TRUE(mesh != nullptr);
+    checkMesh(*mesh);
+}
+
+TEST_F(FileIOGmshReader, Version4ASCII)
+{
+    writeVersion4<std::uint64_t>(_file_name, false);
+    auto const mesh = read();
+    ASSERT_TRUE(mesh != nullptr);
+    checkMesh(*mesh);
+}
+
+TEST_F(FileIOGmshReader, Version4Binary)
+{
+    writeVersion4<std::uint64_t>(_file_name, true);
+    auto const mesh = read(2);
+    ASSERT_TRUE(mesh != nullptr);
+    checkMesh(*mesh);
+}
+
+TEST_F(FileIOGmshReader, Version4Binary32BitSizes)
+{
+    writeVersion4<std::uint32_t>(_file_name, true);
+    auto const mesh = read();
+    ASSERT_TRUE(mesh != nullptr);
+    checkMesh(*mesh);
+}
+
+TEST_F(FileIOGmshReader, UnknownNodeTag)
+{
+    {
+        std::ofstream out(_file_name);
+        writeMeshFormat(out, "4.1", false, 8);
+        out << "$Nodes\n1 2 1 2\n0 1 0 2\n1\n2\n0 0 0\n1 0 0\n$EndNodes\n"
+               "$Elements\n1 1 1 1\n1 1 1 1\n1 1 3\n$EndElements\n";
+    }
+    EXPECT_EQ(nullptr, read());
+}
+
+TEST_F(FileIOGmshReader, LinearMeshVersion2)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(FileIO::GMSH::readGMSHMesh(
+        TestInfoLib::TestInfo::data_path + "/Utils/GMSH2OGS/linear_mesh.msh"));
+    ASSERT_TRUE(mesh != nullptr);
+    EXPECT_EQ(12, mesh->getNumberOfNodes());
+}
@@ -12,7 +12,13 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <filesystem>
+#include <numeric>
+
+#include "BaseLib/StringTools.h"
 #include "GeoLib/Raster.h"
+#include "GeoLib/RasterTiles.h"
 
 TEST(GeoLibRaster, EmptyRaster)
 {
@@ -77,3 +83,78 @@ TEST(GeoLibRaster, TwoRowsByFourColumnsRaster)
         EXPECT_EQ(double(c + 1), raster(1, c));
     }
 }
+
+class GeoLibRasterTiles : public ::testing::Test
+{
+public:
+    GeoLibRasterTiles()
+        : _file_name((std::filesystem::temp_directory_path() /=
+                      BaseLib::randomString(32) + ".tiles")
+                         .string())
+    {
+        // Neither rows nor columns are a multiple of the tile size.
+        std::vector<double> data(_header.n_cols * _header.n_rows);
+        std::iota(data.begin(), data.end(), 0.0);
+        _raster = std::make_unique<GeoLib::Raster>(_header, data.begin(),
+                                                   data.end());
+        GeoLib::writeRasterTiles(*_raster, _file_name, _tile_size);
+    }
+
+    ~GeoLibRasterTiles() override { std::filesystem::remove(_file_name); }
+
+protected:
+    GeoLib::RasterHeader const _header{
+        7, 5, 1, MathLib::Point3d{{10, 20, 0}}, 2, -9999};
+    std::size_t const _tile_size = 3;
+    std::string const _file_name;
+    std::unique_ptr<GeoLib::Raster> _raster;
+};
+
+TEST_F(GeoLibRasterTiles, ValuesEqualInMemoryRaster)
+{
+    // A single cached tile forces a tile exchange on almost every access.
+    for (std::size_t const max_cached_tiles : {1, 2, 64})
+    {
+        GeoLib::Raster const tiled_raster{std::make_unique<GeoLib::RasterTiles>(
+            _file_name, max_cached_tiles)};
+        ASSERT_TRUE(tiled_raster.isTiled());
+
+        auto const& header = tiled_raster.getHeader();
+        EXPECT_EQ(_header.n_cols, header.n_cols);
+        EXPECT_EQ(_header.n_rows, header.n_rows);
+        EXPECT_EQ(_header.origin, header.origin);
+        EXPECT_EQ(_header.cell_size, header.cell_size);
+        EXPECT_EQ(_header.no_data, header.no_data);
+
+        for (std::size_t r = 0; r < _header.n_rows; ++r)
+        {
+            for (std::size_t c = 0; c < _header.n_cols; ++c)
+            {
+                EXPECT_EQ((*_raster)(r, c), tiled_raster(r, c));
+            }
+        }
+        EXPECT_THROW(tiled_raster(_header.n_rows, 0), std::runtime_error);
+        EXPECT_THROW(tiled_raster(0, _header.n_cols), std::runtime_error);
+
+        for (double x = 9; x < 26; x += 0.7)
+        {
+            for (double y = 19; y < 32; y += 0.7)
+            {
+                MathLib::Point3d const p{{x, y, 0}};
+                EXPECT_EQ(_raster->getValueAtPoint(p),
+                          tiled_raster.getValueAtPoint(p));
+                // Points near the raster boundary interpolate to NaN.
+                double const expected = _raster->interpolateValueAtPoint(p);
+                double const value = tiled_raster.interpolateValueAtPoint(p);
+                EXPECT_TRUE(value == expected ||
+                            (std::isnan(value) && std::isnan(expected)));
+            }
+        }
+    }
+}
+
+TEST_F(GeoLibRasterTiles, InvalidFile)
+{
+    std::ofstream(_file_name) << "no raster tiles";
+    EXPECT_THROW(GeoLib::RasterTiles{_file_name}, std::runtime_error);
+}
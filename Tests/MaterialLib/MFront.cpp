@@ -168,18 +168,14 @@ TYPED_TEST(MaterialLib_SolidModelsMFront2, IntegrateZeroDisplacement)
     auto solution = this->constitutive_relation->integrateStress(
         this->variable_array_prev, this->variable_array, this->t, this->x,
         this->dt, *state);
+    ASSERT_TRUE(solution != std::nullopt);
 
+    // The state is updated in place.
     double const epls_strain = state->getEquivalentPlasticStrain();
     double const expected_epls_strain = 0.0;
     ASSERT_LE(std::fabs(expected_epls_strain - epls_strain), 1e-10)
         << "for expected equivalent plastic strain " << expected_epls_strain
         << " and for computed equivalent plastic strain " << epls_strain;
-
-    ASSERT_TRUE(solution != std::nullopt);
-    state = std::move(std::get<1>(*solution));
-    ASSERT_TRUE(state != nullptr);
-    state.reset(nullptr);
-    ASSERT_TRUE(state == nullptr);
 }
 
 TYPED_TEST(MaterialLib_SolidModelsMFront3, IntegrateZeroDisplacement)
@@ -190,17 +186,83 @@ TYPED_TEST(MaterialLib_SolidModelsMFront3, IntegrateZeroDisplacement)
     auto solution = this->constitutive_relation->integrateStress(
         this->variable_array_prev, this->variable_array, this->t, this->x,
         this->dt, *state);
+    ASSERT_TRUE(solution != std::nullopt);
 
+    // The state is updated in place.
     double const epls_strain = state->getEquivalentPlasticStrain();
     double const expected_epls_strain = 0.0;
     ASSERT_LE(std::fabs(expected_epls_strain - epls_strain), 1e-10)
         << "for expected equivalent plastic strain " << expected_epls_strain
         << " and for computed equivalent plastic strain " << epls_strain;
+}
 
+TYPED_TEST(MaterialLib_SolidModelsMFront3, BatchedIntegrationMatchesSingle)
+{
+    using KV = KelvinVector<3>;
+    auto const mfront = TypeParam::createConstitutiveRelation();
+
+    // Small strains, such that all test behaviours stay elastic.
+    KV eps_m;
+    eps_m << 1e-7, -2e-7, 3e-7, 4e-7, -5e-7, 6e-7;
+    this->variable_array[static_cast<int>(MPL::Variable::mechanical_strain)]
+        .template emplace<KV>(eps_m);
+
+    auto state = mfront->createMaterialStateVariables();
+    auto const solution =
+        mfront->integrateStress(this->variable_array_prev, this->variable_array,
+                                this->t, this->x, this->dt, *state);
     ASSERT_TRUE(solution != std::nullopt);
-    state = std::move(std::get<1>(*solution));
-    ASSERT_TRUE(state != nullptr);
-    state.reset(nullptr);
-    ASSERT_TRUE(state == nullptr);
+    auto const& [sigma_expected, C_expected] = *solution;
+
+    std::size_t const n = 5;
+    for (int const number_of_threads : {1, 2})
+    {
+        auto batch_state =
+            mfront->createBatchStateVariables(n, number_of_threads);
+        ASSERT_EQ(n, batch_state->size());
+
+        std::vector<ParameterLib::SpatialPosition> const x(n, this->x);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            mfront->setBatchInitialState(*batch_state, i, x[i], KV::Zero(),
+                                         KV::Zero());
+        }
+
+        std::vector<KV> const eps_ms(n, eps_m);
+        std::vector<double> const T(n, 0.0);
+        std::vector<KV> sigma(n);
+        std::vector<MathLib::KelvinVector::KelvinMatrixType<3>> C(n);
+        mfront->integrateStressBatch(x, this->t, this->dt, eps_ms, T, T,
+                                     *batch_state, sigma, C);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            EXPECT_LE((sigma[i] - sigma_expected).norm(),
+                      1e-10 * sigma_expected.norm());
+            EXPECT_LE((C[i] - C_expected).norm(), 1e-10 * C_expected.norm());
+
+            // The internal state variables are read from the batch.
+            auto const batch_ip_state =
+                mfront->createBatchMaterialStateVariables(*batch_state, i);
+            for (auto const& internal_variable :
+                 mfront->getInternalVariables())
+            {
+                std::vector<double> cache_expected;
+                std::vector<double> cache;
+                auto const& expected =
+                    internal_variable.getter(*state, cache_expected);
+                auto const& values =
+                    internal_variable.getter(*batch_ip_state, cache);
+                ASSERT_EQ(expected.size(), values.size());
+                for (std::size_t k = 0; k < values.size(); ++k)
+                {
+                    EXPECT_NEAR(expected[k], values[k], 1e-15)
+                        << "for internal variable " << internal_variable.name;
+                }
+            }
+            EXPECT_EQ(state->getEquivalentPlasticStrain(),
+                      batch_ip_state->getEquivalentPlasticStrain());
+        }
+    }
 }
 #endif  // OGS_USE_MFRONT
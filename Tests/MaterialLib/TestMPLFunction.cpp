@@ -0,0 +1,123 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "MaterialLib/MPL/Properties/Function.h"
+
+namespace MPL = MaterialPropertyLib;
+
+TEST(MaterialPropertyLib, Function)
+{
+    MPL::Function const function{
+        "function",
+        {"2 * temperature + phase_pressure"},
+        {{"temperature", {"2"}}, {"phase_pressure", {"1"}}}};
+
+    MPL::VariableArray variable_array;
+    variable_array[static_cast<int>(MPL::Variable::temperature)] = 300.;
+    variable_array[static_cast<int>(MPL::Variable::phase_pressure)] = 1e5;
+    ParameterLib::SpatialPosition const pos;
+    double const time = std::numeric_limits<double>::quiet_NaN();
+    double const dt = std::numeric_limits<double>::quiet_NaN();
+
+    ASSERT_EQ(600. + 1e5,
+              std::get<double>(function.value(variable_array, pos, time, dt)));
+    ASSERT_EQ(2., std::get<double>(function.dValue(
+                      variable_array, MPL::Variable::temperature, pos, time,
+                      dt)));
+    ASSERT_EQ(1., std::get<double>(function.dValue(
+                      variable_array, MPL::Variable::phase_pressure, pos, time,
+                      dt)));
+}
+
+// Each thread evaluates the function for different values of the variables.
+// The symbol values of one thread must not be seen by the other threads.
+TEST(MaterialPropertyLib, FunctionConcurrentEvaluation)
+{
+    MPL::Function const function{
+        "function", {"temperature * temperature"}, {}};
+
+    int const number_of_threads = 4;
+    int const number_of_evaluations = 10000;
+    std::vector<int> number_of_wrong_values(number_of_threads, 0);
+
+    auto evaluate = [&](int const thread)
+    {
+        ParameterLib::SpatialPosition const pos;
+        double const time = std::numeric_limits<double>::quiet_NaN();
+        double const dt = std::numeric_limits<double>::quiet_NaN();
+        MPL::VariableArray variable_array;
+        for (int i = 0; i < number_of_evaluations; i++)
+        {
+            double const temperature = thread * number_of_evaluations + i;
+            variable_array[static_cast<int>(MPL::Variable::temperature)] =
+                temperature;
+            if (std::get<double>(function.value(variable_array, pos, time,
+                                                dt)) !=
+                temperature * temperature)
+            {
+                number_of_wrong_values[thread]++;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < number_of_threads; thread++)
+    {
+        threads.emplace_back(evaluate, thread);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int thread = 0; thread < number_of_threads; thread++)
+    {
+        EXPECT_EQ(0, number_of_wrong_values[thread]);
+    }
+}
+
+// The evaluators of the OpenMP threads are created on first use, also for more
+// threads than the default number of threads.
+TEST(MaterialPropertyLib, FunctionOpenMPParallelEvaluation)
+{
+    MPL::Function const function{
+        "function", {"temperature * temperature"}, {{"temperature", {"2"}}}};
+
+    int const number_of_evaluations = 10000;
+    int number_of_wrong_values = 0;
+
+    // The loop variable is signed as required by OpenMP 2.0 (MSVC).
+#pragma omp parallel for num_threads(8) reduction(+ : number_of_wrong_values)
+    for (int i = 0; i < number_of_evaluations; i++)
+    {
+        ParameterLib::SpatialPosition const pos;
+        double const time = std::numeric_limits<double>::quiet_NaN();
+        double const dt = std::numeric_limits<double>::quiet_NaN();
+        MPL::VariableArray variable_array;
+        double const temperature = i;
+        variable_array[static_cast<int>(MPL::Variable::temperature)] =
+            temperature;
+        if (std::get<double>(function.value(variable_array, pos, time, dt)) !=
+                temperature * temperature ||
+            std::get<double>(function.dValue(variable_array,
+                                             MPL::Variable::temperature, pos,
+                                             time, dt)) != 2)
+        {
+            number_of_wrong_values++;
+        }
+    }
+
+    EXPECT_EQ(0, number_of_wrong_values);
+}
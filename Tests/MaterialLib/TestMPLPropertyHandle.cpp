@@ -0,0 +1,72 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include "MaterialLib/MPL/Properties/Constant.h"
+#include "MaterialLib/MPL/Properties/Linear.h"
+#include "MaterialLib/MPL/PropertyHandle.h"
+
+namespace MPL = MaterialPropertyLib;
+
+TEST(MaterialPropertyLib, PropertyHandleOfConstant)
+{
+    MPL::Constant const constant{"constant", 2.5};
+    MPL::PropertyHandle<double> const handle(constant);
+
+    MPL::VariableArray const variable_array;
+    ParameterLib::SpatialPosition const pos;
+    double const time = std::numeric_limits<double>::quiet_NaN();
+    double const dt = std::numeric_limits<double>::quiet_NaN();
+    ASSERT_EQ(2.5, handle.value(variable_array, pos, time, dt));
+    ASSERT_EQ(2.5, handle.value(variable_array, variable_array, pos, time, dt));
+    ASSERT_EQ(0.0, handle.dValue(variable_array, MPL::Variable::temperature,
+                                 pos, time, dt));
+}
+
+TEST(MaterialPropertyLib, PropertyHandleOfConstantTensor)
+{
+    Eigen::Matrix3d const tensor = Eigen::Matrix3d::Identity();
+    MPL::Constant const constant{"constant", tensor};
+    MPL::PropertyHandle<Eigen::Matrix3d> const handle(constant);
+
+    MPL::VariableArray const variable_array;
+    ParameterLib::SpatialPosition const pos;
+    double const time = std::numeric_limits<double>::quiet_NaN();
+    double const dt = std::numeric_limits<double>::quiet_NaN();
+    ASSERT_EQ(tensor, handle.value(variable_array, pos, time, dt));
+}
+
+TEST(MaterialPropertyLib, PropertyHandleOfLinear)
+{
+    double const y_ref = 1.0;
+    double const m = 0.5;
+    double const x_ref = 293.15;
+    MPL::Linear const linear{
+        "linear", y_ref,
+        {MPL::IndependentVariable{MPL::Variable::temperature, x_ref, m}}};
+    MPL::Property const& property = linear;
+    MPL::PropertyHandle<double> const handle(property);
+
+    MPL::VariableArray variable_array;
+    variable_array[static_cast<int>(MPL::Variable::temperature)] = 303.15;
+    ParameterLib::SpatialPosition const pos;
+    double const time = std::numeric_limits<double>::quiet_NaN();
+    double const dt = std::numeric_limits<double>::quiet_NaN();
+    ASSERT_EQ(property.value<double>(variable_array, pos, time, dt),
+              handle.value(variable_array, pos, time, dt));
+    ASSERT_EQ(property.dValue<double>(variable_array,
+                                      MPL::Variable::temperature, pos, time,
+                                      dt),
+              handle.dValue(variable_array, MPL::Variable::temperature, pos,
+                            time, dt));
+}
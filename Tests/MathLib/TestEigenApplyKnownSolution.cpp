@@ -0,0 +1,109 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef USE_PETSC
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <vector>
+
+#include "MathLib/LinAlg/Eigen/EigenMatrix.h"
+#include "MathLib/LinAlg/Eigen/EigenTools.h"
+#include "MathLib/LinAlg/Eigen/EigenVector.h"
+
+namespace
+{
+// Row-major 4x4 matrix with an empty third row and column, like for a
+// deactivated subdomain.
+void setMatrix(MathLib::EigenMatrix& A)
+{
+    A.setValue(0, 0, 4.0);
+    A.setValue(0, 1, -1.0);
+    A.setValue(0, 3, -2.0);
+    A.setValue(1, 0, -1.0);
+    A.setValue(1, 1, 4.0);
+    A.setValue(1, 3, -3.0);
+    A.setValue(3, 0, -2.0);
+    A.setValue(3, 1, -3.0);
+    A.setValue(3, 3, 5.0);
+}
+
+void checkSolution(MathLib::EigenMatrix const& A, MathLib::EigenVector const& b)
+{
+    Eigen::Matrix4d expected_A;
+    // clang-format off
+    expected_A << 4.0,  0.0, 0.0, -2.0,
+                  0.0,  4.0, 0.0,  0.0,
+                  0.0,  0.0, 1.0,  0.0,
+                 -2.0,  0.0, 0.0,  5.0;
+    // clang-format on
+    Eigen::Vector4d const expected_b{1.0 + 2.0, 8.0, 3.0, 1.0 + 6.0};
+
+    ASSERT_TRUE(A.getRawMatrix().isCompressed());
+    ASSERT_EQ(expected_A, Eigen::Matrix4d(A.getRawMatrix()));
+    ASSERT_EQ(expected_b, b.getRawVector());
+}
+}  // namespace
+
+TEST(MathLibEigen, ApplyKnownSolution)
+{
+    MathLib::EigenMatrix A(4);
+    setMatrix(A);
+    MathLib::EigenVector b(4);
+    MathLib::EigenVector x(4);
+    std::vector<MathLib::EigenMatrix::IndexType> const known_ids{1, 2};
+    std::vector<double> const known_values{2.0, 3.0};
+
+    b.setZero();
+    b.set(0, 1.0);
+    b.set(3, 1.0);
+    MathLib::applyKnownSolution(A, b, x, known_ids, known_values);
+    checkSolution(A, b);
+
+    // Same sparsity pattern in the next iteration; the column entries of the
+    // previous call are reused.
+    auto const* const column_entries = &A.getColumnEntries();
+    auto const number_of_entries = column_entries->rows.size();
+    A.setZero();
+    setMatrix(A);
+    b.setZero();
+    b.set(0, 1.0);
+    b.set(3, 1.0);
+    MathLib::applyKnownSolution(A, b, x, known_ids, known_values);
+    checkSolution(A, b);
+    ASSERT_EQ(column_entries, &A.getColumnEntries());
+    ASSERT_EQ(number_of_entries, A.getColumnEntries().rows.size());
+}
+
+TEST(MathLibEigen, ColumnEntriesFollowSparsityPatternChanges)
+{
+    MathLib::EigenMatrix A(3);
+    A.setValue(0, 0, 1.0);
+    A.setValue(1, 1, 1.0);
+    A.setValue(2, 0, 1.0);
+
+    auto const& entries = A.getColumnEntries();
+    ASSERT_EQ((std::vector<MathLib::EigenMatrix::StorageIndex>{0, 2, 3, 3}),
+              entries.column_begin);
+    ASSERT_EQ((std::vector<MathLib::EigenMatrix::StorageIndex>{0, 2, 1}),
+              entries.rows);
+
+    A.setValue(0, 2, 1.0);
+    A.getColumnEntries();
+    ASSERT_EQ((std::vector<MathLib::EigenMatrix::StorageIndex>{0, 2, 3, 4}),
+              entries.column_begin);
+    ASSERT_EQ((std::vector<MathLib::EigenMatrix::StorageIndex>{0, 2, 1, 0}),
+              entries.rows);
+    ASSERT_EQ((std::vector<MathLib::EigenMatrix::StorageIndex>{0, 3, 2, 1}),
+              entries.positions);
+}
+
+#endif
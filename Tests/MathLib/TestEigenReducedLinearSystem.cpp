@@ -0,0 +1,106 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef USE_PETSC
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <Eigen/SparseLU>
+#include <vector>
+
+#include "MathLib/LinAlg/Eigen/EigenMatrix.h"
+#include "MathLib/LinAlg/Eigen/EigenReducedLinearSystem.h"
+#include "MathLib/LinAlg/Eigen/EigenTools.h"
+#include "MathLib/LinAlg/Eigen/EigenVector.h"
+
+namespace
+{
+using IndexType = MathLib::EigenMatrix::IndexType;
+
+IndexType const n = 5;
+
+// Stiffness matrix of the unit springs 0-1, 1-3 and 3-4 with forces at the
+// nodes 1, 3 and 4. Node 2 only belongs to a deactivated spring, so its row
+// and column are empty and it has to be pinned like node 0, which prevents
+// the rigid body motion.
+void setSystem(MathLib::EigenMatrix& A, MathLib::EigenVector& b)
+{
+    A.setZero();
+    A.setValue(0, 0, 1.0);
+    A.setValue(0, 1, -1.0);
+    A.setValue(1, 0, -1.0);
+    A.setValue(1, 1, 2.0);
+    A.setValue(1, 3, -1.0);
+    A.setValue(3, 1, -1.0);
+    A.setValue(3, 3, 2.0);
+    A.setValue(3, 4, -1.0);
+    A.setValue(4, 3, -1.0);
+    A.setValue(4, 4, 1.0);
+
+    b.setZero();
+    b.set(1, 1.0);
+    b.set(3, 2.0);
+    b.set(4, 0.5);
+}
+
+void solve(MathLib::EigenMatrix& A, MathLib::EigenVector const& b,
+           MathLib::EigenVector& x)
+{
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
+    Eigen::SparseMatrix<double> const A_col_major = A.getRawMatrix();
+    solver.compute(A_col_major);
+    ASSERT_EQ(Eigen::Success, solver.info());
+    x.getRawVector() = solver.solve(b.getRawVector());
+}
+
+void checkReducedSolution(std::vector<IndexType> const& known_ids,
+                          std::vector<double> const& known_values,
+                          MathLib::EigenReducedLinearSystem& reduced_system,
+                          MathLib::EigenMatrix& A, MathLib::EigenVector& b)
+{
+    MathLib::EigenVector x(n);
+    x.setZero();
+    setSystem(A, b);
+    MathLib::applyKnownSolution(A, b, x, known_ids, known_values);
+
+    MathLib::EigenVector x_expected(n);
+    solve(A, b, x_expected);
+
+    reduced_system.restrictSystem(A, b, x, known_ids);
+    ASSERT_EQ(n - static_cast<IndexType>(known_ids.size()),
+              reduced_system.size());
+    solve(reduced_system.getMatrix(), reduced_system.getRHS(),
+          reduced_system.getSolution());
+    reduced_system.prolongateSolution(A, b, x);
+
+    EXPECT_LE((x.getRawVector() - x_expected.getRawVector()).norm(),
+              1e-14 * x_expected.getRawVector().norm());
+    for (std::size_t i = 0; i < known_ids.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(known_values[i], x[known_ids[i]]);
+    }
+}
+}  // namespace
+
+TEST(MathLibEigen, ReducedLinearSystem)
+{
+    MathLib::EigenMatrix A(n);
+    MathLib::EigenVector b(n);
+    MathLib::EigenReducedLinearSystem reduced_system;
+
+    checkReducedSolution({0, 2}, {1.0, 0.0}, reduced_system, A, b);
+    // Same known solutions; the compact system is reused.
+    checkReducedSolution({0, 2}, {1.0, 0.0}, reduced_system, A, b);
+    // A changed active set triggers a rebuild of the compact system.
+    checkReducedSolution({0, 2, 4}, {1.0, 0.0, 2.0}, reduced_system, A, b);
+}
+
+#endif
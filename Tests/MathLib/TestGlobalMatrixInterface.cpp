@@ -236,4 +236,60 @@ TEST(Math, CheckInterface_EigenMatrix)
     MathLib::EigenMatrix m(10);
     checkGlobalMatrixInterface(m);
 }
+
+TEST(Math, EigenMatrixAddWithScatterMap)
+{
+    Eigen::Matrix3d local_m;
+    local_m << 1., 2., 3., 4., 5., 6., 7., 8., 9.;
+    std::vector<GlobalIndexType> const pos{7, 1, 4};
+    MathLib::RowColumnIndices<GlobalIndexType> const indices(pos, pos);
+
+    MathLib::EigenMatrix expected(10, 3);
+    MathLib::EigenMatrix m(10, 3);
+    MathLib::EigenMatrix::ScatterMap scatter_map;
+
+    auto const check = [&]()
+    {
+        for (auto const i : pos)
+        {
+            for (auto const j : pos)
+            {
+                ASSERT_EQ(expected.get(i, j), m.get(i, j));
+            }
+        }
+    };
+
+    // Entries are inserted on first use.
+    expected.add(indices, local_m);
+    m.add(indices, local_m, scatter_map);
+    check();
+    ASSERT_EQ(9u, scatter_map.size());
+
+    // The cached locations are valid for compressed and uncompressed storage.
+    m.getRawMatrix().makeCompressed();
+    expected.add(indices, local_m);
+    m.add(indices, local_m, scatter_map);
+    check();
+
+    // Outdated cached locations are detected after the pattern has changed.
+    m.add(1, 2, 10.);
+    m.add(4, 3, 10.);
+    expected.add(indices, local_m);
+    m.add(indices, local_m, scatter_map);
+    check();
+    ASSERT_EQ(10., m.get(1, 2));
+
+    // Entries not yet in the pattern are not inserted.
+    std::vector<Eigen::Triplet<double, GlobalIndexType>> missing_entries;
+    std::vector<GlobalIndexType> const other_pos{1, 4, 9};
+    MathLib::RowColumnIndices<GlobalIndexType> const other_indices(other_pos,
+                                                                   other_pos);
+    MathLib::EigenMatrix::ScatterMap other_scatter_map;
+    auto const nonzeros = m.getRawMatrix().nonZeros();
+    m.addToExistingEntries(other_indices, local_m, other_scatter_map,
+                           missing_entries);
+    ASSERT_EQ(nonzeros, m.getRawMatrix().nonZeros());
+    ASSERT_EQ(5u, missing_entries.size());
+    ASSERT_EQ(3. * 9. + 5., m.get(4, 4));
+}
 #endif
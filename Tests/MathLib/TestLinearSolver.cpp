@@ -317,6 +317,161 @@ TEST(Math, CheckInterface_Eigen)
 }
 #endif
 
+#if not defined(USE_LIS) and not defined(USE_PETSC)
+namespace
+{
+MathLib::EigenLinearSolver createEigenLinearSolver(
+    boost::property_tree::ptree const& solver_config)
+{
+    boost::property_tree::ptree t_root;
+    t_root.put_child("eigen", solver_config);
+    BaseLib::ConfigTree conf(std::move(t_root), "",
+                             BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    auto const solver_options =
+        MathLib::LinearSolverOptionsParser<MathLib::EigenLinearSolver>{}
+            .parseNameAndOptions("", &conf);
+    return std::make_from_tuple<MathLib::EigenLinearSolver>(solver_options);
+}
+
+// Repeatedly assembles a tridiagonal system into the same matrix, as in Newton
+// iterations. The values of the matrix change with the given diagonal shift,
+// the right-hand side with the given iteration. The optional coupling of the
+// first and the last row changes the sparsity pattern.
+class EigenRepeatedSolves : public ::testing::Test
+{
+protected:
+    void assemble(double const diagonal_shift, int const iteration,
+                  bool const couple_ends = false)
+    {
+        A.setZero();
+        for (int i = 0; i < n; i++)
+        {
+            A.add(i, i, 2.0 + diagonal_shift + 0.01 * i);
+            if (i > 0)
+            {
+                A.add(i, i - 1, -1.0);
+            }
+            if (i < n - 1)
+            {
+                A.add(i, i + 1, -1.0 + 0.1 * diagonal_shift);
+            }
+            b.set(i, 1.0 + i + iteration);
+        }
+        if (couple_ends)
+        {
+            A.add(0, n - 1, -0.5);
+            A.add(n - 1, 0, -0.5);
+        }
+    }
+
+    void solve(MathLib::EigenLinearSolver& ls)
+    {
+        ASSERT_TRUE(ls.solve(A, b, x));
+
+        Eigen::VectorXd const residual =
+            A.getRawMatrix() * x.getRawVector() - b.getRawVector();
+        EXPECT_LT(residual.norm(), 1e-8 * b.getRawVector().norm());
+    }
+
+    static constexpr int n = 50;
+    MathLib::EigenMatrix A{n, 3};
+    MathLib::EigenVector b{n};
+    MathLib::EigenVector x{n};
+};
+}  // namespace
+
+TEST_F(EigenRepeatedSolves, SparseLU)
+{
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "SparseLU");
+    auto ls = createEigenLinearSolver(t_solver);
+    auto const& statistics = ls.getStatistics();
+
+    // The pattern is analyzed once, the values are factorized in each solve.
+    x.setZero();
+    for (int iteration = 0; iteration < 6; iteration++)
+    {
+        assemble(0.1 * iteration, iteration);
+        solve(ls);
+        EXPECT_EQ(1, statistics.pattern_analyses);
+        EXPECT_EQ(iteration + 1, statistics.factorizations);
+    }
+
+    // A changed pattern is analyzed again, once.
+    for (int iteration = 0; iteration < 2; iteration++)
+    {
+        assemble(0, iteration, true);
+        solve(ls);
+        EXPECT_EQ(2, statistics.pattern_analyses);
+        EXPECT_EQ(7 + iteration, statistics.factorizations);
+    }
+}
+
+TEST_F(EigenRepeatedSolves, ReusePreconditioner)
+{
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "BiCGSTAB");
+    t_solver.put("precon_type", "ILUT");
+    t_solver.put("error_tolerance", 1e-12);
+    t_solver.put("max_iteration_step", 1000);
+    t_solver.put("reuse_preconditioner", 3);
+    auto ls = createEigenLinearSolver(t_solver);
+    auto const& statistics = ls.getStatistics();
+
+    // The preconditioner is computed in the first solve and reused in the
+    // three following ones.
+    x.setZero();
+    for (int iteration = 0; iteration < 6; iteration++)
+    {
+        assemble(0, iteration);
+        solve(ls);
+        int const computations = iteration < 4 ? 1 : 2;
+        EXPECT_EQ(computations, statistics.preconditioner_computations);
+        EXPECT_EQ(iteration + 1 - computations,
+                  statistics.preconditioner_reuses);
+    }
+
+    // A changed pattern requires a new preconditioner.
+    assemble(0, 0, true);
+    solve(ls);
+    EXPECT_EQ(3, statistics.preconditioner_computations);
+    EXPECT_EQ(4, statistics.preconditioner_reuses);
+
+    // The reused preconditioner does not fit the strongly changed values
+    // anymore and the solve is repeated with a recomputed one.
+    ls.getOption().max_iterations = 3;
+    assemble(8, 0, true);
+    solve(ls);
+    EXPECT_EQ(4, statistics.preconditioner_computations);
+    EXPECT_EQ(5, statistics.preconditioner_reuses);
+}
+
+TEST_F(EigenRepeatedSolves, ReusePreconditionerWithChangingValues)
+{
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "BiCGSTAB");
+    t_solver.put("precon_type", "ILUT");
+    t_solver.put("error_tolerance", 1e-12);
+    t_solver.put("max_iteration_step", 1000);
+    t_solver.put("reuse_preconditioner", 3);
+    auto ls = createEigenLinearSolver(t_solver);
+    auto const& statistics = ls.getStatistics();
+
+    x.setZero();
+    for (int iteration = 0; iteration < 6; iteration++)
+    {
+        assemble(0.1 * iteration, iteration);
+        solve(ls);
+    }
+    // Each solve either reuses or recomputes the preconditioner. It is
+    // recomputed at least every fourth solve.
+    EXPECT_EQ(6, statistics.preconditioner_computations +
+                     statistics.preconditioner_reuses);
+    EXPECT_GE(statistics.preconditioner_computations, 2);
+}
+#endif
+
 #if defined(USE_LIS)
 TEST(Math, CheckInterface_EigenLis)
 {
@@ -11,6 +11,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -18,6 +19,7 @@
 #include "MeshLib/MeshGenerators/MeshGenerator.h"
 #include "MeshLib/MeshSearch/NodeSearch.h"
 #include "MeshLib/MeshSubset.h"
+#include "NumLib/DOF/DOFTableUtil.h"
 
 class NumLibLocalToGlobalIndexMapTest : public ::testing::Test
 {
@@ -297,3 +299,41 @@ TEST_F(NumLibLocalToGlobalIndexMapTest,
     ASSERT_EQ(1u, ele1_c2_indices.rows.size());
     ASSERT_EQ(20u, ele1_c2_indices.rows[0]);
 }
+
+#ifndef USE_PETSC
+TEST_F(NumLibLocalToGlobalIndexMapTest, ElementIndices)
+#else
+TEST_F(NumLibLocalToGlobalIndexMapTest, DISABLED_ElementIndices)
+#endif
+{
+    // 2nd variable only on element id 1, such that the elements have
+    // different numbers of indices.
+    std::vector<MeshLib::Node*> var2_nodes{
+        const_cast<MeshLib::Node*>(mesh->getNode(1)),
+        const_cast<MeshLib::Node*>(mesh->getNode(2))};
+    MeshLib::MeshSubset var2_subset{*mesh, var2_nodes};
+    components.emplace_back(var2_subset);
+
+    std::vector<int> vec_var_n_components{2, 1};
+    std::vector<std::vector<MeshLib::Element*> const*> vec_var_elements;
+    vec_var_elements.push_back(&mesh->getElements());
+    std::vector<MeshLib::Element*> var2_elements{
+        const_cast<MeshLib::Element*>(mesh->getElement(1))};
+    vec_var_elements.push_back(&var2_elements);
+
+    dof_map = std::make_unique<NumLib::LocalToGlobalIndexMap>(
+        std::move(components),
+        vec_var_n_components,
+        vec_var_elements,
+        NumLib::ComponentOrder::BY_COMPONENT);
+
+    for (std::size_t id = 0; id < dof_map->size(); ++id)
+    {
+        auto const expected = NumLib::getIndices(id, *dof_map);
+        auto const indices = dof_map->getElementIndices(id);
+        ASSERT_EQ(expected.size(), indices.size());
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+                               indices.begin()));
+    }
+    ASSERT_EQ(6u, dof_map->getElementIndices(1).size());
+}
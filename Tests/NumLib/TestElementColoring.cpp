@@ -0,0 +1,89 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <set>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "NumLib/DOF/DOFTableUtil.h"
+#include "NumLib/DOF/ElementColoring.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+
+namespace
+{
+// Checks that each mesh item has exactly one color and that no two mesh items
+// of the same color share a global index.
+void checkColoring(NumLib::LocalToGlobalIndexMap const& dof_table,
+                   std::vector<std::vector<std::size_t>> const& colors)
+{
+    std::vector<int> number_of_colors_per_item(dof_table.size(), 0);
+    for (auto const& color : colors)
+    {
+        EXPECT_FALSE(color.empty());
+        EXPECT_TRUE(std::is_sorted(color.begin(), color.end()));
+
+        std::set<GlobalIndexType> indices_of_color;
+        for (auto const item : color)
+        {
+            ++number_of_colors_per_item[item];
+            for (auto const index : NumLib::getIndices(item, dof_table))
+            {
+                EXPECT_TRUE(indices_of_color.insert(std::abs(index)).second)
+                    << "Global index " << index << " of mesh item " << item
+                    << " is shared within one color.";
+            }
+        }
+    }
+
+    EXPECT_TRUE(std::all_of(number_of_colors_per_item.begin(),
+                            number_of_colors_per_item.end(),
+                            [](int const n) { return n == 1; }));
+}
+}  // namespace
+
+TEST(NumLib_ElementColoring, LineMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateLineMesh(10u, 1.));
+    MeshLib::MeshSubset nodes_subset{*mesh, mesh->getNodes()};
+    NumLib::LocalToGlobalIndexMap dof_table(
+        {nodes_subset}, NumLib::ComponentOrder::BY_COMPONENT);
+
+    auto const colors = NumLib::computeElementColoring(dof_table);
+
+    // Neighbouring line elements share one node, every other element does
+    // not share any node with the others.
+    ASSERT_EQ(2u, colors.size());
+    EXPECT_EQ((std::vector<std::size_t>{0, 2, 4, 6, 8}), colors[0]);
+    EXPECT_EQ((std::vector<std::size_t>{1, 3, 5, 7, 9}), colors[1]);
+    checkColoring(dof_table, colors);
+}
+
+TEST(NumLib_ElementColoring, MultipleComponentsHexMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 5));
+    MeshLib::MeshSubset nodes_subset{*mesh, mesh->getNodes()};
+    NumLib::LocalToGlobalIndexMap dof_table(
+        {nodes_subset, nodes_subset, nodes_subset},
+        NumLib::ComponentOrder::BY_LOCATION);
+
+    auto const& colors = dof_table.getElementColors();
+
+    // A hexahedron shares nodes with 26 neighbours, the greedy coloring of the
+    // structured mesh needs eight colors.
+    EXPECT_EQ(8u, colors.size());
+    checkColoring(dof_table, colors);
+
+    // The coloring is cached.
+    EXPECT_EQ(&colors, &dof_table.getElementColors());
+}
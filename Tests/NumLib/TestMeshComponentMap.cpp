@@ -146,6 +146,48 @@ TEST_F(NumLibMeshComponentMapTest, DISABLED_OutOfRangeAccess)
                   Location(mesh->getID(), MeshItemType::Node, 0), 10));
 }
 
+#ifndef USE_PETSC
+TEST_F(NumLibMeshComponentMapTest, ComponentOnSubsetByLocation)
+#else
+TEST_F(NumLibMeshComponentMapTest, DISABLED_ComponentOnSubsetByLocation)
+#endif
+{
+    // The second component is defined on every other node only, like a
+    // pressure on the base nodes of Taylor-Hood elements.
+    std::vector<MeshLib::Node*> every_other_node;
+    for (std::size_t i = 0; i < mesh->getNumberOfNodes(); i += 2)
+    {
+        every_other_node.push_back(mesh->getNodes()[i]);
+    }
+    std::vector<MeshLib::MeshSubset> const partial_components{
+        components[0], MeshLib::MeshSubset{*mesh, every_other_node}};
+
+    cmap = new MeshComponentMap(partial_components,
+                                NumLib::ComponentOrder::BY_LOCATION);
+
+    ASSERT_EQ(mesh->getNumberOfNodes() + every_other_node.size(),
+              cmap->dofSizeWithGhosts());
+    std::size_t global_index = 0;
+    for (std::size_t i = 0; i < mesh->getNumberOfNodes(); i++)
+    {
+        ASSERT_EQ(global_index++, giAtNodeForComponent(i, comp0_id));
+
+        std::vector<int> const vecCompIDs = cmap->getComponentIDs(
+            Location(mesh->getID(), MeshItemType::Node, i));
+        if (i % 2 == 0)
+        {
+            ASSERT_EQ(global_index++, giAtNodeForComponent(i, comp1_id));
+            ASSERT_EQ((std::vector<int>{0, 1}), vecCompIDs);
+        }
+        else
+        {
+            ASSERT_EQ(MeshComponentMap::nop,
+                      giAtNodeForComponent(i, comp1_id));
+            ASSERT_EQ((std::vector<int>{0}), vecCompIDs);
+        }
+    }
+}
+
 MeshLib::Mesh createMeshFromSelectedNodes(
     MeshLib::Mesh const& mesh, std::vector<std::size_t> const& selected_nodes)
 {
@@ -0,0 +1,126 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "CoordinatesMappingTestData/TestHex8.h"
+#include "CoordinatesMappingTestData/TestLine2.h"
+#include "CoordinatesMappingTestData/TestLine3.h"
+#include "CoordinatesMappingTestData/TestQuad4.h"
+#include "CoordinatesMappingTestData/TestTri3.h"
+#include "NumLib/Fem/InitShapeMatrices.h"
+#include "NumLib/Fem/Integration/GaussLegendreIntegrationPolicy.h"
+#include "NumLib/Fem/ReferenceElementShapeMatrices.h"
+#include "NumLib/Fem/ShapeMatrixPolicy.h"
+
+using namespace CoordinatesMappingTestData;
+
+namespace
+{
+using TestTypes =
+    ::testing::Types<TestLine2, TestLine3, TestTri3, TestQuad4, TestHex8>;
+
+struct ElementDeleter
+{
+    void operator()(MeshLib::Element* e) const
+    {
+        for (unsigned i = 0; i < e->getNumberOfNodes(); ++i)
+        {
+            delete e->getNode(i);
+        }
+        delete e;
+    }
+};
+}  // namespace
+
+template <class T_TEST>
+class NumLibReferenceElementShapeMatricesTest : public ::testing::Test,
+                                                public T_TEST
+{
+public:
+    using ShapeFunction = typename T_TEST::ShapeFunctionType;
+    static const unsigned global_dim = T_TEST::global_dim;
+    using ShapeMatricesType = ShapeMatrixPolicyType<ShapeFunction, global_dim>;
+    using IntegrationMethod = typename NumLib::GaussLegendreIntegrationPolicy<
+        typename T_TEST::ElementType>::IntegrationMethod;
+
+    // The cached values must be the same as the ones computed per element.
+    void compareWithInitShapeMatrices(unsigned const integration_order,
+                                      bool const is_axially_symmetric)
+    {
+        std::unique_ptr<MeshLib::Element, ElementDeleter> const e{
+            this->createIrregularShape()};
+        IntegrationMethod const integration_method(integration_order);
+
+        auto const expected =
+            NumLib::initShapeMatrices<ShapeFunction, ShapeMatricesType,
+                                      global_dim>(*e, is_axially_symmetric,
+                                                  integration_method);
+
+        auto const& reference = NumLib::getReferenceElementShapeMatrices<
+            ShapeFunction, ShapeMatricesType>(integration_method);
+        auto const geometric = NumLib::initGeometricShapeMatrices<
+            ShapeFunction, ShapeMatricesType, global_dim>(
+            *e, is_axially_symmetric, reference);
+
+        ASSERT_EQ(integration_method.getNumberOfPoints(), reference.N.size());
+        ASSERT_EQ(integration_method.getNumberOfPoints(), geometric.size());
+        for (unsigned ip = 0; ip < geometric.size(); ++ip)
+        {
+            auto const& sm = expected[ip];
+            EXPECT_EQ(sm.N, reference.N[ip]);
+            EXPECT_EQ(sm.dNdr, reference.dNdr[ip]);
+            EXPECT_TRUE(sm.dNdx.isApprox(geometric[ip].dNdx, 1e-14));
+            EXPECT_DOUBLE_EQ(
+                integration_method.getWeightedPoint(ip).getWeight() *
+                    sm.integralMeasure * sm.detJ,
+                geometric[ip].integration_weight);
+        }
+    }
+};
+
+TYPED_TEST_SUITE(NumLibReferenceElementShapeMatricesTest, TestTypes);
+
+TYPED_TEST(NumLibReferenceElementShapeMatricesTest, CheckAgainstInitShapeMatrices)
+{
+    for (unsigned integration_order = 1; integration_order <= 3;
+         ++integration_order)
+    {
+        this->compareWithInitShapeMatrices(integration_order, false);
+    }
+}
+
+TYPED_TEST(NumLibReferenceElementShapeMatricesTest,
+           CheckAgainstInitShapeMatricesAxiallySymmetric)
+{
+    if (TypeParam::global_dim != 2)
+    {
+        return;
+    }
+    this->compareWithInitShapeMatrices(2, true);
+}
+
+TYPED_TEST(NumLibReferenceElementShapeMatricesTest, CacheIsShared)
+{
+    using ShapeFunction = typename TestFixture::ShapeFunction;
+    using ShapeMatricesType = typename TestFixture::ShapeMatricesType;
+    using IntegrationMethod = typename TestFixture::IntegrationMethod;
+
+    auto const& first = NumLib::getReferenceElementShapeMatrices<
+        ShapeFunction, ShapeMatricesType>(IntegrationMethod{2});
+    auto const& second = NumLib::getReferenceElementShapeMatrices<
+        ShapeFunction, ShapeMatricesType>(IntegrationMethod{2});
+    auto const& other_order = NumLib::getReferenceElementShapeMatrices<
+        ShapeFunction, ShapeMatricesType>(IntegrationMethod{3});
+
+    EXPECT_EQ(&first, &second);
+    EXPECT_NE(&first, &other_order);
+}
@@ -9,11 +9,16 @@
 
 #include <gtest/gtest.h>
 
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
 #include "MeshLib/Elements/Utils.h"
 #include "MeshLib/Mesh.h"
 #include "MeshLib/MeshGenerators/MeshGenerator.h"
 #include "MeshLib/MeshGenerators/QuadraticMeshGenerator.h"
 #include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "NumLib/NumericsConfig.h"
 
@@ -132,3 +137,75 @@ TEST(NumLib_SparsityPattern, DISABLED_MultipleComponentsLinearQuadraticMesh)
     EXPECT_EQ(5u, sp[9]);
     EXPECT_EQ(5u, sp[10]);
 }
+
+#ifndef USE_PETSC
+TEST(NumLib_SparsityPattern, ColumnIndicesMultipleComponentsLinearMesh)
+#else
+TEST(NumLib_SparsityPattern,
+     DISABLED_ColumnIndicesMultipleComponentsLinearMesh)
+#endif
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateLineMesh(3u, 1.));
+    MeshLib::MeshSubset nodesSubset{*mesh, mesh->getNodes()};
+
+    std::vector<MeshLib::MeshSubset> components{nodesSubset, nodesSubset};
+    NumLib::LocalToGlobalIndexMap dof_map(std::move(components),
+                                          NumLib::ComponentOrder::BY_COMPONENT);
+
+    GlobalSparsityPattern sp = NumLib::computeSparsityPattern(dof_map, *mesh);
+
+    ASSERT_TRUE(sp.hasColumnIndices());
+    // Rows of the nodes 0, 1, 2, and 3 for both components.
+    std::vector<GlobalIndexType> const node_columns[] = {
+        {0, 1, 4, 5}, {0, 1, 2, 4, 5, 6}, {1, 2, 3, 5, 6, 7}, {2, 3, 6, 7}};
+    std::vector<GlobalIndexType> expected_column_indices;
+    for (int i = 0; i < 2; i++)
+    {
+        for (auto const& columns : node_columns)
+        {
+            expected_column_indices.insert(expected_column_indices.end(),
+                                           columns.begin(), columns.end());
+        }
+    }
+    auto const column_indices = sp.columnIndices();
+    ASSERT_EQ(expected_column_indices,
+              std::vector<GlobalIndexType>(column_indices.begin(),
+                                           column_indices.end()));
+}
+
+#ifndef USE_PETSC
+TEST(NumLib_SparsityPattern, AssemblyIntoCompressedMatrix)
+#else
+TEST(NumLib_SparsityPattern, DISABLED_AssemblyIntoCompressedMatrix)
+#endif
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+    MeshLib::MeshSubset nodesSubset{*mesh, mesh->getNodes()};
+
+    std::vector<MeshLib::MeshSubset> components{nodesSubset, nodesSubset};
+    NumLib::LocalToGlobalIndexMap dof_map(std::move(components),
+                                          NumLib::ComponentOrder::BY_LOCATION);
+
+    GlobalSparsityPattern sp = NumLib::computeSparsityPattern(dof_map, *mesh);
+
+    GlobalMatrix A(dof_map.dofSizeWithGhosts());
+    MathLib::setMatrixSparsity(A, sp);
+    auto const& raw_matrix = A.getRawMatrix();
+    ASSERT_TRUE(raw_matrix.isCompressed());
+    ASSERT_EQ(static_cast<Eigen::Index>(sp.numberOfNonzeros()),
+              raw_matrix.nonZeros());
+
+    // The assembly of all elements does not insert new entries.
+    for (std::size_t e = 0; e < mesh->getNumberOfElements(); e++)
+    {
+        auto const indices = NumLib::getIndices(e, dof_map);
+        Eigen::MatrixXd const local_matrix =
+            Eigen::MatrixXd::Ones(indices.size(), indices.size());
+        A.add(indices, local_matrix);
+    }
+    ASSERT_TRUE(raw_matrix.isCompressed());
+    ASSERT_EQ(static_cast<Eigen::Index>(sp.numberOfNonzeros()),
+              raw_matrix.nonZeros());
+}
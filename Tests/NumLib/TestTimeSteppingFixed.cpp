@@ -76,3 +76,20 @@ TEST(NumLib, TimeSteppingFixed)
                           std::numeric_limits<double>::epsilon());
     }
 }
+
+TEST(NumLib, TimeSteppingFixedInternalState)
+{
+    std::vector<double> const fixed_dt = {1, 1, 1, 1};
+    NumLib::FixedTimeStepping fixed(0, 4, fixed_dt);
+    NumLib::TimeStep previous(0);
+    NumLib::TimeStep current(1);
+    // The accepted step sizes are appended to the given ones.
+    fixed.resetCurrentTimeStep(1, previous, current);
+    fixed.resetCurrentTimeStep(1, previous, current);
+    auto const state = fixed.getInternalState();
+    ASSERT_EQ(6, state.size());
+
+    NumLib::FixedTimeStepping restarted(0, 4, fixed_dt);
+    restarted.setInternalState(state);
+    EXPECT_EQ(state, restarted.getInternalState());
+}
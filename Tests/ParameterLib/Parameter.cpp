@@ -9,6 +9,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
 #include <boost/property_tree/xml_parser.hpp>
 #include <numeric>
 #include <sstream>
@@ -48,8 +50,33 @@ struct ParameterLibParameter : public ::testing::Test
     {
         // A mesh with four elements, five points.
         meshes.emplace_back(MeshLib::MeshGenerator::generateLineMesh(4u, 1.0));
+
+        curves["linear_curve"] =
+            std::make_unique<MathLib::PiecewiseLinearInterpolation>(
+                std::vector<double>{0, 1}, std::vector<double>{0, 1}, true);
     }
+
+    /// Adds a MeshElement parameter "ElementIDs" with the element ids as
+    /// values.
+    void addElementIDsParameter(
+        std::vector<std::unique_ptr<ParameterBase>>& parameters)
+    {
+        std::vector<double> element_ids({0, 1, 2, 3});
+        MeshLib::addPropertyToMesh(*meshes[0], "ElementIDs",
+                                   MeshLib::MeshItemType::Cell, 1,
+                                   element_ids);
+        parameters.emplace_back(
+            constructParameterFromString("<name>ElementIDs</name>"
+                                         "<type>MeshElement</type>"
+                                         "<field_name>ElementIDs</field_name>",
+                                         meshes));
+    }
+
     std::vector<std::unique_ptr<MeshLib::Mesh>> meshes;
+    /// The curve "linear_curve" with the value t at time t.
+    std::map<std::string,
+             std::unique_ptr<MathLib::PiecewiseLinearInterpolation>>
+        curves;
 };
 
 TEST_F(ParameterLibParameter, GroupBasedParameterElement)
@@ -252,3 +279,182 @@ TEST_F(ParameterLibParameter, GetNodalValuesOnElement_curveScaledNode)
     ASSERT_TRUE(testNodalValuesOfElement(meshes[0]->getElements(),
                                          expected_value, *parameter, t));
 }
+
+// The span output must give the same values as the allocating operator().
+TEST_F(ParameterLibParameter, EvaluateIntoSpan)
+{
+    std::vector<double> element_values({0, 1, 2, 3, 10, 11, 12, 13});
+    MeshLib::addPropertyToMesh(*meshes[0], "ElementValues",
+                               MeshLib::MeshItemType::Cell, 2, element_values);
+
+    std::vector<std::unique_ptr<ParameterBase>> parameters;
+    parameters.emplace_back(
+        constructParameterFromString("<name>ElementValues</name>"
+                                     "<type>MeshElement</type>"
+                                     "<field_name>ElementValues</field_name>",
+                                     meshes));
+
+    auto const curve_scaled = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>CurveScaled</type>"
+        "<curve>linear_curve</curve>"
+        "<parameter>ElementValues</parameter>",
+        meshes, curves);
+    curve_scaled->initialize(parameters);
+
+    auto const constant = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>Constant</type>"
+        "<values>4 5</values>",
+        meshes);
+
+    auto const& element_parameter =
+        static_cast<Parameter<double> const&>(*parameters[0]);
+
+    std::array<Parameter<double> const*, 3> const tested_parameters{
+        &element_parameter, curve_scaled.get(), constant.get()};
+
+    double const t = 0.5;
+    for (auto const* const p : tested_parameters)
+    {
+        for (std::size_t e = 0; e < meshes[0]->getNumberOfElements(); ++e)
+        {
+            ParameterLib::SpatialPosition x;
+            x.setElementID(e);
+
+            std::array<double, 9> buffer;
+            auto const values = p->evaluate(t, x, buffer);
+            auto const expected = (*p)(t, x);
+            ASSERT_EQ(expected.size(), values.size());
+            EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+                                   values.begin()));
+
+            auto const fixed_size = p->evaluateFixedSize<2>(t, x);
+            EXPECT_EQ(expected[0], fixed_size[0]);
+            EXPECT_EQ(expected[1], fixed_size[1]);
+        }
+    }
+}
+
+TEST_F(ParameterLibParameter, EvaluateAtIntegrationPoints)
+{
+    std::vector<std::unique_ptr<ParameterBase>> parameters;
+    addElementIDsParameter(parameters);
+
+    auto const curve_scaled = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>CurveScaled</type>"
+        "<curve>linear_curve</curve>"
+        "<parameter>ElementIDs</parameter>",
+        meshes, curves);
+    curve_scaled->initialize(parameters);
+
+    // Evaluated point by point by the default implementation.
+    auto const function = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>Function</type>"
+        "<expression>x*t</expression>",
+        meshes);
+
+    double const t = 0.5;
+    std::array<MathLib::Point3d, 2> ip_coordinates;
+    std::array<double, 2> values;
+    for (auto const* const e : meshes[0]->getElements())
+    {
+        ip_coordinates[0] = MathLib::Point3d{{(*e->getNode(0))[0], 0, 0}};
+        ip_coordinates[1] = MathLib::Point3d{{(*e->getNode(1))[0], 0, 0}};
+
+        curve_scaled->evaluateAtIntegrationPoints(*e, t, ip_coordinates,
+                                                  values);
+        EXPECT_EQ(e->getID() * t, values[0]);
+        EXPECT_EQ(e->getID() * t, values[1]);
+
+        function->evaluateAtIntegrationPoints(*e, t, ip_coordinates, values);
+        EXPECT_EQ(ip_coordinates[0][0] * t, values[0]);
+        EXPECT_EQ(ip_coordinates[1][0] * t, values[1]);
+    }
+}
+
+// Values stored in preTimestep() are only used at the time they were computed
+// for. The curve is changed after preTimestep(), such that the stored values
+// can be told apart from newly evaluated ones.
+TEST_F(ParameterLibParameter, PreTimestep)
+{
+    std::vector<std::unique_ptr<ParameterBase>> parameters;
+    addElementIDsParameter(parameters);
+    parameters.emplace_back(
+        constructParameterFromString("<name>two</name>"
+                                     "<type>Constant</type>"
+                                     "<value>2</value>",
+                                     meshes));
+
+    parameters.emplace_back(constructParameterFromString(
+        "<name>curve_scaled</name>"
+        "<type>CurveScaled</type>"
+        "<curve>linear_curve</curve>"
+        "<parameter>ElementIDs</parameter>",
+        meshes, curves));
+    parameters.emplace_back(constructParameterFromString(
+        "<name>time_dependent</name>"
+        "<type>TimeDependentHeterogeneousParameter</type>"
+        "<time_series>"
+        "<pair><time>0</time><parameter_name>ElementIDs</parameter_name></pair>"
+        "<pair><time>1</time><parameter_name>two</parameter_name></pair>"
+        "</time_series>",
+        meshes));
+    parameters.emplace_back(constructParameterFromString(
+        "<name>time_only_function</name>"
+        "<type>Function</type>"
+        "<expression>linear_curve(t) + 1</expression>",
+        meshes, curves));
+    parameters.emplace_back(constructParameterFromString(
+        "<name>space_function</name>"
+        "<type>Function</type>"
+        "<expression>x*t</expression>",
+        meshes));
+
+    for (auto const& p : parameters)
+    {
+        p->initialize(parameters);
+    }
+
+    auto const& curve_scaled =
+        static_cast<Parameter<double> const&>(*parameters[2]);
+    auto const& time_dependent =
+        static_cast<Parameter<double> const&>(*parameters[3]);
+    auto const& time_only_function =
+        static_cast<Parameter<double> const&>(*parameters[4]);
+    auto const& space_function =
+        static_cast<Parameter<double> const&>(*parameters[5]);
+
+    auto& linear_curve = *curves["linear_curve"];
+    for (double const t_step : {0.25, 0.5})
+    {
+        linear_curve = MathLib::PiecewiseLinearInterpolation(
+            std::vector<double>{0, 1}, std::vector<double>{0, 1}, true);
+        for (auto const& p : parameters)
+        {
+            p->preTimestep(t_step);
+        }
+        linear_curve = MathLib::PiecewiseLinearInterpolation(
+            std::vector<double>{0, 1}, std::vector<double>{0, 2}, true);
+
+        // Evaluated at the time step and at other times.
+        for (double const t : {t_step, 0.75})
+        {
+            double const curve_value = t == t_step ? t : 2 * t;
+            for (std::size_t e = 0; e < meshes[0]->getNumberOfElements(); ++e)
+            {
+                ParameterLib::SpatialPosition x;
+                x.setElementID(e);
+
+                EXPECT_EQ(e * curve_value, curve_scaled(t, x)[0]);
+                EXPECT_EQ((1 - t) * e + t * 2, time_dependent(t, x)[0]);
+                // A time-only function does not need the coordinates.
+                EXPECT_EQ(curve_value + 1, time_only_function(t, x)[0]);
+                // Functions of the coordinates are not stored.
+                EXPECT_ANY_THROW(space_function(t, x));
+            }
+        }
+    }
+}
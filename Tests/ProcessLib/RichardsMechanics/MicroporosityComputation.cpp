@@ -63,7 +63,7 @@ computeElasticTangentStiffness(
     }
 
     MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C =
-        std::move(std::get<2>(*solution));
+        std::move(std::get<1>(*solution));
 
     return C;
 }
@@ -0,0 +1,81 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "ProcessLib/Output/AsyncOutputWriter.h"
+
+class ProcessLibAsyncOutputWriter : public ::testing::Test
+{
+public:
+    ProcessLibAsyncOutputWriter()
+        : mesh(MeshLib::MeshGenerator::generateLineMesh(1.0, 10)),
+          values(MeshLib::getOrCreateMeshProperty<double>(
+              *mesh, "values", MeshLib::MeshItemType::Node, 1))
+    {
+    }
+
+    std::unique_ptr<MeshLib::Mesh> mesh;
+    MeshLib::PropertyVector<double>* values;
+};
+
+TEST_F(ProcessLibAsyncOutputWriter, WritesSnapshotsOfProperties)
+{
+    // Only accessed from the writer's thread before flush().
+    std::vector<std::vector<double>> written;
+
+    ProcessLib::AsyncOutputWriter writer(2);
+    for (int step = 0; step < 5; step++)
+    {
+        std::fill(values->begin(), values->end(), step);
+        writer.write(*mesh,
+                     [&written](MeshLib::Mesh const& mesh_copy)
+                     {
+                         auto const& v =
+                             *mesh_copy.getProperties()
+                                  .getPropertyVector<double>("values");
+                         written.emplace_back(v.begin(), v.end());
+                     });
+    }
+    writer.flush();
+
+    ASSERT_EQ(5u, written.size());
+    for (std::size_t step = 0; step < written.size(); step++)
+    {
+        ASSERT_EQ(mesh->getNumberOfNodes(), written[step].size());
+        for (auto const value : written[step])
+        {
+            EXPECT_EQ(static_cast<double>(step), value);
+        }
+    }
+}
+
+TEST_F(ProcessLibAsyncOutputWriter, RethrowsErrors)
+{
+    ProcessLib::AsyncOutputWriter writer(1);
+    writer.write(*mesh, [](MeshLib::Mesh const&)
+                 { throw std::runtime_error("write failed"); });
+    EXPECT_THROW(writer.flush(), std::runtime_error);
+
+    // The error is reported only once.
+    int number_of_writes = 0;
+    writer.write(*mesh,
+                 [&number_of_writes](MeshLib::Mesh const&)
+                 { number_of_writes++; });
+    writer.flush();
+    EXPECT_EQ(1, number_of_writes);
+}
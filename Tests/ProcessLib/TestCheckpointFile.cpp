@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "BaseLib/StringTools.h"
+#include "ProcessLib/Checkpoint.h"
+
+TEST(ProcessLibCheckpointFile, WriteRead)
+{
+    auto const file =
+        std::filesystem::temp_directory_path() / BaseLib::randomString(32);
+
+    // Values which do not survive a round trip through a text format.
+    std::vector<double> const doubles{0.1, 1. / 3., -0.0,
+                                      std::numeric_limits<double>::min(),
+                                      std::numeric_limits<double>::max()};
+    std::vector<std::uint64_t> const integers{
+        0, 42, std::numeric_limits<std::uint64_t>::max()};
+    std::string const text = "first line\nsecond line\n";
+
+    {
+        ProcessLib::CheckpointFile checkpoint(
+            file, ProcessLib::CheckpointFile::Mode::Write);
+        checkpoint.write("doubles", doubles);
+        checkpoint.write("group/subgroup/integers", integers);
+        checkpoint.write("group/text", text);
+        checkpoint.write("empty", std::vector<double>{});
+    }
+
+    {
+        ProcessLib::CheckpointFile const checkpoint(
+            file, ProcessLib::CheckpointFile::Mode::Read);
+        auto const read_doubles = checkpoint.readDoubles("doubles");
+        ASSERT_EQ(doubles.size(), read_doubles.size());
+        for (std::size_t i = 0; i < doubles.size(); i++)
+        {
+            // Bitwise equality, also of the sign of zero.
+            EXPECT_EQ(std::signbit(doubles[i]), std::signbit(read_doubles[i]));
+            EXPECT_EQ(doubles[i], read_doubles[i]);
+        }
+        EXPECT_EQ(integers,
+                  checkpoint.readIntegers("group/subgroup/integers"));
+        EXPECT_EQ(text, checkpoint.readString("group/text"));
+        EXPECT_TRUE(checkpoint.readDoubles("empty").empty());
+    }
+
+    std::filesystem::remove(file);
+}
@@ -0,0 +1,310 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2022, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "BaseLib/AllocationCounter.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "ProcessLib/AnalyticalJacobianAssembler.h"
+#include "ProcessLib/LocalAssemblerInterface.h"
+#include "ProcessLib/VectorMatrixAssembler.h"
+
+namespace
+{
+//! Produces element dependent local matrices and vectors, which depend
+//! non-linearly on the local solution.
+class DummyLocalAssembler final : public ProcessLib::LocalAssemblerInterface
+{
+public:
+    explicit DummyLocalAssembler(std::size_t const id) : _id(id) {}
+
+    void assemble(double const t, double const /*dt*/,
+                  std::vector<double> const& local_x,
+                  std::vector<double> const& /*local_xdot*/,
+                  std::vector<double>& local_M_data,
+                  std::vector<double>& local_K_data,
+                  std::vector<double>& local_b_data) override
+    {
+        auto const n = local_x.size();
+        local_M_data.resize(n * n);
+        local_K_data.resize(n * n);
+        local_b_data.resize(n);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            for (std::size_t j = 0; j < n; j++)
+            {
+                local_M_data[i * n + j] = 1.0 / (1.0 + _id + i + 3 * j);
+                local_K_data[i * n + j] =
+                    std::sin(0.1 * _id + t) * local_x[i] * local_x[j] / 7.0;
+            }
+            local_b_data[i] = std::exp(-local_x[i]) / (1.0 + _id);
+        }
+    }
+
+    void assembleWithJacobian(double const t, double const dt,
+                              std::vector<double> const& local_x,
+                              std::vector<double> const& local_xdot,
+                              std::vector<double>& local_M_data,
+                              std::vector<double>& local_K_data,
+                              std::vector<double>& local_b_data,
+                              std::vector<double>& local_Jac_data) override
+    {
+        assemble(t, dt, local_x, local_xdot, local_M_data, local_K_data,
+                 local_b_data);
+        local_Jac_data = local_K_data;
+        for (auto& value : local_Jac_data)
+        {
+            value = std::cos(value) / 3.0;
+        }
+    }
+
+private:
+    std::size_t const _id;
+};
+}  // namespace
+
+class ProcessLibVectorMatrixAssembler : public ::testing::Test
+{
+public:
+    ProcessLibVectorMatrixAssembler()
+        : mesh(MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 40)),
+          mesh_subset(*mesh, mesh->getNodes())
+    {
+        std::vector<MeshLib::MeshSubset> all_mesh_subsets{mesh_subset};
+        dof_table = std::make_unique<NumLib::LocalToGlobalIndexMap>(
+            std::move(all_mesh_subsets), NumLib::ComponentOrder::BY_COMPONENT);
+
+        for (std::size_t i = 0; i < mesh->getNumberOfElements(); i++)
+        {
+            local_assemblers.push_back(std::make_unique<DummyLocalAssembler>(i));
+        }
+
+        auto const n = dof_table->dofSizeWithoutGhosts();
+        x = std::make_unique<GlobalVector>(n);
+        xdot = std::make_unique<GlobalVector>(n);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            (*x)[i] = std::sqrt(static_cast<double>(i));
+            (*xdot)[i] = 0.0;
+        }
+    }
+
+    struct Result
+    {
+        explicit Result(GlobalIndexType const n) : M(n), K(n), Jac(n), b(n)
+        {
+            b.setZero();
+        }
+
+        GlobalMatrix M;
+        GlobalMatrix K;
+        GlobalMatrix Jac;
+        GlobalVector b;
+    };
+
+    Result assembleWithJacobian(int const number_of_threads,
+                                std::vector<std::size_t> const& active_ids,
+                                bool const use_element_coloring = false)
+    {
+        ProcessLib::VectorMatrixAssembler assembler(
+            std::make_unique<ProcessLib::AnalyticalJacobianAssembler>());
+        assembler.setOptions({number_of_threads, use_element_coloring});
+
+        Result result(dof_table->dofSizeWithoutGhosts());
+        std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
+            dof_tables = {std::ref(*dof_table)};
+        std::vector<GlobalVector*> xs = {x.get()};
+        std::vector<GlobalVector*> xdots = {xdot.get()};
+        assembler.assembleWithJacobian(local_assemblers, active_ids,
+                                       dof_tables, 0.5, 0.1, xs, xdots, 0,
+                                       result.M, result.K, result.b,
+                                       result.Jac);
+        return result;
+    }
+
+    static void expectNear(GlobalMatrix const& a, GlobalMatrix const& b)
+    {
+        auto const& raw_a = a.getRawMatrix();
+        auto const& raw_b = b.getRawMatrix();
+        ASSERT_EQ(raw_a.nonZeros(), raw_b.nonZeros());
+        for (int k = 0; k < raw_a.outerSize(); ++k)
+        {
+            for (GlobalMatrix::RawMatrixType::InnerIterator it(raw_a, k); it;
+                 ++it)
+            {
+                // Absolute tolerance, because the summands are of larger
+                // magnitude than some of the sums.
+                EXPECT_NEAR(it.value(), raw_b.coeff(it.row(), it.col()),
+                            1e-11);
+            }
+        }
+    }
+
+    static void expectBitwiseEqual(GlobalMatrix const& a, GlobalMatrix const& b)
+    {
+        auto const& raw_a = a.getRawMatrix();
+        auto const& raw_b = b.getRawMatrix();
+        ASSERT_EQ(raw_a.nonZeros(), raw_b.nonZeros());
+        for (int k = 0; k < raw_a.outerSize(); ++k)
+        {
+            for (GlobalMatrix::RawMatrixType::InnerIterator it(raw_a, k); it;
+                 ++it)
+            {
+                EXPECT_EQ(it.value(), raw_b.coeff(it.row(), it.col()));
+            }
+        }
+    }
+
+    std::unique_ptr<MeshLib::Mesh> mesh;
+    MeshLib::MeshSubset mesh_subset;
+    std::unique_ptr<NumLib::LocalToGlobalIndexMap> dof_table;
+    std::vector<std::unique_ptr<ProcessLib::LocalAssemblerInterface>>
+        local_assemblers;
+    std::unique_ptr<GlobalVector> x;
+    std::unique_ptr<GlobalVector> xdot;
+};
+
+#ifndef USE_PETSC
+TEST_F(ProcessLibVectorMatrixAssembler, ParallelAssemblyIsBitwiseIdentical)
+#else
+TEST_F(ProcessLibVectorMatrixAssembler,
+       DISABLED_ParallelAssemblyIsBitwiseIdentical)
+#endif
+{
+    auto const serial = assembleWithJacobian(1, {});
+
+    for (int const number_of_threads : {2, 3, 4})
+    {
+        auto const parallel = assembleWithJacobian(number_of_threads, {});
+
+        expectBitwiseEqual(serial.M, parallel.M);
+        expectBitwiseEqual(serial.K, parallel.K);
+        expectBitwiseEqual(serial.Jac, parallel.Jac);
+        for (GlobalIndexType i = 0; i < serial.b.size(); i++)
+        {
+            EXPECT_EQ(serial.b[i], parallel.b[i]);
+        }
+    }
+}
+
+#ifndef USE_PETSC
+TEST_F(ProcessLibVectorMatrixAssembler, ParallelAssemblyOfSelectedElements)
+#else
+TEST_F(ProcessLibVectorMatrixAssembler,
+       DISABLED_ParallelAssemblyOfSelectedElements)
+#endif
+{
+    std::vector<std::size_t> active_ids;
+    for (std::size_t i = 0; i < local_assemblers.size(); i += 3)
+    {
+        active_ids.push_back(i);
+    }
+
+    auto const serial = assembleWithJacobian(1, active_ids);
+    auto const parallel = assembleWithJacobian(4, active_ids);
+
+    expectBitwiseEqual(serial.M, parallel.M);
+    expectBitwiseEqual(serial.K, parallel.K);
+    expectBitwiseEqual(serial.Jac, parallel.Jac);
+    for (GlobalIndexType i = 0; i < serial.b.size(); i++)
+    {
+        EXPECT_EQ(serial.b[i], parallel.b[i]);
+    }
+}
+
+#ifndef USE_PETSC
+TEST_F(ProcessLibVectorMatrixAssembler, ColoredParallelAssembly)
+#else
+TEST_F(ProcessLibVectorMatrixAssembler, DISABLED_ColoredParallelAssembly)
+#endif
+{
+    std::vector<std::size_t> active_ids;
+    for (std::size_t i = 0; i < local_assemblers.size(); i++)
+    {
+        if (i % 5 != 2)
+        {
+            active_ids.push_back(i);
+        }
+    }
+
+    for (auto const& ids : {std::vector<std::size_t>{}, active_ids})
+    {
+        auto const serial = assembleWithJacobian(1, ids);
+        auto const colored = assembleWithJacobian(2, ids, true);
+
+        // The summation order differs from the serial assembly.
+        expectNear(serial.M, colored.M);
+        expectNear(serial.K, colored.K);
+        expectNear(serial.Jac, colored.Jac);
+        for (GlobalIndexType i = 0; i < serial.b.size(); i++)
+        {
+            EXPECT_NEAR(serial.b[i], colored.b[i], 1e-14);
+        }
+
+        // But does not depend on the number of threads.
+        for (int const number_of_threads : {3, 4})
+        {
+            auto const other = assembleWithJacobian(number_of_threads, ids,
+                                                    true);
+            expectBitwiseEqual(colored.M, other.M);
+            expectBitwiseEqual(colored.K, other.K);
+            expectBitwiseEqual(colored.Jac, other.Jac);
+            for (GlobalIndexType i = 0; i < serial.b.size(); i++)
+            {
+                EXPECT_EQ(colored.b[i], other.b[i]);
+            }
+        }
+    }
+}
+
+#ifndef USE_PETSC
+TEST_F(ProcessLibVectorMatrixAssembler, SerialAssemblyDoesNotAllocate)
+#else
+TEST_F(ProcessLibVectorMatrixAssembler,
+       DISABLED_SerialAssemblyDoesNotAllocate)
+#endif
+{
+    if (!BaseLib::AllocationCounter::isEnabled())
+    {
+        GTEST_SKIP() << "OGS has been built without OGS_COUNT_ALLOCATIONS.";
+    }
+
+    ProcessLib::VectorMatrixAssembler assembler(
+        std::make_unique<ProcessLib::AnalyticalJacobianAssembler>());
+    Result result(dof_table->dofSizeWithoutGhosts());
+    std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
+        dof_tables = {std::ref(*dof_table)};
+    std::vector<GlobalVector*> xs = {x.get()};
+    std::vector<GlobalVector*> xdots = {xdot.get()};
+    std::vector<std::size_t> const active_ids;
+
+    auto const assemble = [&]
+    {
+        assembler.assembleWithJacobian(local_assemblers, active_ids,
+                                       dof_tables, 0.5, 0.1, xs, xdots, 0,
+                                       result.M, result.K, result.b,
+                                       result.Jac);
+    };
+
+    // The first assembly sets up the sparsity patterns and scratch buffers.
+    assemble();
+
+    BaseLib::AllocationCounter allocations;
+    allocations.start();
+    assemble();
+    EXPECT_EQ(0u, allocations.count());
+}
@@ -50,6 +50,17 @@ if(OGS_BUILD_TESTING)
     endif()
 endif()
 
+if(OGS_BUILD_BENCHMARKS)
+    CPMFindPackage(
+        NAME benchmark
+        GITHUB_REPOSITORY google/benchmark
+        VERSION ${ogs.minimum_version.benchmark}
+        OPTIONS "BENCHMARK_ENABLE_TESTING OFF" "BENCHMARK_ENABLE_INSTALL OFF"
+                "BENCHMARK_ENABLE_GTEST_TESTS OFF"
+        EXCLUDE_FROM_ALL YES
+    )
+endif()
+
 CPMFindPackage(NAME spdlog GITHUB_REPOSITORY gabime/spdlog VERSION 1.8.2)
 
 CPMFindPackage(